@@ -0,0 +1,26 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS Configuration Header file
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef COBS_INC_COBS_CONFIG_H_
+#define COBS_INC_COBS_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* 1 => Append a CRC-16/CCITT-FALSE ( Big Endian ) to Every Packet & Drop Received Packets That Fail it
+ * 0 => Plain COBS Framing , Both Ends Must Use The Same Setting */
+#define COBS_CRC_ENABLE 1U
+
+#endif /* COBS_INC_COBS_CONFIG_H_ */
@@ -0,0 +1,105 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS Interface Header file
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef COBS_INC_COBS_INTERFACE_H_
+#define COBS_INC_COBS_INTERFACE_H_
+
+#include "COBS_Config.h"
+
+/* ======================================================================
+ * COBS MACROS
+ * ====================================================================== */
+
+#if (COBS_CRC_ENABLE == 1U)
+#define COBS_CRC_SIZE 2U
+#else
+#define COBS_CRC_SIZE 0U
+#endif
+
+/* Payload Starts After The Code Byte Slot , The Application Fills Frame[COBS_PAYLOAD_OFFSET] Onwards */
+#define COBS_PAYLOAD_OFFSET 1U
+
+/* Longest Payload COBS_EncodeFrame Accepts , Payload + CRC Must Fit in a Single COBS Block to Be Encoded in Place */
+#define COBS_MAX_PAYLOAD (254U - COBS_CRC_SIZE)
+
+/* Size of The Frame Buffer Needed For a Payload ( Code Byte + Payload + CRC + Delimiter ) */
+#define COBS_FRAME_SIZE(PAYLOAD) ((PAYLOAD) + COBS_CRC_SIZE + 2U)
+
+/* ======================================================================
+ * COBS Option Structs
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds The Receive Counters of The COBS Layer
+ * @struct: @COBS_Stats_t
+ */
+typedef struct
+{
+    uint32_t Packets;        /* Valid Packets Handed to The CallBack */
+    uint32_t CrcErrors;      /* Complete Frames Dropped Because of a CRC Mismatch */
+    uint32_t OverflowErrors; /* Frames Dropped Because They Did Not Fit in The Packet Buffer */
+    uint32_t FormatErrors;   /* Truncated Frames or Frames Shorter Than The CRC */
+
+} COBS_Stats_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Encode a Packet Into a COBS Frame in Place ( Appending The CRC if Enabled )
+ * @fn     : COBS_EncodeFrame
+ * @param  : Frame       => This Parameter is Used to Pass The Frame Buffer , The Payload Must Already Be at Frame[COBS_PAYLOAD_OFFSET]
+ * @param  : PayloadSize => This Parameter is Used to Pass The Payload Length ( 1 to COBS_MAX_PAYLOAD )
+ * @param  : FrameSize   => This Parameter is Used to Return The Number of Bytes to Send , Delimiter Included
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Buffer Must Be at Least COBS_FRAME_SIZE(PayloadSize) Bytes , No Copy is Made
+ *           The Frame Can Then Be Sent Using Any USART Transmit Function ( e.g. USART_SendBuffer_DMA )
+ */
+ERRORS_t COBS_EncodeFrame(uint8_t *Frame, uint16_t PayloadSize, uint16_t *FrameSize);
+
+/**
+ * @brief  : This Function is Used to Start Receiving COBS Frames on a USART Peripheral
+ * @fn     : COBS_StartReceive
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of an Already Initialized USART Peripheral
+ * @param  : PacketBuffer    => This Parameter is Used to Pass The Buffer The Frames Are Decoded inside it
+ * @param  : BufferSize      => This Parameter is Used to Pass The Size of The Buffer ( Longest Payload + COBS_CRC_SIZE )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With Each Valid Packet
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Bytes Are Decoded & Checked From The USART ISR as They Arrive , So The Packet is Ready When The Delimiter is Received
+ *           The CallBack Runs in Interrupt Context & The Buffer is Reused For The Next Frame Once it Returns
+ */
+ERRORS_t COBS_StartReceive(USART_Config_t *Config, uint8_t *PacketBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(uint8_t *Packet, uint16_t Size));
+
+/**
+ * @brief  : This Function is Used to Stop Receiving COBS Frames
+ * @fn     : COBS_StopReceive
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : A Partially Received Frame is Discarded
+ */
+ERRORS_t COBS_StopReceive(void);
+
+/**
+ * @brief  : This Function is Used to Get The Receive Counters of The COBS Layer
+ * @fn     : COBS_GetStats
+ * @param  : Stats => This Parameter is Used to Return The Counters -> @COBS_Stats_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t COBS_GetStats(COBS_Stats_t *Stats);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* COBS_INC_COBS_INTERFACE_H_ */
@@ -0,0 +1,92 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : COBS Private Header file
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef COBS_INC_COBS_PRIVATE_H_
+#define COBS_INC_COBS_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+/* Frame Delimiter , The Only Byte Value That Never Appears Inside an Encoded Frame */
+#define COBS_DELIMITER 0x00U
+
+/* A Code Byte of 0xFF Means 254 Data Bytes With No Zero After Them */
+#define COBS_MAX_CODE 0xFFU
+
+/* CRC-16/CCITT-FALSE : Poly 0x1021 , Init 0xFFFF , No Reflection , No Final XOR
+ * Running it Over Payload + Big Endian CRC Leaves a Zero Remainder , So The Receiver Checks Without Knowing Where The Payload Ends */
+#define COBS_CRC_INIT 0xFFFFU
+
+/* ======================================================================
+ * PRIVATE TYPES
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds The State of The Byte By Byte Decoder
+ */
+typedef struct
+{
+    USART_Config_t *Config;
+    uint8_t *Buffer;
+    uint16_t Size;
+    uint16_t Length;                                  /* Decoded Bytes in Buffer So Far */
+    uint8_t Remaining;                                /* Data Bytes Left in The Current Block */
+    uint8_t PendingZero;                              /* Current Block Ends With an Implicit Zero */
+    uint8_t Discard;                                  /* Frame Overflowed , Skip Until The Next Delimiter */
+    uint16_t Crc;                                     /* Running CRC of The Decoded Bytes */
+    void (*CallBack)(uint8_t *Packet, uint16_t Size); /* Valid Packet CallBack */
+
+} COBS_Decoder_t;
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Decode One Received Byte , Invoked From The USART ISR
+ * @fn     : COBS_ReceiveByte
+ * @param  : Data => This Parameter is Used to Pass The Received Byte
+ * @return : void
+ */
+static void COBS_ReceiveByte(uint8_t Data);
+
+/**
+ * @brief  : This Function is Used to Store One Decoded Byte in The Packet Buffer & Update The Running CRC
+ * @fn     : COBS_StoreByte
+ * @param  : Data => This Parameter is Used to Pass The Decoded Byte
+ * @return : void
+ */
+static void COBS_StoreByte(uint8_t Data);
+
+/**
+ * @brief  : This Function is Used to Reset The Decoder For a New Frame
+ * @fn     : COBS_ResetDecoder
+ * @return : void
+ */
+static void COBS_ResetDecoder(void);
+
+#if (COBS_CRC_ENABLE == 1U)
+/**
+ * @brief  : This Function is Used to Feed One Byte Into a CRC-16/CCITT-FALSE
+ * @fn     : COBS_UpdateCRC
+ * @param  : Crc  => This Parameter is Used to Pass The Current CRC Value
+ * @param  : Data => This Parameter is Used to Pass The Byte
+ * @return : uint16_t => The Updated CRC Value
+ * @note   : Nibble Table Version , 32 Bytes of Flash Instead of 512 For Two Lookups Per Byte
+ */
+static uint16_t COBS_UpdateCRC(uint16_t Crc, uint8_t Data);
+#endif
+
+#endif /* COBS_INC_COBS_PRIVATE_H_ */
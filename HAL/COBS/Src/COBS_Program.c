@@ -0,0 +1,323 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../Inc/COBS_Interface.h"
+#include "../Inc/COBS_Config.h"
+#include "../Inc/COBS_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION START
+ *==============================================================================================================================================*/
+
+static COBS_Decoder_t COBS_Decoder = {0};
+
+static volatile COBS_Stats_t COBS_Stats = {0};
+
+#if (COBS_CRC_ENABLE == 1U)
+/* CRC of Each Nibble Shifted to The Top of The Register , Generated By Tools/COBS_Test/COBS_CRCTable.c */
+static const uint16_t COBS_CRCNibbleTable[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU};
+#endif
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Encode a Packet Into a COBS Frame in Place ( Appending The CRC if Enabled )
+ * @fn     : COBS_EncodeFrame
+ * @param  : Frame       => This Parameter is Used to Pass The Frame Buffer , The Payload Must Already Be at Frame[COBS_PAYLOAD_OFFSET]
+ * @param  : PayloadSize => This Parameter is Used to Pass The Payload Length ( 1 to COBS_MAX_PAYLOAD )
+ * @param  : FrameSize   => This Parameter is Used to Return The Number of Bytes to Send , Delimiter Included
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t COBS_EncodeFrame(uint8_t *Frame, uint16_t PayloadSize, uint16_t *FrameSize)
+{
+    ERRORS_t Local_u8ErrorStatus = COBS_OK;
+
+    uint16_t Local_u16DataSize = PayloadSize + COBS_CRC_SIZE;
+    uint16_t Local_u16CodeIndex = 0;
+    uint16_t Local_u16Index = 0;
+
+#if (COBS_CRC_ENABLE == 1U)
+    uint16_t Local_u16Crc = COBS_CRC_INIT;
+#endif
+
+    if ((NULL == Frame) || (NULL == FrameSize))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((0U == PayloadSize) || (PayloadSize > COBS_MAX_PAYLOAD))
+    {
+        Local_u8ErrorStatus = COBS_NOK;
+    }
+    else
+    {
+#if (COBS_CRC_ENABLE == 1U)
+        for (Local_u16Index = COBS_PAYLOAD_OFFSET; Local_u16Index <= PayloadSize; Local_u16Index++)
+        {
+            Local_u16Crc = COBS_UpdateCRC(Local_u16Crc, Frame[Local_u16Index]);
+        }
+
+        Frame[PayloadSize + 1U] = (uint8_t)(Local_u16Crc >> 8);
+        Frame[PayloadSize + 2U] = (uint8_t)Local_u16Crc;
+#endif
+
+        /* Each Zero Becomes The Code Byte of The Block After it , Pointing to The Next Zero
+         * The Data Never Exceeds One Block So Every Distance Fits in a Byte & Nothing Moves */
+        for (Local_u16Index = COBS_PAYLOAD_OFFSET; Local_u16Index <= Local_u16DataSize; Local_u16Index++)
+        {
+            if (COBS_DELIMITER == Frame[Local_u16Index])
+            {
+                Frame[Local_u16CodeIndex] = (uint8_t)(Local_u16Index - Local_u16CodeIndex);
+                Local_u16CodeIndex = Local_u16Index;
+            }
+        }
+
+        /* The Last Block Points Past The Data */
+        Frame[Local_u16CodeIndex] = (uint8_t)(Local_u16DataSize + 1U - Local_u16CodeIndex);
+        Frame[Local_u16DataSize + 1U] = COBS_DELIMITER;
+
+        *FrameSize = Local_u16DataSize + 2U;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start Receiving COBS Frames on a USART Peripheral
+ * @fn     : COBS_StartReceive
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of an Already Initialized USART Peripheral
+ * @param  : PacketBuffer    => This Parameter is Used to Pass The Buffer The Frames Are Decoded inside it
+ * @param  : BufferSize      => This Parameter is Used to Pass The Size of The Buffer ( Longest Payload + COBS_CRC_SIZE )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With Each Valid Packet
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Receiver Starts Out of Sync , Everything Before The First Delimiter is Dropped
+ */
+ERRORS_t COBS_StartReceive(USART_Config_t *Config, uint8_t *PacketBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(uint8_t *Packet, uint16_t Size))
+{
+    ERRORS_t Local_u8ErrorStatus = COBS_OK;
+
+    if ((NULL == Config) || (NULL == PacketBuffer) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((BufferSize <= COBS_CRC_SIZE) || (NULL != COBS_Decoder.Config))
+    {
+        Local_u8ErrorStatus = COBS_NOK;
+    }
+    else
+    {
+        COBS_Decoder.Buffer = PacketBuffer;
+        COBS_Decoder.Size = BufferSize;
+        COBS_Decoder.CallBack = pv_CallBackFunc;
+
+        COBS_ResetDecoder();
+
+        /* Joining Mid Frame Would Deliver Garbage , Wait For a Delimiter First */
+        COBS_Decoder.Discard = 1;
+
+        if (USART_OK == USART_ReceiveStream_IT(Config, COBS_ReceiveByte))
+        {
+            COBS_Decoder.Config = Config;
+        }
+        else
+        {
+            Local_u8ErrorStatus = COBS_NOK;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop Receiving COBS Frames
+ * @fn     : COBS_StopReceive
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t COBS_StopReceive(void)
+{
+    ERRORS_t Local_u8ErrorStatus = COBS_OK;
+
+    if (NULL == COBS_Decoder.Config)
+    {
+        Local_u8ErrorStatus = COBS_NOK;
+    }
+    else
+    {
+        USART_StopReceiveStream(COBS_Decoder.Config);
+
+        COBS_Decoder.Config = NULL;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Receive Counters of The COBS Layer
+ * @fn     : COBS_GetStats
+ * @param  : Stats => This Parameter is Used to Return The Counters -> @COBS_Stats_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t COBS_GetStats(COBS_Stats_t *Stats)
+{
+    ERRORS_t Local_u8ErrorStatus = COBS_OK;
+
+    if (NULL == Stats)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        Stats->Packets = COBS_Stats.Packets;
+        Stats->CrcErrors = COBS_Stats.CrcErrors;
+        Stats->OverflowErrors = COBS_Stats.OverflowErrors;
+        Stats->FormatErrors = COBS_Stats.FormatErrors;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Decode One Received Byte , Invoked From The USART ISR
+ * @fn     : COBS_ReceiveByte
+ * @param  : Data => This Parameter is Used to Pass The Received Byte
+ * @return : void
+ */
+static void COBS_ReceiveByte(uint8_t Data)
+{
+    if (COBS_DELIMITER == Data)
+    {
+        if (COBS_Decoder.Discard || ((0U == COBS_Decoder.Length) && (0U == COBS_Decoder.Remaining)))
+        {
+            /* Overflow Already Counted , or Back to Back Delimiters Used as Padding */
+        }
+        else if ((0U != COBS_Decoder.Remaining) || (COBS_Decoder.Length <= COBS_CRC_SIZE))
+        {
+            /* Delimiter Arrived Inside a Block , or No Room For a Payload Before The CRC */
+            COBS_Stats.FormatErrors++;
+        }
+#if (COBS_CRC_ENABLE == 1U)
+        else if (0U != COBS_Decoder.Crc)
+        {
+            COBS_Stats.CrcErrors++;
+        }
+#endif
+        else
+        {
+            COBS_Stats.Packets++;
+
+            COBS_Decoder.CallBack(COBS_Decoder.Buffer, COBS_Decoder.Length - COBS_CRC_SIZE);
+        }
+
+        COBS_ResetDecoder();
+    }
+    else if (COBS_Decoder.Discard)
+    {
+        /* Wait For The Next Delimiter to Resynchronize */
+    }
+    else if (0U == COBS_Decoder.Remaining)
+    {
+        /* Code Byte , The Zero Ending The Previous Block is Only Real Once Another Block Follows */
+        if (COBS_Decoder.PendingZero)
+        {
+            COBS_StoreByte(0U);
+        }
+
+        COBS_Decoder.Remaining = Data - 1U;
+        COBS_Decoder.PendingZero = (COBS_MAX_CODE != Data);
+    }
+    else
+    {
+        COBS_StoreByte(Data);
+
+        COBS_Decoder.Remaining--;
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Store One Decoded Byte in The Packet Buffer & Update The Running CRC
+ * @fn     : COBS_StoreByte
+ * @param  : Data => This Parameter is Used to Pass The Decoded Byte
+ * @return : void
+ */
+static void COBS_StoreByte(uint8_t Data)
+{
+    if (COBS_Decoder.Length < COBS_Decoder.Size)
+    {
+        COBS_Decoder.Buffer[COBS_Decoder.Length++] = Data;
+
+#if (COBS_CRC_ENABLE == 1U)
+        COBS_Decoder.Crc = COBS_UpdateCRC(COBS_Decoder.Crc, Data);
+#endif
+    }
+    else
+    {
+        COBS_Stats.OverflowErrors++;
+
+        COBS_Decoder.Discard = 1;
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Reset The Decoder For a New Frame
+ * @fn     : COBS_ResetDecoder
+ * @return : void
+ */
+static void COBS_ResetDecoder(void)
+{
+    COBS_Decoder.Length = 0;
+    COBS_Decoder.Remaining = 0;
+    COBS_Decoder.PendingZero = 0;
+    COBS_Decoder.Discard = 0;
+    COBS_Decoder.Crc = COBS_CRC_INIT;
+}
+
+#if (COBS_CRC_ENABLE == 1U)
+/**
+ * @brief  : This Function is Used to Feed One Byte Into a CRC-16/CCITT-FALSE
+ * @fn     : COBS_UpdateCRC
+ * @param  : Crc  => This Parameter is Used to Pass The Current CRC Value
+ * @param  : Data => This Parameter is Used to Pass The Byte
+ * @return : uint16_t => The Updated CRC Value
+ */
+static uint16_t COBS_UpdateCRC(uint16_t Crc, uint8_t Data)
+{
+    Crc = (uint16_t)((Crc << 4) ^ COBS_CRCNibbleTable[(Crc >> 12) ^ (Data >> 4)]);
+    Crc = (uint16_t)((Crc << 4) ^ COBS_CRCNibbleTable[(Crc >> 12) ^ (Data & 0x0FU)]);
+
+    return Crc;
+}
+#endif
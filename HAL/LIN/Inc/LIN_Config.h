@@ -0,0 +1,26 @@
+/*
+ ******************************************************************************
+ * @file           : LIN_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : LIN Configuration Header file
+ * @Date           : Sep 14, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LIN_INC_LIN_CONFIG_H_
+#define LIN_INC_LIN_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Break Detection Length Used By Slave Nodes -> @USART_LINBreakLength_t
+ * The LIN Break is at Least 13 Bits , So 11 Bits Gives The Best Margin Against Plain 0x00 Data */
+#define LIN_BREAK_DETECTION_LENGTH USART_LIN_BREAK_11_BITS
+
+#endif /* LIN_INC_LIN_CONFIG_H_ */
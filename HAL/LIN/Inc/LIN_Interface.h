@@ -0,0 +1,155 @@
+/*
+ ******************************************************************************
+ * @file           : LIN_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : LIN Interface Header file
+ * @Date           : Sep 14, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LIN_INC_LIN_INTERFACE_H_
+#define LIN_INC_LIN_INTERFACE_H_
+
+/* ======================================================================
+ * LIN MACROS
+ * ====================================================================== */
+
+#define LIN_MAX_DATA_LENGTH 8U
+
+#define LIN_MAX_FRAME_ID 0x3FU
+
+/* ======================================================================
+ * LIN Option Enums
+ * ====================================================================== */
+
+/**
+ * @brief : This Enum Holds Values of LIN Node Types
+ * @enum  : @LIN_NodeType_t
+ */
+typedef enum
+{
+    LIN_MASTER = 0, /* Sends The Headers From The Schedule Table & Runs a Slave Task For Its Own Frames */
+    LIN_SLAVE = 1,  /* Answers Headers Only */
+
+} LIN_NodeType_t;
+
+/**
+ * @brief : This Enum Holds Values of LIN Response Direction Options Seen From This Node
+ * @enum  : @LIN_Direction_t
+ */
+typedef enum
+{
+    LIN_PUBLISH = 0,   /* This Node Sends The Response */
+    LIN_SUBSCRIBE = 1, /* This Node Receives The Response */
+
+} LIN_Direction_t;
+
+/**
+ * @brief : This Enum Holds Values of LIN Checksum Models
+ * @enum  : @LIN_ChecksumModel_t
+ * @note  : Diagnostic Frames ( 0x3C & 0x3D ) Always Use The Classic Checksum
+ */
+typedef enum
+{
+    LIN_CHECKSUM_CLASSIC = 0,  /* LIN 1.x : Data Bytes Only */
+    LIN_CHECKSUM_ENHANCED = 1, /* LIN 2.x : PID + Data Bytes */
+
+} LIN_ChecksumModel_t;
+
+/**
+ * @brief : This Enum Holds Values of LIN Frame Status
+ * @enum  : @LIN_FrameStatus_t
+ */
+typedef enum
+{
+    LIN_FRAME_IDLE = 0,           /* Never Transferred */
+    LIN_FRAME_OK = 1,             /* Last Transfer Completed Correctly */
+    LIN_FRAME_NO_RESPONSE = 2,    /* Response Missing or Cut By a New Break */
+    LIN_FRAME_CHECKSUM_ERROR = 3, /* Response Received With a Wrong Checksum , Data Was Not Updated */
+    LIN_FRAME_BIT_ERROR = 4,      /* Published Response Did Not Read Back Correctly From The Bus */
+
+} LIN_FrameStatus_t;
+
+/**
+ * @brief : This Struct Holds a Frame Known By This Node
+ * @struct: @LIN_Frame_t
+ * @note  : Frames With IDs Not Listed in The Node's Frame Table Are Ignored
+ */
+typedef struct
+{
+    uint8_t FrameId;                            /* 0 to 63 */
+    LIN_Direction_t Direction;                  /* @LIN_Direction_t */
+    uint8_t Length;                             /* 1 to 8 Data Bytes */
+    LIN_ChecksumModel_t Checksum;               /* @LIN_ChecksumModel_t */
+    uint8_t *Data;                              /* Sent From ( Publish ) or Updated ( Subscribe ) , Length Bytes */
+    void (*CallBack)(LIN_FrameStatus_t Status); /* Optional , Invoked From Interrupt Context After Every Transfer */
+    volatile LIN_FrameStatus_t Status;          /* Result of The Last Transfer */
+
+} LIN_Frame_t;
+
+/**
+ * @brief : This Struct Holds an Entry of The Master Schedule Table
+ * @struct: @LIN_ScheduleEntry_t
+ */
+typedef struct
+{
+    uint8_t FrameId;    /* Header to Be Sent in This Slot */
+    uint16_t SlotTicks; /* Slot Length in LIN_MasterTick Calls , Must Cover Header + Response + Inter Frame Space */
+
+} LIN_ScheduleEntry_t;
+
+/**
+ * @brief : This Struct Holds Values of LIN Node Configuration Options
+ * @struct: @LIN_Config_t
+ */
+typedef struct
+{
+    USART_Config_t *USARTConfig;          /* Initialized USART , 8 Data Bits , No Parity , 1 Stop Bit */
+    LIN_NodeType_t NodeType;              /* @LIN_NodeType_t */
+    LIN_Frame_t *Frames;                  /* Frame Table of This Node */
+    uint8_t FrameCount;                   /* Number of Frames in The Frame Table */
+    const LIN_ScheduleEntry_t *Schedule;  /* Master Only , NULL For Slaves */
+    uint8_t ScheduleLength;               /* Master Only , Number of Schedule Entries */
+
+} LIN_Config_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Initialize a LIN Master or Slave Node on a USART Peripheral
+ * @fn     : LIN_Init
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The Node , it Must Stay Valid While LIN is Used
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Header Reception Starts From The USART LIN Break Interrupt , No Byte is Polled , The USART IRQ Must Be Enabled in NVIC
+ */
+ERRORS_t LIN_Init(LIN_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Run The Master Schedule Table
+ * @fn     : LIN_MasterTick
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Call it From a Periodic Timer Interrupt With The Same Priority as The USART Interrupt ( e.g. Every 1 ms )
+ *           At The Start of Each Slot The Previous Frame is Closed ( NO_RESPONSE if Still Pending ) & The Next Header is Sent
+ */
+ERRORS_t LIN_MasterTick(void);
+
+/**
+ * @brief  : This Function is Used to Calculate The Protected Identifier of a Frame ID
+ * @fn     : LIN_GetPID
+ * @param  : FrameId => This Parameter is Used to Pass The Frame ID ( 0 to 63 )
+ * @return : uint8_t => Frame ID With The Two Parity Bits ( P0 Bit 6 , P1 Bit 7 )
+ */
+uint8_t LIN_GetPID(uint8_t FrameId);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* LIN_INC_LIN_INTERFACE_H_ */
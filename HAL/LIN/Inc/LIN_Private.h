@@ -0,0 +1,97 @@
+/*
+ ******************************************************************************
+ * @file           : LIN_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : LIN Private Header file
+ * @Date           : Sep 14, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LIN_INC_LIN_PRIVATE_H_
+#define LIN_INC_LIN_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+#define LIN_SYNC_BYTE 0x55U
+
+/* Frame IDs That Always Use The Classic Checksum ( Master Request & Slave Response ) */
+#define LIN_DIAGNOSTIC_ID_FIRST 0x3CU
+
+#define LIN_FRAME_NOT_FOUND 0xFFU
+
+#define LIN_PID_P0 6U
+#define LIN_PID_P1 7U
+
+/* ======================================================================
+ * PRIVATE ENUMS
+ * ====================================================================== */
+
+/**
+ * @brief : This Enum Holds The State of The LIN Response Engine
+ */
+typedef enum
+{
+    LIN_STATE_IDLE = 0,        /* Waiting For a Break */
+    LIN_STATE_HEADER = 1,      /* Receiving Sync & PID */
+    LIN_STATE_RESPONSE_RX = 2, /* Receiving a Subscribed Response */
+    LIN_STATE_RESPONSE_TX = 3, /* Sending a Published Response & Reading Back The Echo */
+
+} LIN_State_t;
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Find a Frame in The Frame Table of The Node
+ * @fn     : LIN_FindFrame
+ * @param  : FrameId => This Parameter is Used to Pass The Frame ID to Look For
+ * @return : uint8_t => Index in The Frame Table or LIN_FRAME_NOT_FOUND
+ */
+static uint8_t LIN_FindFrame(uint8_t FrameId);
+
+/**
+ * @brief  : This Function is Used to Calculate The Checksum of a Response
+ * @fn     : LIN_CalculateChecksum
+ * @param  : Frame => This Parameter is Used to Pass The Frame Descriptor ( For The Checksum Model & ID )
+ * @param  : Data  => This Parameter is Used to Pass The Data Bytes
+ * @return : uint8_t => Inverted Eight Bit Sum With Carry
+ */
+static uint8_t LIN_CalculateChecksum(const LIN_Frame_t *Frame, const uint8_t *Data);
+
+/**
+ * @brief  : This Function is Used to Close The Current Frame With a Status & Invoke Its CallBack
+ * @fn     : LIN_CompleteFrame
+ * @param  : Status => This Parameter is Used to Pass The Frame Result -> @LIN_FrameStatus_t
+ * @return : void
+ */
+static void LIN_CompleteFrame(LIN_FrameStatus_t Status);
+
+/**
+ * @brief  : USART LIN Break CallBack , Starts Header Reception
+ */
+static void LIN_BreakDetected(void);
+
+/**
+ * @brief  : USART Receive CallBack , Checks Sync & PID Then Starts The Response
+ */
+static void LIN_HeaderReceived(void);
+
+/**
+ * @brief  : USART Receive CallBack , Checks The Checksum of a Subscribed Response
+ */
+static void LIN_ResponseReceived(void);
+
+/**
+ * @brief  : USART Receive CallBack , Compares a Published Response With Its Echo on The Bus
+ */
+static void LIN_ResponseEchoReceived(void);
+
+#endif /* LIN_INC_LIN_PRIVATE_H_ */
@@ -0,0 +1,399 @@
+/*
+ ******************************************************************************
+ * @file           : LIN_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 14, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../Inc/LIN_Interface.h"
+#include "../Inc/LIN_Config.h"
+#include "../Inc/LIN_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION START
+ *==============================================================================================================================================*/
+
+static LIN_Config_t *LIN_NodeConfig = NULL;
+
+static volatile LIN_State_t LIN_State = LIN_STATE_IDLE;
+
+/* Index of The Frame Being Transferred in The Frame Table */
+static uint8_t LIN_CurrentFrame = LIN_FRAME_NOT_FOUND;
+
+/* Received Sync & PID */
+static uint8_t LIN_Header[2];
+
+/* Sync & PID Sent By The Master */
+static uint8_t LIN_TxHeader[2];
+
+/* Published Response ( Data + Checksum ) */
+static uint8_t LIN_TxResponse[LIN_MAX_DATA_LENGTH + 1U];
+
+/* Subscribed Response or Echo of a Published One */
+static uint8_t LIN_RxResponse[LIN_MAX_DATA_LENGTH + 1U];
+
+static uint8_t LIN_ScheduleIndex = 0;
+
+static uint16_t LIN_SlotCounter = 0;
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Initialize a LIN Master or Slave Node on a USART Peripheral
+ * @fn     : LIN_Init
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The Node , it Must Stay Valid While LIN is Used
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t LIN_Init(LIN_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = LIN_OK;
+
+    uint8_t Local_u8Counter = 0;
+
+    if ((NULL == Config) || (NULL == Config->USARTConfig) || (NULL == Config->Frames && 0U != Config->FrameCount))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (Config->NodeType < LIN_MASTER || Config->NodeType > LIN_SLAVE ||
+             (LIN_MASTER == Config->NodeType && (NULL == Config->Schedule || 0U == Config->ScheduleLength)))
+    {
+        Local_u8ErrorStatus = LIN_NOK;
+    }
+    else
+    {
+        /* Check The Frame Table */
+        for (Local_u8Counter = 0; (Local_u8Counter < Config->FrameCount) && (LIN_OK == Local_u8ErrorStatus); Local_u8Counter++)
+        {
+            if (Config->Frames[Local_u8Counter].FrameId > LIN_MAX_FRAME_ID ||
+                0U == Config->Frames[Local_u8Counter].Length || Config->Frames[Local_u8Counter].Length > LIN_MAX_DATA_LENGTH ||
+                NULL == Config->Frames[Local_u8Counter].Data)
+            {
+                Local_u8ErrorStatus = LIN_NOK;
+            }
+            else
+            {
+                Config->Frames[Local_u8Counter].Status = LIN_FRAME_IDLE;
+            }
+        }
+
+        /* Check The Schedule Table */
+        for (Local_u8Counter = 0; (LIN_MASTER == Config->NodeType) && (Local_u8Counter < Config->ScheduleLength) && (LIN_OK == Local_u8ErrorStatus); Local_u8Counter++)
+        {
+            if (Config->Schedule[Local_u8Counter].FrameId > LIN_MAX_FRAME_ID || 0U == Config->Schedule[Local_u8Counter].SlotTicks)
+            {
+                Local_u8ErrorStatus = LIN_NOK;
+            }
+        }
+
+        if (LIN_OK == Local_u8ErrorStatus)
+        {
+            LIN_NodeConfig = Config;
+            LIN_State = LIN_STATE_IDLE;
+            LIN_CurrentFrame = LIN_FRAME_NOT_FOUND;
+            LIN_ScheduleIndex = 0;
+            LIN_SlotCounter = 0;
+
+            if ((USART_OK != USART_SetCallBack(Config->USARTConfig->USART_Number, USART_IT_LBD, LIN_BreakDetected)) ||
+                (USART_OK != USART_EnableLINMode(Config->USARTConfig, LIN_BREAK_DETECTION_LENGTH)))
+            {
+                Local_u8ErrorStatus = LIN_NOK;
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Run The Master Schedule Table
+ * @fn     : LIN_MasterTick
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Call it From a Periodic Timer Interrupt With The Same Priority as The USART Interrupt ( e.g. Every 1 ms )
+ */
+ERRORS_t LIN_MasterTick(void)
+{
+    ERRORS_t Local_u8ErrorStatus = LIN_OK;
+
+    uint16_t Local_u16Written = 0;
+
+    const LIN_ScheduleEntry_t *Local_Entry = NULL;
+
+    if ((NULL == LIN_NodeConfig) || (LIN_MASTER != LIN_NodeConfig->NodeType))
+    {
+        Local_u8ErrorStatus = LIN_NOK;
+    }
+    else
+    {
+        if (LIN_SlotCounter > 0U)
+        {
+            LIN_SlotCounter--;
+        }
+
+        if (0U == LIN_SlotCounter)
+        {
+            if (LIN_STATE_IDLE != LIN_State)
+            {
+                /* The Slot is Over & The Frame is Still Open , Nobody Answered */
+                USART_AbortReceive_IT(LIN_NodeConfig->USARTConfig->USART_Number);
+
+                LIN_CompleteFrame(LIN_FRAME_NO_RESPONSE);
+            }
+
+            Local_Entry = &LIN_NodeConfig->Schedule[LIN_ScheduleIndex];
+
+            LIN_ScheduleIndex++;
+            if (LIN_ScheduleIndex >= LIN_NodeConfig->ScheduleLength)
+            {
+                LIN_ScheduleIndex = 0;
+            }
+
+            LIN_SlotCounter = Local_Entry->SlotTicks;
+
+            /* Header : Break , Sync , PID , The Master's Own Break Interrupt Then Runs The Response Like Any Slave */
+            LIN_TxHeader[0] = LIN_SYNC_BYTE;
+            LIN_TxHeader[1] = LIN_GetPID(Local_Entry->FrameId);
+
+            USART_SendBreak(LIN_NodeConfig->USARTConfig->USART_Number);
+
+            if (USART_OK != USART_Write(LIN_NodeConfig->USARTConfig, LIN_TxHeader, 2U, &Local_u16Written) || 2U != Local_u16Written)
+            {
+                Local_u8ErrorStatus = LIN_NOK;
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Calculate The Protected Identifier of a Frame ID
+ * @fn     : LIN_GetPID
+ * @param  : FrameId => This Parameter is Used to Pass The Frame ID ( 0 to 63 )
+ * @return : uint8_t => Frame ID With The Two Parity Bits ( P0 Bit 6 , P1 Bit 7 )
+ */
+uint8_t LIN_GetPID(uint8_t FrameId)
+{
+    uint8_t Local_u8Id = FrameId & LIN_MAX_FRAME_ID;
+    uint8_t Local_u8P0 = 0;
+    uint8_t Local_u8P1 = 0;
+
+    /* P0 = ID0 ^ ID1 ^ ID2 ^ ID4 */
+    Local_u8P0 = ((Local_u8Id >> 0) ^ (Local_u8Id >> 1) ^ (Local_u8Id >> 2) ^ (Local_u8Id >> 4)) & 1U;
+
+    /* P1 = NOT ( ID1 ^ ID3 ^ ID4 ^ ID5 ) */
+    Local_u8P1 = (~((Local_u8Id >> 1) ^ (Local_u8Id >> 3) ^ (Local_u8Id >> 4) ^ (Local_u8Id >> 5))) & 1U;
+
+    return (uint8_t)(Local_u8Id | (Local_u8P0 << LIN_PID_P0) | (Local_u8P1 << LIN_PID_P1));
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Find a Frame in The Frame Table of The Node
+ * @fn     : LIN_FindFrame
+ * @param  : FrameId => This Parameter is Used to Pass The Frame ID to Look For
+ * @return : uint8_t => Index in The Frame Table or LIN_FRAME_NOT_FOUND
+ */
+static uint8_t LIN_FindFrame(uint8_t FrameId)
+{
+    uint8_t Local_u8Index = 0;
+
+    while ((Local_u8Index < LIN_NodeConfig->FrameCount) && (LIN_NodeConfig->Frames[Local_u8Index].FrameId != FrameId))
+    {
+        Local_u8Index++;
+    }
+
+    return (Local_u8Index < LIN_NodeConfig->FrameCount) ? Local_u8Index : LIN_FRAME_NOT_FOUND;
+}
+
+/**
+ * @brief  : This Function is Used to Calculate The Checksum of a Response
+ * @fn     : LIN_CalculateChecksum
+ * @param  : Frame => This Parameter is Used to Pass The Frame Descriptor ( For The Checksum Model & ID )
+ * @param  : Data  => This Parameter is Used to Pass The Data Bytes
+ * @return : uint8_t => Inverted Eight Bit Sum With Carry
+ */
+static uint8_t LIN_CalculateChecksum(const LIN_Frame_t *Frame, const uint8_t *Data)
+{
+    uint16_t Local_u16Sum = 0;
+    uint8_t Local_u8Counter = 0;
+
+    if (LIN_CHECKSUM_ENHANCED == Frame->Checksum && Frame->FrameId < LIN_DIAGNOSTIC_ID_FIRST)
+    {
+        Local_u16Sum = LIN_GetPID(Frame->FrameId);
+    }
+
+    for (Local_u8Counter = 0; Local_u8Counter < Frame->Length; Local_u8Counter++)
+    {
+        Local_u16Sum += Data[Local_u8Counter];
+
+        /* Add The Carry Back in */
+        if (Local_u16Sum > 0xFFU)
+        {
+            Local_u16Sum -= 0xFFU;
+        }
+    }
+
+    return (uint8_t)(~Local_u16Sum);
+}
+
+/**
+ * @brief  : This Function is Used to Close The Current Frame With a Status & Invoke Its CallBack
+ * @fn     : LIN_CompleteFrame
+ * @param  : Status => This Parameter is Used to Pass The Frame Result -> @LIN_FrameStatus_t
+ * @return : void
+ */
+static void LIN_CompleteFrame(LIN_FrameStatus_t Status)
+{
+    LIN_Frame_t *Local_Frame = NULL;
+
+    LIN_State = LIN_STATE_IDLE;
+
+    if (LIN_FRAME_NOT_FOUND != LIN_CurrentFrame)
+    {
+        Local_Frame = &LIN_NodeConfig->Frames[LIN_CurrentFrame];
+        LIN_CurrentFrame = LIN_FRAME_NOT_FOUND;
+
+        Local_Frame->Status = Status;
+
+        if (NULL != Local_Frame->CallBack)
+        {
+            Local_Frame->CallBack(Status);
+        }
+    }
+}
+
+/**
+ * @brief  : USART LIN Break CallBack , Starts Header Reception
+ */
+static void LIN_BreakDetected(void)
+{
+    if (LIN_STATE_IDLE != LIN_State)
+    {
+        /* A New Break Cuts Whatever Was Going on */
+        USART_AbortReceive_IT(LIN_NodeConfig->USARTConfig->USART_Number);
+
+        LIN_CompleteFrame(LIN_FRAME_NO_RESPONSE);
+    }
+
+    LIN_State = LIN_STATE_HEADER;
+
+    if (USART_OK != USART_ReceiveBuffer_IT(LIN_NodeConfig->USARTConfig, LIN_Header, 2U, LIN_HeaderReceived))
+    {
+        LIN_State = LIN_STATE_IDLE;
+    }
+}
+
+/**
+ * @brief  : USART Receive CallBack , Checks Sync & PID Then Starts The Response
+ */
+static void LIN_HeaderReceived(void)
+{
+    uint8_t Local_u8FrameId = LIN_Header[1] & LIN_MAX_FRAME_ID;
+    uint8_t Local_u8Index = LIN_FRAME_NOT_FOUND;
+    uint8_t Local_u8Counter = 0;
+    uint16_t Local_u16Written = 0;
+
+    LIN_Frame_t *Local_Frame = NULL;
+
+    LIN_State = LIN_STATE_IDLE;
+
+    if ((LIN_SYNC_BYTE == LIN_Header[0]) && (LIN_GetPID(Local_u8FrameId) == LIN_Header[1]))
+    {
+        Local_u8Index = LIN_FindFrame(Local_u8FrameId);
+    }
+
+    if (LIN_FRAME_NOT_FOUND != Local_u8Index)
+    {
+        Local_Frame = &LIN_NodeConfig->Frames[Local_u8Index];
+        LIN_CurrentFrame = Local_u8Index;
+
+        if (LIN_PUBLISH == Local_Frame->Direction)
+        {
+            for (Local_u8Counter = 0; Local_u8Counter < Local_Frame->Length; Local_u8Counter++)
+            {
+                LIN_TxResponse[Local_u8Counter] = Local_Frame->Data[Local_u8Counter];
+            }
+            LIN_TxResponse[Local_Frame->Length] = LIN_CalculateChecksum(Local_Frame, LIN_TxResponse);
+
+            /* Arm The Echo Reception Before The First Byte Leaves */
+            LIN_State = LIN_STATE_RESPONSE_TX;
+
+            USART_ReceiveBuffer_IT(LIN_NodeConfig->USARTConfig, LIN_RxResponse, Local_Frame->Length + 1U, LIN_ResponseEchoReceived);
+            USART_Write(LIN_NodeConfig->USARTConfig, LIN_TxResponse, Local_Frame->Length + 1U, &Local_u16Written);
+        }
+        else
+        {
+            LIN_State = LIN_STATE_RESPONSE_RX;
+
+            USART_ReceiveBuffer_IT(LIN_NodeConfig->USARTConfig, LIN_RxResponse, Local_Frame->Length + 1U, LIN_ResponseReceived);
+        }
+    }
+}
+
+/**
+ * @brief  : USART Receive CallBack , Checks The Checksum of a Subscribed Response
+ */
+static void LIN_ResponseReceived(void)
+{
+    LIN_Frame_t *Local_Frame = &LIN_NodeConfig->Frames[LIN_CurrentFrame];
+    uint8_t Local_u8Counter = 0;
+
+    if (LIN_CalculateChecksum(Local_Frame, LIN_RxResponse) == LIN_RxResponse[Local_Frame->Length])
+    {
+        for (Local_u8Counter = 0; Local_u8Counter < Local_Frame->Length; Local_u8Counter++)
+        {
+            Local_Frame->Data[Local_u8Counter] = LIN_RxResponse[Local_u8Counter];
+        }
+        LIN_CompleteFrame(LIN_FRAME_OK);
+    }
+    else
+    {
+        LIN_CompleteFrame(LIN_FRAME_CHECKSUM_ERROR);
+    }
+}
+
+/**
+ * @brief  : USART Receive CallBack , Compares a Published Response With Its Echo on The Bus
+ */
+static void LIN_ResponseEchoReceived(void)
+{
+    LIN_Frame_t *Local_Frame = &LIN_NodeConfig->Frames[LIN_CurrentFrame];
+    uint8_t Local_u8Counter = 0;
+
+    while ((Local_u8Counter <= Local_Frame->Length) && (LIN_TxResponse[Local_u8Counter] == LIN_RxResponse[Local_u8Counter]))
+    {
+        Local_u8Counter++;
+    }
+
+    LIN_CompleteFrame((Local_u8Counter > Local_Frame->Length) ? LIN_FRAME_OK : LIN_FRAME_BIT_ERROR);
+}
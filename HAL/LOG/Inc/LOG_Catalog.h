@@ -0,0 +1,56 @@
+/*
+ ******************************************************************************
+ * @file           : LOG_Catalog.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Log Message Catalog
+ * @Date           : Sep 12, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOG_INC_LOG_CATALOG_H_
+#define LOG_INC_LOG_CATALOG_H_
+
+/* ======================================================================
+ * MESSAGE CATALOG
+ * ====================================================================== */
+
+/**
+ * @brief : Every Log Message is Listed Here Once as X( ID , "Format" )
+ * @note  : Only The ID & The Raw Arguments Are Sent on The Line , The Format Strings Never Reach The Target's Flash ,
+ *          They Are Used By The Host Decoder ( Tools/LOG_Decoder ) Which Includes This Same File
+ *          Arguments Are 32 Bits Each , So Use Only %u , %d , %x , %X , %c Conversions ( Up to LOG_MAX_ARGS )
+ *          Append New Messages at The End So Old Captures Keep Decoding , Maximum 4096 Messages
+ */
+#define LOG_CATALOG(X)                                                  \
+    X(LOG_ID_BOOT, "Boot , SYSCLK = %u Hz")                             \
+    X(LOG_ID_ASSERT, "Assert Failed , Module %u Line %u")               \
+    X(LOG_ID_USART_LINE_ERRORS, "USART%u Errors PE %u FE %u NE %u")     \
+    X(LOG_ID_USART_OVERRUN, "USART%u Overrun , Total %u")               \
+    X(LOG_ID_DMA_TRANSFER_ERROR, "DMA1 Channel %u Transfer Error")      \
+    X(LOG_ID_VALUE, "Value %u = 0x%08X")
+
+/* ======================================================================
+ * MESSAGE IDS
+ * ====================================================================== */
+
+#define LOG_CATALOG_ENUM(ID, FORMAT) ID,
+
+/**
+ * @brief : This Enum Holds The IDs of All Log Messages , Generated From LOG_CATALOG
+ * @enum  : @LOG_ID_t
+ */
+typedef enum
+{
+    LOG_CATALOG(LOG_CATALOG_ENUM)
+    LOG_ID_NUM,
+
+} LOG_ID_t;
+
+#undef LOG_CATALOG_ENUM
+
+#endif /* LOG_INC_LOG_CATALOG_H_ */
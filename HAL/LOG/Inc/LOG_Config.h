@@ -0,0 +1,29 @@
+/*
+ ******************************************************************************
+ * @file           : LOG_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : LOG Configuration Header file
+ * @Date           : Sep 12, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOG_INC_LOG_CONFIG_H_
+#define LOG_INC_LOG_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Size of The Log Ring in 32 Bits Words , Must Be a Power of Two
+ * A Record Takes ( 1 + Number of Arguments ) Words */
+#define LOG_RING_SIZE_WORDS 256U
+
+/* Maximum Bytes Handed to USART_Write in One LOG_Process Call , Bounds The Time Spent in The Main Loop */
+#define LOG_PROCESS_CHUNK 64U
+
+#endif /* LOG_INC_LOG_CONFIG_H_ */
@@ -0,0 +1,80 @@
+/*
+ ******************************************************************************
+ * @file           : LOG_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : LOG Interface Header file
+ * @Date           : Sep 12, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOG_INC_LOG_INTERFACE_H_
+#define LOG_INC_LOG_INTERFACE_H_
+
+#include "LOG_Catalog.h"
+
+/* ======================================================================
+ * LOG MACROS
+ * ====================================================================== */
+
+/* Maximum Number of 32 Bits Arguments in a Single Record */
+#define LOG_MAX_ARGS 4U
+
+/* Record a Message With 0 to 4 Arguments , Usable From Thread & Interrupt Context */
+#define LOG_0(ID) LOG_Record((ID), 0U, 0U, 0U, 0U, 0U)
+#define LOG_1(ID, A0) LOG_Record((ID), 1U, (uint32_t)(A0), 0U, 0U, 0U)
+#define LOG_2(ID, A0, A1) LOG_Record((ID), 2U, (uint32_t)(A0), (uint32_t)(A1), 0U, 0U)
+#define LOG_3(ID, A0, A1, A2) LOG_Record((ID), 3U, (uint32_t)(A0), (uint32_t)(A1), (uint32_t)(A2), 0U)
+#define LOG_4(ID, A0, A1, A2, A3) LOG_Record((ID), 4U, (uint32_t)(A0), (uint32_t)(A1), (uint32_t)(A2), (uint32_t)(A3))
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Initialize The Deferred Logger & Select The USART Peripheral It Drains to
+ * @fn     : LOG_Init
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of an Already Initialized USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Records Are Sent Through USART_Write , So The USART Interrupt Must Be Enabled in NVIC
+ */
+ERRORS_t LOG_Init(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Store a Log Record ( Message ID + Raw Arguments ) in The Log Ring
+ * @fn     : LOG_Record
+ * @param  : Id       => This Parameter is Used to Pass The Message ID -> @LOG_ID_t
+ * @param  : ArgCount => This Parameter is Used to Pass The Number of Valid Arguments ( 0 to LOG_MAX_ARGS )
+ * @param  : Arg0 .. Arg3 => These Parameters Are Used to Pass The Raw Arguments , Unused Ones Are Ignored
+ * @return : ERRORS_t => LOG_BUFFER_FULL if The Record Was Dropped Because The Ring is Full
+ * @note   : No Formatting is Done on The Target , The Record is Copied With Interrupts Masked ( PRIMASK ) So It is Safe From Any ISR
+ *           Use The LOG_0 .. LOG_4 Macros Instead of Calling it Directly
+ */
+ERRORS_t LOG_Record(LOG_ID_t Id, uint32_t ArgCount, uint32_t Arg0, uint32_t Arg1, uint32_t Arg2, uint32_t Arg3);
+
+/**
+ * @brief  : This Function is Used to Move Pending Log Bytes From The Log Ring to The USART Transmit Queue
+ * @fn     : LOG_Process
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Must Be Called Periodically From The Main Loop ( Not From an ISR ) , At Most LOG_PROCESS_CHUNK Bytes Are Moved Per Call
+ */
+ERRORS_t LOG_Process(void);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Records Dropped Because The Log Ring Was Full
+ * @fn     : LOG_GetDroppedRecords
+ * @param  : Dropped => This Parameter is Used to Return The Number of Dropped Records
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Drops Also Show on The Host as Gaps in The Record Sequence Number
+ */
+ERRORS_t LOG_GetDroppedRecords(uint32_t *Dropped);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* LOG_INC_LOG_INTERFACE_H_ */
@@ -0,0 +1,80 @@
+/*
+ ******************************************************************************
+ * @file           : LOG_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : LOG Private Header file
+ * @Date           : Sep 12, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef LOG_INC_LOG_PRIVATE_H_
+#define LOG_INC_LOG_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+#define LOG_RING_MASK (LOG_RING_SIZE_WORDS - 1U)
+
+#define LOG_RING_SIZE_BYTES (LOG_RING_SIZE_WORDS * 4U)
+
+#define LOG_RING_BYTES_MASK (LOG_RING_SIZE_BYTES - 1U)
+
+#if ((LOG_RING_SIZE_WORDS & LOG_RING_MASK) != 0U) || (LOG_RING_SIZE_WORDS < 8U) || (LOG_RING_SIZE_WORDS > 16384U)
+#error "LOG_RING_SIZE_WORDS Must Be a Power of Two Between 8 & 16384"
+#endif
+
+/* Record Header Word , Sent Little Endian So The Sync Byte Goes First on The Line
+ *  Bits  0 ..  7 : Sync ( 0xA5 )
+ *  Bits  8 .. 15 : Sequence Number ( Increments For Every Record , Dropped Ones Included )
+ *  Bits 16 .. 27 : Message ID
+ *  Bits 28 .. 31 : Number of Argument Words That Follow */
+#define LOG_SYNC_BYTE 0xA5UL
+#define LOG_HEADER_SEQ_SHIFT 8U
+#define LOG_HEADER_ID_SHIFT 16U
+#define LOG_HEADER_ID_MASK 0x0FFFUL
+#define LOG_HEADER_ARGC_SHIFT 28U
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Mask All Configurable Interrupts & Return The Previous PRIMASK
+ * @fn     : LOG_EnterCritical
+ * @return : uint32_t => Previous PRIMASK Value to Be Passed to LOG_ExitCritical
+ * @note   : Restoring The Saved Value Keeps Nested Calls ( From an ISR or With Interrupts Already Masked ) Correct
+ */
+static inline uint32_t LOG_EnterCritical(void)
+{
+    uint32_t Local_u32PriMask;
+
+    __asm volatile("MRS %0, PRIMASK \n"
+                   "CPSID i"
+                   : "=r"(Local_u32PriMask)
+                   :
+                   : "memory");
+
+    return Local_u32PriMask;
+}
+
+/**
+ * @brief  : This Function is Used to Restore PRIMASK Saved By LOG_EnterCritical
+ * @fn     : LOG_ExitCritical
+ * @param  : PriMask => This Parameter is Used to Pass The Value Returned By LOG_EnterCritical
+ * @return : void
+ */
+static inline void LOG_ExitCritical(uint32_t PriMask)
+{
+    __asm volatile("MSR PRIMASK, %0"
+                   :
+                   : "r"(PriMask)
+                   : "memory");
+}
+
+#endif /* LOG_INC_LOG_PRIVATE_H_ */
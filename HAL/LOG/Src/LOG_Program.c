@@ -0,0 +1,226 @@
+/*
+ ******************************************************************************
+ * @file           : LOG_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 12, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../Inc/LOG_Interface.h"
+#include "../Inc/LOG_Config.h"
+#include "../Inc/LOG_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION START
+ *==============================================================================================================================================*/
+
+/* Records Are Whole Words , The Ring is Sent Byte By Byte Straight From This Array */
+static uint32_t LOG_Ring[LOG_RING_SIZE_WORDS];
+
+/* Next Free Word , Written By LOG_Record Only ( With Interrupts Masked ) */
+static volatile uint16_t LOG_Head = 0;
+
+/* Next Byte to Be Sent , Written By LOG_Process Only , Kept in Bytes as USART_Write May Accept Part of a Word */
+static volatile uint16_t LOG_Tail = 0;
+
+static uint8_t LOG_Sequence = 0;
+
+static volatile uint32_t LOG_Dropped = 0;
+
+static USART_Config_t *LOG_USARTConfig = NULL;
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Initialize The Deferred Logger & Select The USART Peripheral It Drains to
+ * @fn     : LOG_Init
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of an Already Initialized USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t LOG_Init(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = LOG_OK;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        LOG_USARTConfig = Config;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Store a Log Record ( Message ID + Raw Arguments ) in The Log Ring
+ * @fn     : LOG_Record
+ * @param  : Id       => This Parameter is Used to Pass The Message ID -> @LOG_ID_t
+ * @param  : ArgCount => This Parameter is Used to Pass The Number of Valid Arguments ( 0 to LOG_MAX_ARGS )
+ * @param  : Arg0 .. Arg3 => These Parameters Are Used to Pass The Raw Arguments , Unused Ones Are Ignored
+ * @return : ERRORS_t => LOG_BUFFER_FULL if The Record Was Dropped Because The Ring is Full
+ */
+ERRORS_t LOG_Record(LOG_ID_t Id, uint32_t ArgCount, uint32_t Arg0, uint32_t Arg1, uint32_t Arg2, uint32_t Arg3)
+{
+    ERRORS_t Local_u8ErrorStatus = LOG_OK;
+
+    uint32_t Local_u32PriMask = 0;
+    uint16_t Local_u16Head = 0;
+    uint16_t Local_u16Free = 0;
+
+    if (ArgCount > LOG_MAX_ARGS || (uint32_t)Id >= (uint32_t)LOG_ID_NUM)
+    {
+        Local_u8ErrorStatus = LOG_NOK;
+    }
+    else
+    {
+        Local_u32PriMask = LOG_EnterCritical();
+
+        Local_u16Head = LOG_Head;
+
+        /* The Word Being Sent ( Tail / 4 ) is Protected Too , One Word is Always Kept Empty */
+        Local_u16Free = ((LOG_Tail >> 2) - Local_u16Head - 1U) & LOG_RING_MASK;
+
+        if (Local_u16Free < (ArgCount + 1U))
+        {
+            /* The Sequence Number Still Advances So The Host Sees The Gap */
+            LOG_Sequence++;
+            LOG_Dropped++;
+
+            Local_u8ErrorStatus = LOG_BUFFER_FULL;
+        }
+        else
+        {
+            LOG_Ring[Local_u16Head] = LOG_SYNC_BYTE |
+                                      ((uint32_t)LOG_Sequence++ << LOG_HEADER_SEQ_SHIFT) |
+                                      (((uint32_t)Id & LOG_HEADER_ID_MASK) << LOG_HEADER_ID_SHIFT) |
+                                      (ArgCount << LOG_HEADER_ARGC_SHIFT);
+            Local_u16Head = (Local_u16Head + 1U) & LOG_RING_MASK;
+
+            /* Unrolled , Each Argument Costs a Store & an Index Update */
+            if (ArgCount > 0U)
+            {
+                LOG_Ring[Local_u16Head] = Arg0;
+                Local_u16Head = (Local_u16Head + 1U) & LOG_RING_MASK;
+            }
+            if (ArgCount > 1U)
+            {
+                LOG_Ring[Local_u16Head] = Arg1;
+                Local_u16Head = (Local_u16Head + 1U) & LOG_RING_MASK;
+            }
+            if (ArgCount > 2U)
+            {
+                LOG_Ring[Local_u16Head] = Arg2;
+                Local_u16Head = (Local_u16Head + 1U) & LOG_RING_MASK;
+            }
+            if (ArgCount > 3U)
+            {
+                LOG_Ring[Local_u16Head] = Arg3;
+                Local_u16Head = (Local_u16Head + 1U) & LOG_RING_MASK;
+            }
+
+            /* Publish The Whole Record at Once */
+            LOG_Head = Local_u16Head;
+        }
+
+        LOG_ExitCritical(Local_u32PriMask);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Move Pending Log Bytes From The Log Ring to The USART Transmit Queue
+ * @fn     : LOG_Process
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Must Be Called Periodically From The Main Loop ( Not From an ISR ) , At Most LOG_PROCESS_CHUNK Bytes Are Moved Per Call
+ */
+ERRORS_t LOG_Process(void)
+{
+    ERRORS_t Local_u8ErrorStatus = LOG_OK;
+
+    uint16_t Local_u16Head = 0;
+    uint16_t Local_u16Tail = 0;
+    uint16_t Local_u16Length = 0;
+    uint16_t Local_u16Written = 0;
+
+    if (NULL == LOG_USARTConfig)
+    {
+        Local_u8ErrorStatus = LOG_NOK;
+    }
+    else
+    {
+        Local_u16Head = (uint16_t)(LOG_Head << 2);
+        Local_u16Tail = LOG_Tail;
+
+        if (Local_u16Head != Local_u16Tail)
+        {
+            /* Contiguous Part Only , The Wrapped Part Goes on The Next Call */
+            Local_u16Length = (Local_u16Head > Local_u16Tail) ? (uint16_t)(Local_u16Head - Local_u16Tail) : (uint16_t)(LOG_RING_SIZE_BYTES - Local_u16Tail);
+
+            if (Local_u16Length > LOG_PROCESS_CHUNK)
+            {
+                Local_u16Length = LOG_PROCESS_CHUNK;
+            }
+
+            if (USART_OK == USART_Write(LOG_USARTConfig, ((const uint8_t *)LOG_Ring) + Local_u16Tail, Local_u16Length, &Local_u16Written))
+            {
+                LOG_Tail = (Local_u16Tail + Local_u16Written) & LOG_RING_BYTES_MASK;
+            }
+            else
+            {
+                /* Transmitter is Used By Another Transfer , Retry on The Next Call */
+                Local_u8ErrorStatus = LOG_NOK;
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Number of Records Dropped Because The Log Ring Was Full
+ * @fn     : LOG_GetDroppedRecords
+ * @param  : Dropped => This Parameter is Used to Return The Number of Dropped Records
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t LOG_GetDroppedRecords(uint32_t *Dropped)
+{
+    ERRORS_t Local_u8ErrorStatus = LOG_OK;
+
+    if (NULL == Dropped)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        *Dropped = LOG_Dropped;
+    }
+    return Local_u8ErrorStatus;
+}
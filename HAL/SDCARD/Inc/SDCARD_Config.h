@@ -0,0 +1,38 @@
+/*
+ ******************************************************************************
+ * @file           : SDCARD_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SDCARD Configuration Header file
+ * @Date           : Sep 25, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SDCARD_INC_SDCARD_CONFIG_H_
+#define SDCARD_INC_SDCARD_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Clock Used Until The Card is Initialized , Must Be 400 KHz or Less -> @SPI_BAUDRATE_t
+ * fPCLK / 256 Gives 281 KHz on SPI1 ( PCLK2 = 72 MHz ) & 140 KHz on SPI2 ( PCLK1 = 36 MHz ) */
+#define SDCARD_INIT_BAUDRATE SPI_PERIPH_CLK_BY256
+
+/* CMD0 Attempts Before The Card is Reported as SDCARD_NOT_FOUND */
+#define SDCARD_CMD0_RETRIES 10U
+
+/* ACMD41 Attempts While The Card Leaves The Idle State , The Card May Take Up to 1 s */
+#define SDCARD_INIT_RETRIES 2000U
+
+/* Bytes Read While Waiting For a Data Token ( Read Access Time , Up to 100 ms ) */
+#define SDCARD_TOKEN_POLL_LIMIT 200000UL
+
+/* Bytes Read While Waiting For The Card to Release Busy ( Write Time , Up to 500 ms ) */
+#define SDCARD_BUSY_POLL_LIMIT 1000000UL
+
+#endif /* SDCARD_INC_SDCARD_CONFIG_H_ */
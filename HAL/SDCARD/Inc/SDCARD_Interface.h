@@ -0,0 +1,116 @@
+/*
+ ******************************************************************************
+ * @file           : SDCARD_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SDCARD Interface Header file
+ * @Date           : Sep 25, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SDCARD_INC_SDCARD_INTERFACE_H_
+#define SDCARD_INC_SDCARD_INTERFACE_H_
+
+/* ======================================================================
+ * SDCARD MACROS
+ * ====================================================================== */
+
+#define SDCARD_BLOCK_SIZE 512U
+
+/* ======================================================================
+ * SDCARD Option Enums
+ * ====================================================================== */
+
+/**
+ * @brief : This Enum Holds Values of The Detected Card Types
+ * @enum  : @SDCARD_Type_t
+ */
+typedef enum
+{
+    SDCARD_TYPE_NONE = 0, /* Not Initialized */
+    SDCARD_TYPE_SDV1 = 1, /* SD Version 1.x , Byte Addressed */
+    SDCARD_TYPE_SDV2 = 2, /* SD Version 2.0 Standard Capacity , Byte Addressed */
+    SDCARD_TYPE_SDHC = 3, /* SDHC / SDXC , Block Addressed */
+
+} SDCARD_Type_t;
+
+/* ======================================================================
+ * SDCARD Option Structs
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds One SD Card Connected Over SPI
+ * @struct: @SDCARD_Handle_t
+ * @note  : Only Device is Set By The Application , The Other Fields Are Filled By SDCARD_Init
+ */
+typedef struct
+{
+    const SPIBUS_Device_t *Device; /* Settings Used After Init : Mode 0 , BaudRate Up to fPCLK / 2 ( 18 MHz Max , So fPCLK / 4 on SPI1 ) */
+    SPIBUS_Device_t InitDevice;    /* Copy of Device Clocked at SDCARD_INIT_BAUDRATE */
+    SDCARD_Type_t Type;            /* @SDCARD_Type_t */
+    uint32_t BlockCount;           /* Card Size in SDCARD_BLOCK_SIZE Blocks */
+
+} SDCARD_Handle_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/*
+ * Block Device Interface , Maps One to One on a FatFs diskio Layer :
+ *   disk_initialize => SDCARD_Init           disk_read  => SDCARD_ReadBlocks    disk_write => SDCARD_WriteBlocks
+ *   CTRL_SYNC       => SDCARD_Sync           GET_SECTOR_COUNT => Handle.BlockCount   GET_SECTOR_SIZE => SDCARD_BLOCK_SIZE
+ */
+
+/**
+ * @brief  : This Function is Used to Bring an SD Card Into SPI Mode & Read Its Type & Size
+ * @fn     : SDCARD_Init
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle With Its Device Set -> @SDCARD_Handle_t
+ * @return : ERRORS_t => SDCARD_NOT_FOUND if No Card Answers , SDCARD_UNSUPPORTED For Cards Other Than SD ( e.g. MMC )
+ * @note   : Runs at SDCARD_INIT_BAUDRATE , Then Every Transfer Uses The Clock of Handle->Device
+ *           The MISO Pin Needs a Pull Up , The Chip Select Pin is Initialized Here
+ */
+ERRORS_t SDCARD_Init(SDCARD_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Read Consecutive Blocks
+ * @fn     : SDCARD_ReadBlocks
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @param  : Block  => This Parameter is Used to Pass The First Block Number
+ * @param  : Buffer => This Parameter is Used to Pass The Buffer The Data is Stored in , ( Count x SDCARD_BLOCK_SIZE ) Bytes
+ * @param  : Count  => This Parameter is Used to Pass The Number of Blocks
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : One Block Uses CMD17 , More Use One CMD18 Stream Stopped By CMD12 , Each Block is Clocked Straight Into The Buffer
+ */
+ERRORS_t SDCARD_ReadBlocks(SDCARD_Handle_t *Handle, uint32_t Block, uint8_t *Buffer, uint32_t Count);
+
+/**
+ * @brief  : This Function is Used to Write Consecutive Blocks
+ * @fn     : SDCARD_WriteBlocks
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @param  : Block  => This Parameter is Used to Pass The First Block Number
+ * @param  : Buffer => This Parameter is Used to Pass The Data to Write , ( Count x SDCARD_BLOCK_SIZE ) Bytes
+ * @param  : Count  => This Parameter is Used to Pass The Number of Blocks
+ * @return : ERRORS_t => SDCARD_NOK if The Card Rejects a Block
+ * @note   : One Block Uses CMD24 , More Use One CMD25 Stream Ended By The Stop Token
+ *           The Function Returns While The Card Programs The Last Data , The Next Command Waits For it ( or Call SDCARD_Sync )
+ */
+ERRORS_t SDCARD_WriteBlocks(SDCARD_Handle_t *Handle, uint32_t Block, const uint8_t *Buffer, uint32_t Count);
+
+/**
+ * @brief  : This Function is Used to Wait Until The Card Has Programmed All Written Data
+ * @fn     : SDCARD_Sync
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @return : ERRORS_t => TIME_OUT_ERROR if The Card is Still Busy After SDCARD_BUSY_POLL_LIMIT Bytes
+ */
+ERRORS_t SDCARD_Sync(SDCARD_Handle_t *Handle);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* SDCARD_INC_SDCARD_INTERFACE_H_ */
@@ -0,0 +1,132 @@
+/*
+ ******************************************************************************
+ * @file           : SDCARD_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SDCARD Private Header file
+ * @Date           : Sep 25, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SDCARD_INC_SDCARD_PRIVATE_H_
+#define SDCARD_INC_SDCARD_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+/* Commands */
+#define SDCARD_CMD0  0U  /* GO_IDLE_STATE */
+#define SDCARD_CMD8  8U  /* SEND_IF_COND */
+#define SDCARD_CMD9  9U  /* SEND_CSD */
+#define SDCARD_CMD12 12U /* STOP_TRANSMISSION */
+#define SDCARD_CMD16 16U /* SET_BLOCKLEN */
+#define SDCARD_CMD17 17U /* READ_SINGLE_BLOCK */
+#define SDCARD_CMD18 18U /* READ_MULTIPLE_BLOCK */
+#define SDCARD_CMD24 24U /* WRITE_BLOCK */
+#define SDCARD_CMD25 25U /* WRITE_MULTIPLE_BLOCK */
+#define SDCARD_CMD55 55U /* APP_CMD */
+#define SDCARD_CMD58 58U /* READ_OCR */
+#define SDCARD_ACMD41 41U /* SD_SEND_OP_COND */
+
+/* CRC is Only Checked in SPI Mode For CMD0 & CMD8 */
+#define SDCARD_CMD0_CRC  0x95U
+#define SDCARD_CMD8_CRC  0x87U
+#define SDCARD_DUMMY_CRC 0x01U
+
+#define SDCARD_CMD8_ARGUMENT 0x000001AAUL /* 2.7 - 3.6 V , Check Pattern 0xAA */
+#define SDCARD_ACMD41_HCS    0x40000000UL /* Host Supports High Capacity */
+#define SDCARD_OCR_CCS       0x40U        /* In The First OCR Byte , Card is Block Addressed */
+
+/* R1 Response */
+#define SDCARD_R1_READY           0x00U
+#define SDCARD_R1_IDLE            0x01U
+#define SDCARD_R1_ILLEGAL_COMMAND 0x04U
+#define SDCARD_R1_INVALID         0x80U /* Bit 7 is Always 0 in a Response */
+#define SDCARD_R1_POLL_LIMIT      8U    /* NCR , The Response Comes Within 8 Bytes */
+
+/* Data Tokens */
+#define SDCARD_TOKEN_START_BLOCK  0xFEU /* Single Block Read & Write , Multiple Block Read */
+#define SDCARD_TOKEN_START_MULTI  0xFCU /* Multiple Block Write */
+#define SDCARD_TOKEN_STOP_TRAN    0xFDU /* Ends a Multiple Block Write */
+
+#define SDCARD_DATA_RESPONSE_MASK     0x1FU
+#define SDCARD_DATA_RESPONSE_ACCEPTED 0x05U
+
+#define SDCARD_POWER_UP_BYTES 10U /* At Least 74 Clocks With Chip Select High */
+#define SDCARD_CSD_SIZE       16U
+#define SDCARD_CRC_SIZE       2U
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Take The Bus & Select The Card , Waiting While Queued Transactions Run on it
+ * @fn     : SDCARD_Select
+ * @param  : Device => This Parameter is Used to Pass The Bus Device ( Init or Data Clock )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_Select(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Deselect The Card & Give The Bus Back
+ * @fn     : SDCARD_Deselect
+ * @param  : Device => This Parameter is Used to Pass The Bus Device Passed to SDCARD_Select
+ * @return : void
+ * @note   : One Byte is Clocked After Chip Select Rises , The Card Only Releases MISO on a Clock Edge
+ */
+static void SDCARD_Deselect(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Wait Until The Card Drives MISO High ( Not Busy )
+ * @fn     : SDCARD_WaitReady
+ * @param  : Device => This Parameter is Used to Pass The Selected Bus Device
+ * @return : ERRORS_t => TIME_OUT_ERROR if The Card is Still Busy After SDCARD_BUSY_POLL_LIMIT Bytes
+ */
+static ERRORS_t SDCARD_WaitReady(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Send a Command Frame & Read Its R1 Response
+ * @fn     : SDCARD_Command
+ * @param  : Device   => This Parameter is Used to Pass The Selected Bus Device
+ * @param  : Command  => This Parameter is Used to Pass The Command Index
+ * @param  : Argument => This Parameter is Used to Pass The 32 Bits Argument
+ * @param  : R1       => This Parameter is Used to Return The R1 Response
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_Command(const SPIBUS_Device_t *Device, uint8_t Command, uint32_t Argument, uint8_t *R1);
+
+/**
+ * @brief  : This Function is Used to Receive a Data Block After Its Start Token
+ * @fn     : SDCARD_ReceiveBlock
+ * @param  : Device => This Parameter is Used to Pass The Selected Bus Device
+ * @param  : Buffer => This Parameter is Used to Pass The Buffer The Block is Stored in
+ * @param  : Size   => This Parameter is Used to Pass The Block Size
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_ReceiveBlock(const SPIBUS_Device_t *Device, uint8_t *Buffer, uint16_t Size);
+
+/**
+ * @brief  : This Function is Used to Send a Data Block & Check The Data Response
+ * @fn     : SDCARD_SendBlock
+ * @param  : Device => This Parameter is Used to Pass The Selected Bus Device
+ * @param  : Token  => This Parameter is Used to Pass The Start Token
+ * @param  : Buffer => This Parameter is Used to Pass The Block ( SDCARD_BLOCK_SIZE Bytes )
+ * @return : ERRORS_t => SDCARD_NOK if The Card Rejects The Block
+ */
+static ERRORS_t SDCARD_SendBlock(const SPIBUS_Device_t *Device, uint8_t Token, const uint8_t *Buffer);
+
+/**
+ * @brief  : This Function is Used to Run The Card Identification Sequence on The Selected Card
+ * @fn     : SDCARD_Identify
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_Identify(SDCARD_Handle_t *Handle);
+
+#endif /* SDCARD_INC_SDCARD_PRIVATE_H_ */
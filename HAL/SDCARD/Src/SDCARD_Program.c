@@ -0,0 +1,620 @@
+/*
+ ******************************************************************************
+ * @file           : SDCARD_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 25, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../../SPIBUS/Inc/SPIBUS_Interface.h"
+
+#include "../Inc/SDCARD_Interface.h"
+#include "../Inc/SDCARD_Config.h"
+#include "../Inc/SDCARD_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Bring an SD Card Into SPI Mode & Read Its Type & Size
+ * @fn     : SDCARD_Init
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle With Its Device Set -> @SDCARD_Handle_t
+ * @return : ERRORS_t => SDCARD_NOT_FOUND if No Card Answers , SDCARD_UNSUPPORTED For Cards Other Than SD ( e.g. MMC )
+ */
+ERRORS_t SDCARD_Init(SDCARD_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    if ((NULL == Handle) || (NULL == Handle->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (SPIBUS_OK != SPIBUS_InitDevice(Handle->Device))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+    else
+    {
+        Handle->Type = SDCARD_TYPE_NONE;
+        Handle->BlockCount = 0;
+
+        /* A Separate Descriptor , SPIBUS Skips Reloading The Format For a Device it Already Selected */
+        Handle->InitDevice = *Handle->Device;
+        Handle->InitDevice.BaudRate = SDCARD_INIT_BAUDRATE;
+
+        Local_u8ErrorStatus = SDCARD_Select(&Handle->InitDevice);
+
+        if (SDCARD_OK == Local_u8ErrorStatus)
+        {
+            /* The Card Needs Its Power Up Clocks With Chip Select High */
+            GPIO_u8SetPinValue(Handle->Device->CSPort, Handle->Device->CSPin, PIN_HIGH);
+
+            if (SPIBUS_OK != SPIBUS_Exchange(&Handle->InitDevice, NULL, NULL, SDCARD_POWER_UP_BYTES))
+            {
+                Local_u8ErrorStatus = SDCARD_NOK;
+            }
+
+            GPIO_u8SetPinValue(Handle->Device->CSPort, Handle->Device->CSPin, PIN_LOW);
+
+            if (SDCARD_OK == Local_u8ErrorStatus)
+            {
+                Local_u8ErrorStatus = SDCARD_Identify(Handle);
+            }
+
+            SDCARD_Deselect(&Handle->InitDevice);
+        }
+
+        if (SDCARD_OK != Local_u8ErrorStatus)
+        {
+            Handle->Type = SDCARD_TYPE_NONE;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read Consecutive Blocks
+ * @fn     : SDCARD_ReadBlocks
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @param  : Block  => This Parameter is Used to Pass The First Block Number
+ * @param  : Buffer => This Parameter is Used to Pass The Buffer The Data is Stored in , ( Count x SDCARD_BLOCK_SIZE ) Bytes
+ * @param  : Count  => This Parameter is Used to Pass The Number of Blocks
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SDCARD_ReadBlocks(SDCARD_Handle_t *Handle, uint32_t Block, uint8_t *Buffer, uint32_t Count)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    uint8_t Local_u8R1 = 0;
+    uint32_t Local_u32Counter = 0;
+
+    if ((NULL == Handle) || (NULL == Handle->Device) || (NULL == Buffer))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((SDCARD_TYPE_NONE == Handle->Type) || (0U == Count) || (Block >= Handle->BlockCount) ||
+             (Count > (Handle->BlockCount - Block)))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SDCARD_Select(Handle->Device);
+
+        if (SDCARD_OK == Local_u8ErrorStatus)
+        {
+            /* Standard Capacity Cards Take a Byte Address */
+            Local_u8ErrorStatus = SDCARD_Command(Handle->Device, (1U == Count) ? SDCARD_CMD17 : SDCARD_CMD18,
+                                                 (SDCARD_TYPE_SDHC == Handle->Type) ? Block : (Block * SDCARD_BLOCK_SIZE), &Local_u8R1);
+
+            if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_R1_READY != Local_u8R1))
+            {
+                Local_u8ErrorStatus = SDCARD_NOK;
+            }
+
+            for (Local_u32Counter = 0; (SDCARD_OK == Local_u8ErrorStatus) && (Local_u32Counter < Count); Local_u32Counter++)
+            {
+                Local_u8ErrorStatus = SDCARD_ReceiveBlock(Handle->Device, Buffer, SDCARD_BLOCK_SIZE);
+
+                Buffer += SDCARD_BLOCK_SIZE;
+            }
+
+            /* The Card Streams Blocks Until Told to Stop , Even After an Error */
+            if ((Count > 1U) && (SDCARD_R1_READY == Local_u8R1))
+            {
+                if ((SDCARD_OK != SDCARD_Command(Handle->Device, SDCARD_CMD12, 0, &Local_u8R1)) && (SDCARD_OK == Local_u8ErrorStatus))
+                {
+                    Local_u8ErrorStatus = SDCARD_NOK;
+                }
+            }
+
+            SDCARD_Deselect(Handle->Device);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Write Consecutive Blocks
+ * @fn     : SDCARD_WriteBlocks
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @param  : Block  => This Parameter is Used to Pass The First Block Number
+ * @param  : Buffer => This Parameter is Used to Pass The Data to Write , ( Count x SDCARD_BLOCK_SIZE ) Bytes
+ * @param  : Count  => This Parameter is Used to Pass The Number of Blocks
+ * @return : ERRORS_t => SDCARD_NOK if The Card Rejects a Block
+ */
+ERRORS_t SDCARD_WriteBlocks(SDCARD_Handle_t *Handle, uint32_t Block, const uint8_t *Buffer, uint32_t Count)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    const uint8_t Local_u8StopToken = SDCARD_TOKEN_STOP_TRAN;
+    uint8_t Local_u8R1 = 0;
+    uint32_t Local_u32Counter = 0;
+
+    if ((NULL == Handle) || (NULL == Handle->Device) || (NULL == Buffer))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((SDCARD_TYPE_NONE == Handle->Type) || (0U == Count) || (Block >= Handle->BlockCount) ||
+             (Count > (Handle->BlockCount - Block)))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SDCARD_Select(Handle->Device);
+
+        if (SDCARD_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SDCARD_Command(Handle->Device, (1U == Count) ? SDCARD_CMD24 : SDCARD_CMD25,
+                                                 (SDCARD_TYPE_SDHC == Handle->Type) ? Block : (Block * SDCARD_BLOCK_SIZE), &Local_u8R1);
+
+            if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_R1_READY != Local_u8R1))
+            {
+                Local_u8ErrorStatus = SDCARD_NOK;
+            }
+
+            if ((SDCARD_OK == Local_u8ErrorStatus) && (1U == Count))
+            {
+                Local_u8ErrorStatus = SDCARD_SendBlock(Handle->Device, SDCARD_TOKEN_START_BLOCK, Buffer);
+            }
+            else if (SDCARD_OK == Local_u8ErrorStatus)
+            {
+                for (Local_u32Counter = 0; (SDCARD_OK == Local_u8ErrorStatus) && (Local_u32Counter < Count); Local_u32Counter++)
+                {
+                    /* The Previous Block is Programmed Before The Next One is Accepted */
+                    Local_u8ErrorStatus = SDCARD_WaitReady(Handle->Device);
+
+                    if (SDCARD_OK == Local_u8ErrorStatus)
+                    {
+                        Local_u8ErrorStatus = SDCARD_SendBlock(Handle->Device, SDCARD_TOKEN_START_MULTI, Buffer);
+                    }
+
+                    Buffer += SDCARD_BLOCK_SIZE;
+                }
+
+                /* The Stream is Always Closed , Also After a Rejected Block */
+                if ((SDCARD_OK == SDCARD_WaitReady(Handle->Device)) &&
+                    (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, &Local_u8StopToken, NULL, 1U)))
+                {
+                    Local_u8ErrorStatus = SDCARD_NOK;
+                }
+            }
+
+            /* The Last Busy Period is Waited For By The Next Command , Not Here */
+            SDCARD_Deselect(Handle->Device);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Wait Until The Card Has Programmed All Written Data
+ * @fn     : SDCARD_Sync
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @return : ERRORS_t => TIME_OUT_ERROR if The Card is Still Busy After SDCARD_BUSY_POLL_LIMIT Bytes
+ */
+ERRORS_t SDCARD_Sync(SDCARD_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    if ((NULL == Handle) || (NULL == Handle->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (SDCARD_TYPE_NONE == Handle->Type)
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SDCARD_Select(Handle->Device);
+
+        if (SDCARD_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SDCARD_WaitReady(Handle->Device);
+
+            SDCARD_Deselect(Handle->Device);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Take The Bus & Select The Card , Waiting While Queued Transactions Run on it
+ * @fn     : SDCARD_Select
+ * @param  : Device => This Parameter is Used to Pass The Bus Device ( Init or Data Clock )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_Select(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8BusStatus = SPIBUS_OK;
+
+    do
+    {
+        Local_u8BusStatus = SPIBUS_Begin(Device);
+
+    } while (SPIBUS_BUSY == Local_u8BusStatus);
+
+    return (SPIBUS_OK == Local_u8BusStatus) ? SDCARD_OK : SDCARD_NOK;
+}
+
+/**
+ * @brief  : This Function is Used to Deselect The Card & Give The Bus Back
+ * @fn     : SDCARD_Deselect
+ * @param  : Device => This Parameter is Used to Pass The Bus Device Passed to SDCARD_Select
+ * @return : void
+ */
+static void SDCARD_Deselect(const SPIBUS_Device_t *Device)
+{
+    GPIO_u8SetPinValue(Device->CSPort, Device->CSPin, PIN_HIGH);
+
+    /* Lets The Card Release MISO Before Another Device is Selected */
+    SPIBUS_Exchange(Device, NULL, NULL, 1U);
+
+    SPIBUS_End(Device);
+}
+
+/**
+ * @brief  : This Function is Used to Wait Until The Card Drives MISO High ( Not Busy )
+ * @fn     : SDCARD_WaitReady
+ * @param  : Device => This Parameter is Used to Pass The Selected Bus Device
+ * @return : ERRORS_t => TIME_OUT_ERROR if The Card is Still Busy After SDCARD_BUSY_POLL_LIMIT Bytes
+ */
+static ERRORS_t SDCARD_WaitReady(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    uint8_t Local_u8Byte = 0;
+    uint32_t Local_u32Polls = 0;
+
+    do
+    {
+        if (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, &Local_u8Byte, 1U))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+
+        Local_u32Polls++;
+
+    } while ((SDCARD_OK == Local_u8ErrorStatus) && (0xFFU != Local_u8Byte) && (Local_u32Polls < SDCARD_BUSY_POLL_LIMIT));
+
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (0xFFU != Local_u8Byte))
+    {
+        Local_u8ErrorStatus = TIME_OUT_ERROR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send a Command Frame & Read Its R1 Response
+ * @fn     : SDCARD_Command
+ * @param  : Device   => This Parameter is Used to Pass The Selected Bus Device
+ * @param  : Command  => This Parameter is Used to Pass The Command Index
+ * @param  : Argument => This Parameter is Used to Pass The 32 Bits Argument
+ * @param  : R1       => This Parameter is Used to Return The R1 Response
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_Command(const SPIBUS_Device_t *Device, uint8_t Command, uint32_t Argument, uint8_t *R1)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    uint8_t Local_u8Frame[6] = {0};
+    uint8_t Local_u8Polls = 0;
+
+    Local_u8Frame[0] = (uint8_t)(0x40U | Command);
+    Local_u8Frame[1] = (uint8_t)(Argument >> 24);
+    Local_u8Frame[2] = (uint8_t)(Argument >> 16);
+    Local_u8Frame[3] = (uint8_t)(Argument >> 8);
+    Local_u8Frame[4] = (uint8_t)Argument;
+    Local_u8Frame[5] = (SDCARD_CMD0 == Command) ? SDCARD_CMD0_CRC : ((SDCARD_CMD8 == Command) ? SDCARD_CMD8_CRC : SDCARD_DUMMY_CRC);
+
+    *R1 = SDCARD_R1_INVALID;
+
+    /* CMD12 Interrupts a Read Stream , MISO Carries Data There & is Not a Busy Signal
+     * CMD0 Resets a Card Left in Any State By an MCU Reset , Waiting Could Last Forever There */
+    if ((SDCARD_CMD12 != Command) && (SDCARD_CMD0 != Command))
+    {
+        Local_u8ErrorStatus = SDCARD_WaitReady(Device);
+    }
+
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (SPIBUS_OK != SPIBUS_Exchange(Device, Local_u8Frame, NULL, sizeof(Local_u8Frame))))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+
+    /* The Byte Right After CMD12 is a Stuff Byte */
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_CMD12 == Command) && (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, NULL, 1U)))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+
+    while ((SDCARD_OK == Local_u8ErrorStatus) && (*R1 & SDCARD_R1_INVALID) && (Local_u8Polls < SDCARD_R1_POLL_LIMIT))
+    {
+        if (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, R1, 1U))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+
+        Local_u8Polls++;
+    }
+
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (*R1 & SDCARD_R1_INVALID))
+    {
+        Local_u8ErrorStatus = TIME_OUT_ERROR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Receive a Data Block After Its Start Token
+ * @fn     : SDCARD_ReceiveBlock
+ * @param  : Device => This Parameter is Used to Pass The Selected Bus Device
+ * @param  : Buffer => This Parameter is Used to Pass The Buffer The Block is Stored in
+ * @param  : Size   => This Parameter is Used to Pass The Block Size
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_ReceiveBlock(const SPIBUS_Device_t *Device, uint8_t *Buffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    uint8_t Local_u8Token = 0xFF;
+    uint32_t Local_u32Polls = 0;
+
+    /* Read One Byte at a Time , The Block Starts Right After The Token */
+    while ((SDCARD_OK == Local_u8ErrorStatus) && (0xFFU == Local_u8Token) && (Local_u32Polls < SDCARD_TOKEN_POLL_LIMIT))
+    {
+        if (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, &Local_u8Token, 1U))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+
+        Local_u32Polls++;
+    }
+
+    if (SDCARD_OK == Local_u8ErrorStatus)
+    {
+        if (0xFFU == Local_u8Token)
+        {
+            Local_u8ErrorStatus = TIME_OUT_ERROR;
+        }
+        else if (SDCARD_TOKEN_START_BLOCK != Local_u8Token)
+        {
+            /* Data Error Token */
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+        else if ((SPIBUS_OK != SPIBUS_Exchange(Device, NULL, Buffer, Size)) ||
+                 (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, NULL, SDCARD_CRC_SIZE)))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send a Data Block & Check The Data Response
+ * @fn     : SDCARD_SendBlock
+ * @param  : Device => This Parameter is Used to Pass The Selected Bus Device
+ * @param  : Token  => This Parameter is Used to Pass The Start Token
+ * @param  : Buffer => This Parameter is Used to Pass The Block ( SDCARD_BLOCK_SIZE Bytes )
+ * @return : ERRORS_t => SDCARD_NOK if The Card Rejects The Block
+ */
+static ERRORS_t SDCARD_SendBlock(const SPIBUS_Device_t *Device, uint8_t Token, const uint8_t *Buffer)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    uint8_t Local_u8Response = 0;
+
+    /* CRC is Not Checked in SPI Mode , Dummy 0xFF Bytes Are Sent For it */
+    if ((SPIBUS_OK != SPIBUS_Exchange(Device, &Token, NULL, 1U)) ||
+        (SPIBUS_OK != SPIBUS_Exchange(Device, Buffer, NULL, SDCARD_BLOCK_SIZE)) ||
+        (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, NULL, SDCARD_CRC_SIZE)) ||
+        (SPIBUS_OK != SPIBUS_Exchange(Device, NULL, &Local_u8Response, 1U)))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+    else if (SDCARD_DATA_RESPONSE_ACCEPTED != (Local_u8Response & SDCARD_DATA_RESPONSE_MASK))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Run The Card Identification Sequence on The Selected Card
+ * @fn     : SDCARD_Identify
+ * @param  : Handle => This Parameter is Used to Pass The Card Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SDCARD_Identify(SDCARD_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SDCARD_OK;
+
+    const SPIBUS_Device_t *Local_Device = &Handle->InitDevice;
+
+    SDCARD_Type_t Local_Type = SDCARD_TYPE_SDV1;
+
+    uint8_t Local_u8R1 = SDCARD_R1_INVALID;
+    uint8_t Local_u8Response[SDCARD_CSD_SIZE] = {0};
+    uint32_t Local_u32Retries = 0;
+    uint32_t Local_u32CSize = 0;
+    uint8_t Local_u8Shift = 0;
+
+    /* CMD0 With Chip Select Low Enters SPI Mode */
+    for (Local_u32Retries = 0; (Local_u32Retries < SDCARD_CMD0_RETRIES) && (SDCARD_R1_IDLE != Local_u8R1); Local_u32Retries++)
+    {
+        Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_CMD0, 0, &Local_u8R1);
+    }
+
+    if (SDCARD_R1_IDLE != Local_u8R1)
+    {
+        Local_u8ErrorStatus = SDCARD_NOT_FOUND;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_CMD8, SDCARD_CMD8_ARGUMENT, &Local_u8R1);
+    }
+
+    /* Version 2 Cards Echo The Voltage Range & Check Pattern , Version 1 Cards Reject CMD8 */
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_R1_IDLE == Local_u8R1))
+    {
+        if (SPIBUS_OK != SPIBUS_Exchange(Local_Device, NULL, Local_u8Response, 4U))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+        else if ((0x01U != (Local_u8Response[2] & 0x0FU)) || (0xAAU != Local_u8Response[3]))
+        {
+            Local_u8ErrorStatus = SDCARD_UNSUPPORTED;
+        }
+        else
+        {
+            Local_Type = SDCARD_TYPE_SDV2;
+        }
+    }
+    else if ((SDCARD_OK == Local_u8ErrorStatus) && (0U == (Local_u8R1 & SDCARD_R1_ILLEGAL_COMMAND)))
+    {
+        Local_u8ErrorStatus = SDCARD_NOK;
+    }
+
+    /* ACMD41 Until The Card Leaves The Idle State , MMC Cards Reject it */
+    Local_u8R1 = SDCARD_R1_IDLE;
+
+    for (Local_u32Retries = 0; (SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_R1_IDLE == Local_u8R1) && (Local_u32Retries < SDCARD_INIT_RETRIES);
+         Local_u32Retries++)
+    {
+        Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_CMD55, 0, &Local_u8R1);
+
+        if (SDCARD_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_ACMD41, (SDCARD_TYPE_SDV2 == Local_Type) ? SDCARD_ACMD41_HCS : 0,
+                                                 &Local_u8R1);
+        }
+    }
+
+    if (SDCARD_OK == Local_u8ErrorStatus)
+    {
+        if (SDCARD_R1_IDLE == Local_u8R1)
+        {
+            Local_u8ErrorStatus = TIME_OUT_ERROR;
+        }
+        else if (SDCARD_R1_READY != Local_u8R1)
+        {
+            Local_u8ErrorStatus = SDCARD_UNSUPPORTED;
+        }
+    }
+
+    /* Version 2 Cards Report Block Addressing in The OCR CCS Bit */
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_TYPE_SDV2 == Local_Type))
+    {
+        Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_CMD58, 0, &Local_u8R1);
+
+        if ((SDCARD_OK == Local_u8ErrorStatus) && ((SDCARD_R1_READY != Local_u8R1) ||
+                                                   (SPIBUS_OK != SPIBUS_Exchange(Local_Device, NULL, Local_u8Response, 4U))))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+        else if ((SDCARD_OK == Local_u8ErrorStatus) && (Local_u8Response[0] & SDCARD_OCR_CCS))
+        {
+            Local_Type = SDCARD_TYPE_SDHC;
+        }
+    }
+
+    /* Byte Addressed Cards May Power Up With Another Block Length */
+    if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_TYPE_SDHC != Local_Type))
+    {
+        Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_CMD16, SDCARD_BLOCK_SIZE, &Local_u8R1);
+
+        if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_R1_READY != Local_u8R1))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+    }
+
+    /* Card Size From The CSD Register */
+    if (SDCARD_OK == Local_u8ErrorStatus)
+    {
+        Local_u8ErrorStatus = SDCARD_Command(Local_Device, SDCARD_CMD9, 0, &Local_u8R1);
+
+        if ((SDCARD_OK == Local_u8ErrorStatus) && (SDCARD_R1_READY != Local_u8R1))
+        {
+            Local_u8ErrorStatus = SDCARD_NOK;
+        }
+    }
+
+    if (SDCARD_OK == Local_u8ErrorStatus)
+    {
+        Local_u8ErrorStatus = SDCARD_ReceiveBlock(Local_Device, Local_u8Response, SDCARD_CSD_SIZE);
+    }
+
+    if (SDCARD_OK == Local_u8ErrorStatus)
+    {
+        if (0x40U == (Local_u8Response[0] & 0xC0U))
+        {
+            /* CSD Version 2.0 : ( C_SIZE + 1 ) x 512 KB */
+            Local_u32CSize = ((uint32_t)(Local_u8Response[7] & 0x3FU) << 16) | ((uint32_t)Local_u8Response[8] << 8) | Local_u8Response[9];
+
+            Handle->BlockCount = (Local_u32CSize + 1UL) << 10;
+        }
+        else
+        {
+            /* CSD Version 1.0 : ( C_SIZE + 1 ) x 2 ^ ( C_SIZE_MULT + 2 ) x 2 ^ READ_BL_LEN Bytes */
+            Local_u32CSize = ((uint32_t)(Local_u8Response[6] & 0x03U) << 10) | ((uint32_t)Local_u8Response[7] << 2) | (Local_u8Response[8] >> 6);
+
+            Local_u8Shift = (uint8_t)((((Local_u8Response[9] & 0x03U) << 1) | (Local_u8Response[10] >> 7)) + 2U + (Local_u8Response[5] & 0x0FU) - 9U);
+
+            Handle->BlockCount = (Local_u32CSize + 1UL) << Local_u8Shift;
+        }
+
+        Handle->Type = Local_Type;
+    }
+    return Local_u8ErrorStatus;
+}
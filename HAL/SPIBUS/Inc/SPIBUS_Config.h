@@ -0,0 +1,26 @@
+/*
+ ******************************************************************************
+ * @file           : SPIBUS_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPIBUS Configuration Header file
+ * @Date           : Sep 20, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SPIBUS_INC_SPIBUS_CONFIG_H_
+#define SPIBUS_INC_SPIBUS_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Number of Transactions Each Bus Can Hold Waiting , Must Be a Power of Two
+ * One Slot is Always Kept Empty , So a Bus Queues ( SPIBUS_QUEUE_SIZE - 1 ) Transactions */
+#define SPIBUS_QUEUE_SIZE 8U
+
+#endif /* SPIBUS_INC_SPIBUS_CONFIG_H_ */
@@ -0,0 +1,147 @@
+/*
+ ******************************************************************************
+ * @file           : SPIBUS_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPIBUS Interface Header file
+ * @Date           : Sep 20, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SPIBUS_INC_SPIBUS_INTERFACE_H_
+#define SPIBUS_INC_SPIBUS_INTERFACE_H_
+
+/* ======================================================================
+ * SPIBUS Option Structs
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds The Settings of One Device Connected to a Shared SPI Bus
+ * @struct: @SPIBUS_Device_t
+ * @note  : The Bus Switches to These Settings Before Each Transaction With The Device , Only if They Differ From The Loaded Ones
+ */
+typedef struct
+{
+    SPI_t SPINumber;              /* Bus The Device is Connected to */
+    SPI_CPOL_t ClockPolarity;
+    SPI_CPHA_t ClockPhase;
+    SPI_BAUDRATE_t BaudRate;
+    SPI_DIRECTION_t Direction;
+    Port_t CSPort;                /* Chip Select Pin , Active Low */
+    Pin_t CSPin;
+
+} SPIBUS_Device_t;
+
+/**
+ * @brief : This Struct Holds One Queued Transaction
+ * @struct: @SPIBUS_Transaction_t
+ * @note  : The Struct & Its Buffers Are Owned By The Caller & Must Stay Valid Until The CallBack is Invoked
+ */
+typedef struct
+{
+    const SPIBUS_Device_t *Device;
+    const uint8_t *TxBuffer;            /* NULL Sends 0xFF Dummy Bytes */
+    uint8_t *RxBuffer;                  /* NULL Discards The Received Bytes */
+    uint16_t Size;
+    void (*CallBack)(ERRORS_t Status);  /* Invoked After Chip Select is Released ( May Be NULL ) */
+
+} SPIBUS_Transaction_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Initialize an SPI Peripheral as a Shared Bus
+ * @fn     : SPIBUS_Init
+ * @param  : BusConfig => This Parameter is Used to Pass The Configuration of The SPI Peripheral ( Master , Full Duplex , 8 Bit Frames )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Configuration is Copied , The Format Fields Are Then Replaced By Those of Each Device When it is Selected
+ *           Queued Transactions Use DMA , So DMA1 Clock Must Be Enabled & The SPI DMA Channel IRQs Enabled in NVIC
+ */
+ERRORS_t SPIBUS_Init(const SPI_Config_t *BusConfig);
+
+/**
+ * @brief  : This Function is Used to Initialize The Chip Select Pin of a Device & Release it
+ * @fn     : SPIBUS_InitDevice
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor -> @SPIBUS_Device_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The GPIO Port Clock Must Be Enabled Before Calling This Function
+ */
+ERRORS_t SPIBUS_InitDevice(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Take The Bus For a Device & Assert Its Chip Select
+ * @fn     : SPIBUS_Begin
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor -> @SPIBUS_Device_t
+ * @return : ERRORS_t => SPIBUS_BUSY if Another Transaction is Running on The Bus
+ * @note   : For Commands Made of Several Parts ( e.g. a Header Then a Data Buffer ) Under One Chip Select
+ *           Every SPIBUS_Begin Must Be Followed By SPIBUS_End , Submitted Transactions Wait Until Then
+ */
+ERRORS_t SPIBUS_Begin(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Exchange Bytes With The Device Holding The Bus ( Blocking )
+ * @fn     : SPIBUS_Exchange
+ * @param  : Device   => This Parameter is Used to Pass The Device Descriptor Passed to SPIBUS_Begin
+ * @param  : TxBuffer => This Parameter is Used to Pass The Bytes to Send ( NULL Sends 0xFF Dummy Bytes )
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored in ( NULL Discards Them )
+ * @param  : Size     => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => SPIBUS_NOK if The Device Does Not Hold The Bus
+ * @note   : Chip Select Stays Asserted , So Consecutive Calls Continue The Same Command
+ */
+ERRORS_t SPIBUS_Exchange(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size);
+
+/**
+ * @brief  : This Function is Used to Exchange 16 Bit Frames With The Device Holding The Bus ( Blocking )
+ * @fn     : SPIBUS_Exchange16
+ * @param  : Device   => This Parameter is Used to Pass The Device Descriptor Passed to SPIBUS_Begin
+ * @param  : TxBuffer => This Parameter is Used to Pass The Frames to Send ( NULL Sends 0xFFFF Dummy Frames )
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Frames Are Stored in ( NULL Discards Them )
+ * @param  : Size     => This Parameter is Used to Pass The Number of Frames
+ * @return : ERRORS_t => SPIBUS_NOK if The Device Does Not Hold The Bus
+ * @note   : Each Frame is Sent Most Significant Byte First ( With Direction MSB First ) , So No Byte Swapping is Needed
+ *           The Bus Stays in 16 Bit Frames Until The Next SPIBUS_Exchange or SPIBUS_End
+ */
+ERRORS_t SPIBUS_Exchange16(const SPIBUS_Device_t *Device, const uint16_t *TxBuffer, uint16_t *RxBuffer, uint16_t Size);
+
+/**
+ * @brief  : This Function is Used to Release The Chip Select of The Device Holding The Bus & Give The Bus Back
+ * @fn     : SPIBUS_End
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor Passed to SPIBUS_Begin
+ * @return : ERRORS_t => SPIBUS_NOK if The Device Does Not Hold The Bus
+ * @note   : Transactions Submitted While The Bus Was Held Are Started Here
+ */
+ERRORS_t SPIBUS_End(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Run a Transaction With a Device & Wait For it ( Blocking )
+ * @fn     : SPIBUS_Transfer
+ * @param  : Device   => This Parameter is Used to Pass The Device Descriptor -> @SPIBUS_Device_t
+ * @param  : TxBuffer => This Parameter is Used to Pass The Bytes to Send ( NULL Sends 0xFF Dummy Bytes )
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored in ( NULL Discards Them )
+ * @param  : Size     => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => SPIBUS_BUSY if Queued Transactions Are Running on The Bus
+ * @note   : Transactions Submitted While This Function Runs Are Started Once it Returns
+ */
+ERRORS_t SPIBUS_Transfer(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size);
+
+/**
+ * @brief  : This Function is Used to Queue a Transaction on The Bus of Its Device ( Non Blocking )
+ * @fn     : SPIBUS_Submit
+ * @param  : Transaction => This Parameter is Used to Pass The Transaction -> @SPIBUS_Transaction_t
+ * @return : ERRORS_t => SPIBUS_QUEUE_FULL if The Bus Queue Has No Free Slot
+ * @note   : Transactions Run Back to Back Through DMA in Submission Order , Each Between Its Own Chip Select Assert & Release
+ *           The CallBack Runs in Interrupt Context & May Submit The Next Transaction
+ */
+ERRORS_t SPIBUS_Submit(SPIBUS_Transaction_t *Transaction);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* SPIBUS_INC_SPIBUS_INTERFACE_H_ */
@@ -0,0 +1,127 @@
+/*
+ ******************************************************************************
+ * @file           : SPIBUS_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPIBUS Private Header file
+ * @Date           : Sep 20, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SPIBUS_INC_SPIBUS_PRIVATE_H_
+#define SPIBUS_INC_SPIBUS_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+#define SPIBUS_QUEUE_MASK (SPIBUS_QUEUE_SIZE - 1U)
+
+#if ((SPIBUS_QUEUE_SIZE & SPIBUS_QUEUE_MASK) != 0U) || (SPIBUS_QUEUE_SIZE < 2U)
+#error "SPIBUS_QUEUE_SIZE Must Be a Power of Two"
+#endif
+
+/* ======================================================================
+ * PRIVATE TYPES
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds The State of One Shared Bus
+ */
+typedef struct
+{
+    SPI_Config_t Config;                                /* Copy of The Settings Loaded in The Peripheral */
+    uint8_t Initialized;
+    uint8_t Busy;                                       /* A Transaction is Running , Queued or Blocking */
+    const SPIBUS_Device_t *SelectedDevice;              /* Device Whose Format is Loaded , Skips The Comparison When it Talks Again */
+    const SPIBUS_Device_t *Owner;                       /* Device Holding The Bus Between SPIBUS_Begin & SPIBUS_End */
+    SPIBUS_Transaction_t *Current;                      /* Queued Transaction Running on The Bus */
+    SPIBUS_Transaction_t *Queue[SPIBUS_QUEUE_SIZE];
+    uint8_t Head;
+    uint8_t Tail;
+
+} SPIBUS_Bus_t;
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Load The Format of a Device in The Bus , Only if it Differs From The Loaded One
+ * @fn     : SPIBUS_SelectDevice
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIBUS_SelectDevice(const SPIBUS_Device_t *Device);
+
+/**
+ * @brief  : This Function is Used to Switch The Frame Size of a Bus , Only if it Differs From The Loaded One
+ * @fn     : SPIBUS_SetDataWidth
+ * @param  : SPINumber => This Parameter is Used to Select The Bus -> @SPI_t
+ * @param  : DataWidth => This Parameter is Used to Pass The Frame Size -> @SPI_DATA_SIZE_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIBUS_SetDataWidth(SPI_t SPINumber, SPI_DATA_SIZE_t DataWidth);
+
+/**
+ * @brief  : This Function is Used to Start The Next Queued Transaction on a Bus , or Mark The Bus Idle
+ * @fn     : SPIBUS_StartNext
+ * @param  : SPINumber => This Parameter is Used to Select The Bus -> @SPI_t
+ * @return : void
+ * @note   : Called With The Bus Marked Busy & Interrupts Masked
+ */
+static void SPIBUS_StartNext(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to End The Running Queued Transaction & Start The Next One
+ * @fn     : SPIBUS_TransferDone
+ * @param  : SPINumber => This Parameter is Used to Select The Bus -> @SPI_t
+ * @param  : Status    => This Parameter is Used to Pass The Transfer Result
+ * @return : void
+ */
+static void SPIBUS_TransferDone(SPI_t SPINumber, ERRORS_t Status);
+
+/**
+ * @brief  : SPI_TransferDMA CallBacks , One Per Bus ( Private Functions )
+ * @param  : Status => This Parameter is Used to Pass The Transfer Result
+ */
+static void SPIBUS_SPI1Done(ERRORS_t Status);
+static void SPIBUS_SPI2Done(ERRORS_t Status);
+
+/**
+ * @brief  : This Function is Used to Mask All Configurable Interrupts & Return The Previous PRIMASK
+ * @fn     : SPIBUS_EnterCritical
+ * @return : uint32_t => Previous PRIMASK Value to Be Passed to SPIBUS_ExitCritical
+ */
+static inline uint32_t SPIBUS_EnterCritical(void)
+{
+    uint32_t Local_u32PriMask;
+
+    __asm volatile("MRS %0, PRIMASK \n"
+                   "CPSID i"
+                   : "=r"(Local_u32PriMask)
+                   :
+                   : "memory");
+
+    return Local_u32PriMask;
+}
+
+/**
+ * @brief  : This Function is Used to Restore PRIMASK Saved By SPIBUS_EnterCritical
+ * @fn     : SPIBUS_ExitCritical
+ * @param  : PriMask => This Parameter is Used to Pass The Value Returned By SPIBUS_EnterCritical
+ * @return : void
+ */
+static inline void SPIBUS_ExitCritical(uint32_t PriMask)
+{
+    __asm volatile("MSR PRIMASK, %0"
+                   :
+                   : "r"(PriMask)
+                   : "memory");
+}
+
+#endif /* SPIBUS_INC_SPIBUS_PRIVATE_H_ */
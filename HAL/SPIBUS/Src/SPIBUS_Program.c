@@ -0,0 +1,530 @@
+/*
+ ******************************************************************************
+ * @file           : SPIBUS_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 20, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../Inc/SPIBUS_Interface.h"
+#include "../Inc/SPIBUS_Config.h"
+#include "../Inc/SPIBUS_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION START
+ *==============================================================================================================================================*/
+
+static SPIBUS_Bus_t SPIBUS_Bus[SPI_MAX_NUM] = {0};
+
+/* SPI_TransferDMA Does Not Report The Peripheral , So Each Bus Gets Its Own CallBack */
+static void (*const SPIBUS_DoneCallBack[SPI_MAX_NUM])(ERRORS_t) = {SPIBUS_SPI1Done, SPIBUS_SPI2Done};
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Initialize an SPI Peripheral as a Shared Bus
+ * @fn     : SPIBUS_Init
+ * @param  : BusConfig => This Parameter is Used to Pass The Configuration of The SPI Peripheral ( Master , Full Duplex , 8 Bit Frames )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIBUS_Init(const SPI_Config_t *BusConfig)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    SPIBUS_Bus_t *Local_Bus = NULL;
+
+    if (NULL == BusConfig)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((BusConfig->SPINumber >= SPI_MAX_NUM) || (SPI_MASTER != BusConfig->NodeRole) ||
+             (SPI_FULL_DUPLEX != BusConfig->Mode) || (SPI_1BYTE != BusConfig->DataWidth))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else if (SPIBUS_Bus[BusConfig->SPINumber].Busy)
+    {
+        Local_u8ErrorStatus = SPIBUS_BUSY;
+    }
+    else
+    {
+        Local_Bus = &SPIBUS_Bus[BusConfig->SPINumber];
+
+        Local_Bus->Config = *BusConfig;
+        Local_Bus->SelectedDevice = NULL;
+        Local_Bus->Owner = NULL;
+        Local_Bus->Current = NULL;
+        Local_Bus->Head = 0;
+        Local_Bus->Tail = 0;
+
+        if (SPI_OK == SPI_Init(&Local_Bus->Config))
+        {
+            Local_Bus->Initialized = 1;
+        }
+        else
+        {
+            Local_u8ErrorStatus = SPIBUS_NOK;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Initialize The Chip Select Pin of a Device & Release it
+ * @fn     : SPIBUS_InitDevice
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor -> @SPIBUS_Device_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIBUS_InitDevice(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    GPIO_PinConfig_t Local_CSPin = {
+        .Mode = OUTPUT_MAXSPEED_50MHZ,
+        .OutMode = OUTPUT_PUSH_PULL,
+    };
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (Device->SPINumber >= SPI_MAX_NUM)
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        Local_CSPin.Port = Device->CSPort;
+        Local_CSPin.PinNum = Device->CSPin;
+
+        /* Latch The Released Level First So The Pin Does Not Glitch Low When it Becomes an Output */
+        if ((OK != GPIO_u8SetPinValue(Device->CSPort, Device->CSPin, PIN_HIGH)) ||
+            (OK != GPIO_u8PinInit(&Local_CSPin)))
+        {
+            Local_u8ErrorStatus = SPIBUS_NOK;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Take The Bus For a Device & Assert Its Chip Select
+ * @fn     : SPIBUS_Begin
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor -> @SPIBUS_Device_t
+ * @return : ERRORS_t => SPIBUS_BUSY if Another Transaction is Running on The Bus
+ */
+ERRORS_t SPIBUS_Begin(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    SPIBUS_Bus_t *Local_Bus = NULL;
+
+    uint32_t Local_u32PriMask = 0;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Device->SPINumber >= SPI_MAX_NUM) || (0U == SPIBUS_Bus[Device->SPINumber].Initialized))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        Local_Bus = &SPIBUS_Bus[Device->SPINumber];
+
+        /* Take The Bus , an ISR Submitting at The Same Time Only Queues Behind Us */
+        Local_u32PriMask = SPIBUS_EnterCritical();
+
+        if (Local_Bus->Busy)
+        {
+            Local_u8ErrorStatus = SPIBUS_BUSY;
+        }
+        else
+        {
+            Local_Bus->Busy = 1;
+            Local_Bus->Owner = Device;
+        }
+
+        SPIBUS_ExitCritical(Local_u32PriMask);
+
+        if (SPIBUS_OK == Local_u8ErrorStatus)
+        {
+            SPIBUS_SelectDevice(Device);
+
+            GPIO_u8SetPinValue(Device->CSPort, Device->CSPin, PIN_LOW);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Exchange Bytes With The Device Holding The Bus ( Blocking )
+ * @fn     : SPIBUS_Exchange
+ * @param  : Device   => This Parameter is Used to Pass The Device Descriptor Passed to SPIBUS_Begin
+ * @param  : TxBuffer => This Parameter is Used to Pass The Bytes to Send ( NULL Sends 0xFF Dummy Bytes )
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored in ( NULL Discards Them )
+ * @param  : Size     => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => SPIBUS_NOK if The Device Does Not Hold The Bus
+ */
+ERRORS_t SPIBUS_Exchange(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Device->SPINumber >= SPI_MAX_NUM) || (Device != SPIBUS_Bus[Device->SPINumber].Owner) || (0U == Size))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else if ((SPIBUS_OK != SPIBUS_SetDataWidth(Device->SPINumber, SPI_1BYTE)) ||
+             (SPI_OK != SPI_TransceiveBuffer(&SPIBUS_Bus[Device->SPINumber].Config, RxBuffer, (uint8_t *)TxBuffer, Size)))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Exchange 16 Bit Frames With The Device Holding The Bus ( Blocking )
+ * @fn     : SPIBUS_Exchange16
+ * @param  : Device   => This Parameter is Used to Pass The Device Descriptor Passed to SPIBUS_Begin
+ * @param  : TxBuffer => This Parameter is Used to Pass The Frames to Send ( NULL Sends 0xFFFF Dummy Frames )
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Frames Are Stored in ( NULL Discards Them )
+ * @param  : Size     => This Parameter is Used to Pass The Number of Frames
+ * @return : ERRORS_t => SPIBUS_NOK if The Device Does Not Hold The Bus
+ */
+ERRORS_t SPIBUS_Exchange16(const SPIBUS_Device_t *Device, const uint16_t *TxBuffer, uint16_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Device->SPINumber >= SPI_MAX_NUM) || (Device != SPIBUS_Bus[Device->SPINumber].Owner) || (0U == Size))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else if ((SPIBUS_OK != SPIBUS_SetDataWidth(Device->SPINumber, SPI_2BYTE)) ||
+             (SPI_OK != SPI_TransceiveBuffer16(&SPIBUS_Bus[Device->SPINumber].Config, RxBuffer, TxBuffer, Size)))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Release The Chip Select of The Device Holding The Bus & Give The Bus Back
+ * @fn     : SPIBUS_End
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor Passed to SPIBUS_Begin
+ * @return : ERRORS_t => SPIBUS_NOK if The Device Does Not Hold The Bus
+ */
+ERRORS_t SPIBUS_End(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    SPIBUS_Bus_t *Local_Bus = NULL;
+
+    uint32_t Local_u32PriMask = 0;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Device->SPINumber >= SPI_MAX_NUM) || (Device != SPIBUS_Bus[Device->SPINumber].Owner))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        Local_Bus = &SPIBUS_Bus[Device->SPINumber];
+
+        GPIO_u8SetPinValue(Device->CSPort, Device->CSPin, PIN_HIGH);
+
+        /* Queued Transactions Run in 8 Bit Frames */
+        SPIBUS_SetDataWidth(Device->SPINumber, SPI_1BYTE);
+
+        /* Hand The Bus to Whatever Was Submitted Meanwhile */
+        Local_u32PriMask = SPIBUS_EnterCritical();
+
+        Local_Bus->Owner = NULL;
+
+        SPIBUS_StartNext(Device->SPINumber);
+
+        SPIBUS_ExitCritical(Local_u32PriMask);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Run a Transaction With a Device & Wait For it ( Blocking )
+ * @fn     : SPIBUS_Transfer
+ * @param  : Device   => This Parameter is Used to Pass The Device Descriptor -> @SPIBUS_Device_t
+ * @param  : TxBuffer => This Parameter is Used to Pass The Bytes to Send ( NULL Sends 0xFF Dummy Bytes )
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored in ( NULL Discards Them )
+ * @param  : Size     => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => SPIBUS_BUSY if Queued Transactions Are Running on The Bus
+ */
+ERRORS_t SPIBUS_Transfer(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (0U == Size)
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SPIBUS_Begin(Device);
+
+        if (SPIBUS_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SPIBUS_Exchange(Device, TxBuffer, RxBuffer, Size);
+
+            SPIBUS_End(Device);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Queue a Transaction on The Bus of Its Device ( Non Blocking )
+ * @fn     : SPIBUS_Submit
+ * @param  : Transaction => This Parameter is Used to Pass The Transaction -> @SPIBUS_Transaction_t
+ * @return : ERRORS_t => SPIBUS_QUEUE_FULL if The Bus Queue Has No Free Slot
+ */
+ERRORS_t SPIBUS_Submit(SPIBUS_Transaction_t *Transaction)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    SPIBUS_Bus_t *Local_Bus = NULL;
+
+    uint32_t Local_u32PriMask = 0;
+
+    uint8_t Local_u8NextHead = 0;
+
+    if ((NULL == Transaction) || (NULL == Transaction->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Transaction->Device->SPINumber >= SPI_MAX_NUM) ||
+             (0U == SPIBUS_Bus[Transaction->Device->SPINumber].Initialized) || (0U == Transaction->Size))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        Local_Bus = &SPIBUS_Bus[Transaction->Device->SPINumber];
+
+        Local_u32PriMask = SPIBUS_EnterCritical();
+
+        Local_u8NextHead = (Local_Bus->Head + 1U) & SPIBUS_QUEUE_MASK;
+
+        if (Local_u8NextHead == Local_Bus->Tail)
+        {
+            Local_u8ErrorStatus = SPIBUS_QUEUE_FULL;
+        }
+        else
+        {
+            Local_Bus->Queue[Local_Bus->Head] = Transaction;
+            Local_Bus->Head = Local_u8NextHead;
+
+            /* An Idle Bus Starts Right Away , Otherwise The Running Transaction Starts it When it Ends */
+            if (0U == Local_Bus->Busy)
+            {
+                Local_Bus->Busy = 1;
+
+                SPIBUS_StartNext(Transaction->Device->SPINumber);
+            }
+        }
+
+        SPIBUS_ExitCritical(Local_u32PriMask);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Load The Format of a Device in The Bus , Only if it Differs From The Loaded One
+ * @fn     : SPIBUS_SelectDevice
+ * @param  : Device => This Parameter is Used to Pass The Device Descriptor
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIBUS_SelectDevice(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    SPIBUS_Bus_t *Local_Bus = &SPIBUS_Bus[Device->SPINumber];
+
+    /* Same Device Again , Nothing to Compare */
+    if (Device != Local_Bus->SelectedDevice)
+    {
+        if ((Device->ClockPolarity != Local_Bus->Config.ClockPolarity) ||
+            (Device->ClockPhase != Local_Bus->Config.ClockPhase) ||
+            (Device->BaudRate != Local_Bus->Config.BaudRate) ||
+            (Device->Direction != Local_Bus->Config.Direction))
+        {
+            Local_Bus->Config.ClockPolarity = Device->ClockPolarity;
+            Local_Bus->Config.ClockPhase = Device->ClockPhase;
+            Local_Bus->Config.BaudRate = Device->BaudRate;
+            Local_Bus->Config.Direction = Device->Direction;
+
+            if (SPI_OK != SPI_SetFrameFormat(&Local_Bus->Config))
+            {
+                Local_u8ErrorStatus = SPIBUS_NOK;
+            }
+        }
+
+        Local_Bus->SelectedDevice = Device;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Switch The Frame Size of a Bus , Only if it Differs From The Loaded One
+ * @fn     : SPIBUS_SetDataWidth
+ * @param  : SPINumber => This Parameter is Used to Select The Bus -> @SPI_t
+ * @param  : DataWidth => This Parameter is Used to Pass The Frame Size -> @SPI_DATA_SIZE_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIBUS_SetDataWidth(SPI_t SPINumber, SPI_DATA_SIZE_t DataWidth)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    SPIBUS_Bus_t *Local_Bus = &SPIBUS_Bus[SPINumber];
+
+    if (DataWidth != Local_Bus->Config.DataWidth)
+    {
+        Local_Bus->Config.DataWidth = DataWidth;
+
+        if (SPI_OK != SPI_SetFrameFormat(&Local_Bus->Config))
+        {
+            Local_u8ErrorStatus = SPIBUS_NOK;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start The Next Queued Transaction on a Bus , or Mark The Bus Idle
+ * @fn     : SPIBUS_StartNext
+ * @param  : SPINumber => This Parameter is Used to Select The Bus -> @SPI_t
+ * @return : void
+ */
+static void SPIBUS_StartNext(SPI_t SPINumber)
+{
+    SPIBUS_Bus_t *Local_Bus = &SPIBUS_Bus[SPINumber];
+
+    SPIBUS_Transaction_t *Local_Transaction = NULL;
+
+    Local_Bus->Current = NULL;
+
+    /* A Transaction That Fails to Start is Reported & Skipped So The Rest of The Queue Still Runs */
+    while ((NULL == Local_Bus->Current) && (Local_Bus->Tail != Local_Bus->Head))
+    {
+        Local_Transaction = Local_Bus->Queue[Local_Bus->Tail];
+        Local_Bus->Tail = (Local_Bus->Tail + 1U) & SPIBUS_QUEUE_MASK;
+
+        SPIBUS_SelectDevice(Local_Transaction->Device);
+
+        GPIO_u8SetPinValue(Local_Transaction->Device->CSPort, Local_Transaction->Device->CSPin, PIN_LOW);
+
+        if (SPI_OK == SPI_TransferDMA(&Local_Bus->Config, Local_Transaction->TxBuffer, Local_Transaction->RxBuffer,
+                                      Local_Transaction->Size, SPIBUS_DoneCallBack[SPINumber]))
+        {
+            Local_Bus->Current = Local_Transaction;
+        }
+        else
+        {
+            GPIO_u8SetPinValue(Local_Transaction->Device->CSPort, Local_Transaction->Device->CSPin, PIN_HIGH);
+
+            if (NULL != Local_Transaction->CallBack)
+            {
+                Local_Transaction->CallBack(SPIBUS_NOK);
+            }
+        }
+    }
+
+    if (NULL == Local_Bus->Current)
+    {
+        Local_Bus->Busy = 0;
+    }
+}
+
+/**
+ * @brief  : This Function is Used to End The Running Queued Transaction & Start The Next One
+ * @fn     : SPIBUS_TransferDone
+ * @param  : SPINumber => This Parameter is Used to Select The Bus -> @SPI_t
+ * @param  : Status    => This Parameter is Used to Pass The Transfer Result
+ * @return : void
+ */
+static void SPIBUS_TransferDone(SPI_t SPINumber, ERRORS_t Status)
+{
+    SPIBUS_Bus_t *Local_Bus = &SPIBUS_Bus[SPINumber];
+
+    SPIBUS_Transaction_t *Local_Transaction = Local_Bus->Current;
+
+    uint32_t Local_u32PriMask = 0;
+
+    if (NULL != Local_Transaction)
+    {
+        GPIO_u8SetPinValue(Local_Transaction->Device->CSPort, Local_Transaction->Device->CSPin, PIN_HIGH);
+
+        if (NULL != Local_Transaction->CallBack)
+        {
+            Local_Transaction->CallBack((SPI_OK == Status) ? SPIBUS_OK : SPIBUS_NOK);
+        }
+    }
+
+    Local_u32PriMask = SPIBUS_EnterCritical();
+
+    SPIBUS_StartNext(SPINumber);
+
+    SPIBUS_ExitCritical(Local_u32PriMask);
+}
+
+/* SPI_TransferDMA CallBacks */
+static void SPIBUS_SPI1Done(ERRORS_t Status)
+{
+    SPIBUS_TransferDone(SPI1_APB2, Status);
+}
+
+static void SPIBUS_SPI2Done(ERRORS_t Status)
+{
+    SPIBUS_TransferDone(SPI2_APB1, Status);
+}
@@ -0,0 +1,29 @@
+/*
+ ******************************************************************************
+ * @file           : SPIFLASH_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPIFLASH Configuration Header file
+ * @Date           : Sep 22, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SPIFLASH_INC_SPIFLASH_CONFIG_H_
+#define SPIFLASH_INC_SPIFLASH_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Status Register Reads Before a Program or Erase is Reported as TIME_OUT_ERROR
+ * A Chip Erase Takes Up to 50 s on a W25Q32 , Which is About 20 Million Reads at 18 MHz */
+#define SPIFLASH_BUSY_POLL_LIMIT 50000000UL
+
+/* Largest Part of a Fast Read Moved By One Bus Exchange , The Chip Select Stays Low Between Parts */
+#define SPIFLASH_READ_CHUNK_SIZE 0x8000U
+
+#endif /* SPIFLASH_INC_SPIFLASH_CONFIG_H_ */
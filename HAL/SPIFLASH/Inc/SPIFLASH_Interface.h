@@ -0,0 +1,135 @@
+/*
+ ******************************************************************************
+ * @file           : SPIFLASH_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPIFLASH Interface Header file
+ * @Date           : Sep 22, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SPIFLASH_INC_SPIFLASH_INTERFACE_H_
+#define SPIFLASH_INC_SPIFLASH_INTERFACE_H_
+
+/* ======================================================================
+ * SPIFLASH MACROS
+ * ====================================================================== */
+
+#define SPIFLASH_PAGE_SIZE   256UL
+#define SPIFLASH_SECTOR_SIZE 4096UL
+#define SPIFLASH_BLOCK_SIZE  65536UL
+
+/* ======================================================================
+ * SPIFLASH Option Structs
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds One SPI NOR Flash ( W25Qxx or Compatible )
+ * @struct: @SPIFLASH_Handle_t
+ * @note  : Only Device is Set By The Application , The Other Fields Are Filled & Updated By The Driver
+ */
+typedef struct
+{
+    const SPIBUS_Device_t *Device; /* Bus Device of The Flash , Its Bus Must Be Initialized By SPIBUS_Init */
+    uint32_t JedecId;              /* Manufacturer << 16 | Memory Type << 8 | Capacity */
+    uint32_t Size;                 /* In Bytes */
+    uint8_t WriteInProgress;       /* A Program or Erase Was Issued & Not Waited For Yet */
+
+} SPIFLASH_Handle_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Wake The Flash Up , Read Its JEDEC ID & Size
+ * @fn     : SPIFLASH_Init
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle With Its Device Set -> @SPIFLASH_Handle_t
+ * @return : ERRORS_t => SPIFLASH_NOT_FOUND if No Flash With 24 Bits Addressing Answers The JEDEC ID Instruction
+ * @note   : The Chip Select Pin is Initialized Here , a Program or Erase Left Running By a Reset is Waited For
+ */
+ERRORS_t SPIFLASH_Init(SPIFLASH_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Read Data From The Flash Using Fast Read ( 0x0B )
+ * @fn     : SPIFLASH_Read
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass The Flash Address to Start Reading From
+ * @param  : Buffer  => This Parameter is Used to Pass The Buffer The Data is Stored in
+ * @param  : Length  => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Data is Clocked Straight Into The Buffer in One Instruction , Whatever The Length
+ */
+ERRORS_t SPIFLASH_Read(SPIFLASH_Handle_t *Handle, uint32_t Address, uint8_t *Buffer, uint32_t Length);
+
+/**
+ * @brief  : This Function is Used to Program Data Into The Flash , Split Into Page Programs
+ * @fn     : SPIFLASH_Write
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass The Flash Address to Start Programming From
+ * @param  : Buffer  => This Parameter is Used to Pass The Data to Program
+ * @param  : Length  => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Programming Only Clears Bits , So The Area Must Be Erased First
+ *           Each Page is Sent As Soon as The Previous One is Programmed , & The Function Returns While The Last One
+ *           is Still Programming , The Next Flash Function Waits For it
+ */
+ERRORS_t SPIFLASH_Write(SPIFLASH_Handle_t *Handle, uint32_t Address, const uint8_t *Buffer, uint32_t Length);
+
+/**
+ * @brief  : This Function is Used to Erase The 4 KB Sector Holding an Address
+ * @fn     : SPIFLASH_EraseSector
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass an Address Inside The Sector
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns Once The Erase is Started , Use SPIFLASH_IsBusy or SPIFLASH_WaitReady to Follow it
+ */
+ERRORS_t SPIFLASH_EraseSector(SPIFLASH_Handle_t *Handle, uint32_t Address);
+
+/**
+ * @brief  : This Function is Used to Erase The 64 KB Block Holding an Address
+ * @fn     : SPIFLASH_EraseBlock
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass an Address Inside The Block
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns Once The Erase is Started , Use SPIFLASH_IsBusy or SPIFLASH_WaitReady to Follow it
+ */
+ERRORS_t SPIFLASH_EraseBlock(SPIFLASH_Handle_t *Handle, uint32_t Address);
+
+/**
+ * @brief  : This Function is Used to Erase The Whole Flash
+ * @fn     : SPIFLASH_EraseChip
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Returns Once The Erase is Started , Use SPIFLASH_IsBusy or SPIFLASH_WaitReady to Follow it
+ */
+ERRORS_t SPIFLASH_EraseChip(SPIFLASH_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Check if The Last Program or Erase is Still Running
+ * @fn     : SPIFLASH_IsBusy
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @param  : Busy   => This Parameter is Used to Return 1 While Running , 0 Otherwise
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Status Register is Only Read While an Operation is Pending , Otherwise No Bus Traffic is Made
+ */
+ERRORS_t SPIFLASH_IsBusy(SPIFLASH_Handle_t *Handle, uint8_t *Busy);
+
+/**
+ * @brief  : This Function is Used to Wait Until The Last Program or Erase Ends
+ * @fn     : SPIFLASH_WaitReady
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => TIME_OUT_ERROR if The Flash is Still Busy After SPIFLASH_BUSY_POLL_LIMIT Status Reads
+ * @note   : The Bus is Released Between Status Reads , So Queued Transactions of Other Devices Keep Running
+ */
+ERRORS_t SPIFLASH_WaitReady(SPIFLASH_Handle_t *Handle);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* SPIFLASH_INC_SPIFLASH_INTERFACE_H_ */
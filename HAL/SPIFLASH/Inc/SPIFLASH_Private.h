@@ -0,0 +1,104 @@
+/*
+ ******************************************************************************
+ * @file           : SPIFLASH_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : SPIFLASH Private Header file
+ * @Date           : Sep 22, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef SPIFLASH_INC_SPIFLASH_PRIVATE_H_
+#define SPIFLASH_INC_SPIFLASH_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+/* Instructions */
+#define SPIFLASH_CMD_WRITE_ENABLE       0x06U
+#define SPIFLASH_CMD_READ_STATUS1       0x05U
+#define SPIFLASH_CMD_PAGE_PROGRAM       0x02U
+#define SPIFLASH_CMD_FAST_READ          0x0BU
+#define SPIFLASH_CMD_SECTOR_ERASE       0x20U
+#define SPIFLASH_CMD_BLOCK_ERASE        0xD8U
+#define SPIFLASH_CMD_CHIP_ERASE         0xC7U
+#define SPIFLASH_CMD_RELEASE_POWER_DOWN 0xABU
+#define SPIFLASH_CMD_JEDEC_ID           0x9FU
+
+/* Status Register 1 Bits */
+#define SPIFLASH_STATUS_BUSY 0x01U
+
+/* Instruction + 24 Bits Address , Fast Read Adds One Dummy Byte */
+#define SPIFLASH_HEADER_SIZE           4U
+#define SPIFLASH_FAST_READ_HEADER_SIZE 5U
+
+/* JEDEC Capacity Byte is Log2 of The Size in Bytes , 24 Bits Addressing Reaches 16 MB ( 0x18 ) */
+#define SPIFLASH_MIN_CAPACITY_CODE 0x10U
+#define SPIFLASH_MAX_CAPACITY_CODE 0x18U
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Take The Bus For The Flash , Waiting While Queued Transactions Run on it
+ * @fn     : SPIFLASH_Begin
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_Begin(const SPIFLASH_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Take The Bus & Send an Instruction Followed By a 24 Bits Address , Chip Select is Left Low
+ * @fn     : SPIFLASH_BeginCommand
+ * @param  : Handle     => This Parameter is Used to Pass The Flash Handle
+ * @param  : Command    => This Parameter is Used to Pass The Instruction
+ * @param  : Address    => This Parameter is Used to Pass The Address
+ * @param  : HeaderSize => This Parameter is Used to Pass SPIFLASH_HEADER_SIZE , or SPIFLASH_FAST_READ_HEADER_SIZE to Add The Dummy Byte
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : On Success The Caller Must End The Command With SPIBUS_End
+ */
+static ERRORS_t SPIFLASH_BeginCommand(const SPIFLASH_Handle_t *Handle, uint8_t Command, uint32_t Address, uint8_t HeaderSize);
+
+/**
+ * @brief  : This Function is Used to Send a One Byte Instruction
+ * @fn     : SPIFLASH_SendCommand
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Command => This Parameter is Used to Pass The Instruction
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_SendCommand(const SPIFLASH_Handle_t *Handle, uint8_t Command);
+
+/**
+ * @brief  : This Function is Used to Read Status Register 1
+ * @fn     : SPIFLASH_ReadStatus
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @param  : Status => This Parameter is Used to Return The Register Value
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_ReadStatus(const SPIFLASH_Handle_t *Handle, uint8_t *Status);
+
+/**
+ * @brief  : This Function is Used to Wait For The Last Program or Erase & Set The Write Enable Latch For The Next One
+ * @fn     : SPIFLASH_PrepareWrite
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_PrepareWrite(SPIFLASH_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Issue an Erase Instruction For an Address Inside The Flash
+ * @fn     : SPIFLASH_Erase
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Command => This Parameter is Used to Pass The Erase Instruction
+ * @param  : Address => This Parameter is Used to Pass an Address Inside The Area to Erase
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_Erase(SPIFLASH_Handle_t *Handle, uint8_t Command, uint32_t Address);
+
+#endif /* SPIFLASH_INC_SPIFLASH_PRIVATE_H_ */
@@ -0,0 +1,511 @@
+/*
+ ******************************************************************************
+ * @file           : SPIFLASH_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 22, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../../SPIBUS/Inc/SPIBUS_Interface.h"
+
+#include "../Inc/SPIFLASH_Interface.h"
+#include "../Inc/SPIFLASH_Config.h"
+#include "../Inc/SPIFLASH_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Wake The Flash Up , Read Its JEDEC ID & Size
+ * @fn     : SPIFLASH_Init
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle With Its Device Set -> @SPIFLASH_Handle_t
+ * @return : ERRORS_t => SPIFLASH_NOT_FOUND if No Flash With 24 Bits Addressing Answers The JEDEC ID Instruction
+ */
+ERRORS_t SPIFLASH_Init(SPIFLASH_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    const uint8_t Local_u8JedecCommand[4] = {SPIFLASH_CMD_JEDEC_ID, 0xFF, 0xFF, 0xFF};
+    uint8_t Local_u8JedecId[4] = {0};
+
+    if ((NULL == Handle) || (NULL == Handle->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (SPIBUS_OK != SPIBUS_InitDevice(Handle->Device))
+    {
+        Local_u8ErrorStatus = SPIFLASH_NOK;
+    }
+    else
+    {
+        Handle->JedecId = 0;
+        Handle->Size = 0;
+
+        /* A Flash Left in Power Down Ignores Everything Else , & One Left Programming By a Reset Reads as Busy */
+        Handle->WriteInProgress = 1;
+
+        Local_u8ErrorStatus = SPIFLASH_SendCommand(Handle, SPIFLASH_CMD_RELEASE_POWER_DOWN);
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SPIFLASH_WaitReady(Handle);
+        }
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SPIFLASH_Begin(Handle);
+        }
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            if (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, Local_u8JedecCommand, Local_u8JedecId, sizeof(Local_u8JedecId)))
+            {
+                Local_u8ErrorStatus = SPIFLASH_NOK;
+            }
+
+            SPIBUS_End(Handle->Device);
+        }
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            /* A Floating or Shorted MISO Reads All Ones or All Zeros */
+            if ((0x00U == Local_u8JedecId[1]) || (0xFFU == Local_u8JedecId[1]) ||
+                (Local_u8JedecId[3] < SPIFLASH_MIN_CAPACITY_CODE) || (Local_u8JedecId[3] > SPIFLASH_MAX_CAPACITY_CODE))
+            {
+                Local_u8ErrorStatus = SPIFLASH_NOT_FOUND;
+            }
+            else
+            {
+                Handle->JedecId = ((uint32_t)Local_u8JedecId[1] << 16) | ((uint32_t)Local_u8JedecId[2] << 8) | Local_u8JedecId[3];
+                Handle->Size = (1UL << Local_u8JedecId[3]);
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read Data From The Flash Using Fast Read ( 0x0B )
+ * @fn     : SPIFLASH_Read
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass The Flash Address to Start Reading From
+ * @param  : Buffer  => This Parameter is Used to Pass The Buffer The Data is Stored in
+ * @param  : Length  => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIFLASH_Read(SPIFLASH_Handle_t *Handle, uint32_t Address, uint8_t *Buffer, uint32_t Length)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    uint16_t Local_u16Chunk = 0;
+
+    if ((NULL == Handle) || (NULL == Handle->Device) || (NULL == Buffer))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((0U == Length) || (Length > Handle->Size) || (Address > (Handle->Size - Length)))
+    {
+        Local_u8ErrorStatus = SPIFLASH_NOK;
+    }
+    else
+    {
+        /* A Read Issued During a Program or Erase Would Be Ignored By The Flash */
+        Local_u8ErrorStatus = SPIFLASH_WaitReady(Handle);
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SPIFLASH_BeginCommand(Handle, SPIFLASH_CMD_FAST_READ, Address, SPIFLASH_FAST_READ_HEADER_SIZE);
+        }
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            /* The Flash Keeps Streaming Consecutive Bytes While Chip Select is Low */
+            while ((SPIFLASH_OK == Local_u8ErrorStatus) && (Length > 0U))
+            {
+                Local_u16Chunk = (Length > SPIFLASH_READ_CHUNK_SIZE) ? SPIFLASH_READ_CHUNK_SIZE : (uint16_t)Length;
+
+                if (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, NULL, Buffer, Local_u16Chunk))
+                {
+                    Local_u8ErrorStatus = SPIFLASH_NOK;
+                }
+
+                Buffer += Local_u16Chunk;
+                Length -= Local_u16Chunk;
+            }
+
+            SPIBUS_End(Handle->Device);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Program Data Into The Flash , Split Into Page Programs
+ * @fn     : SPIFLASH_Write
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass The Flash Address to Start Programming From
+ * @param  : Buffer  => This Parameter is Used to Pass The Data to Program
+ * @param  : Length  => This Parameter is Used to Pass The Number of Bytes
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIFLASH_Write(SPIFLASH_Handle_t *Handle, uint32_t Address, const uint8_t *Buffer, uint32_t Length)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    uint16_t Local_u16Chunk = 0;
+
+    if ((NULL == Handle) || (NULL == Handle->Device) || (NULL == Buffer))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((0U == Length) || (Length > Handle->Size) || (Address > (Handle->Size - Length)))
+    {
+        Local_u8ErrorStatus = SPIFLASH_NOK;
+    }
+    else
+    {
+        while ((SPIFLASH_OK == Local_u8ErrorStatus) && (Length > 0U))
+        {
+            /* A Page Program Wraps Inside Its Page , So Never Cross a Page Boundary */
+            Local_u16Chunk = (uint16_t)(SPIFLASH_PAGE_SIZE - (Address & (SPIFLASH_PAGE_SIZE - 1UL)));
+
+            if (Local_u16Chunk > Length)
+            {
+                Local_u16Chunk = (uint16_t)Length;
+            }
+
+            /* Waits For The Previous Page Only Now , So The Last Page Programs While The Caller Runs */
+            Local_u8ErrorStatus = SPIFLASH_PrepareWrite(Handle);
+
+            if (SPIFLASH_OK == Local_u8ErrorStatus)
+            {
+                Local_u8ErrorStatus = SPIFLASH_BeginCommand(Handle, SPIFLASH_CMD_PAGE_PROGRAM, Address, SPIFLASH_HEADER_SIZE);
+            }
+
+            if (SPIFLASH_OK == Local_u8ErrorStatus)
+            {
+                /* The Data is Clocked Straight From The Caller Buffer , No Staging Copy */
+                if (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, Buffer, NULL, Local_u16Chunk))
+                {
+                    Local_u8ErrorStatus = SPIFLASH_NOK;
+                }
+
+                /* Programming Starts on The Chip Select Rising Edge */
+                SPIBUS_End(Handle->Device);
+
+                Handle->WriteInProgress = 1;
+            }
+
+            Address += Local_u16Chunk;
+            Buffer += Local_u16Chunk;
+            Length -= Local_u16Chunk;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Erase The 4 KB Sector Holding an Address
+ * @fn     : SPIFLASH_EraseSector
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass an Address Inside The Sector
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIFLASH_EraseSector(SPIFLASH_Handle_t *Handle, uint32_t Address)
+{
+    return SPIFLASH_Erase(Handle, SPIFLASH_CMD_SECTOR_ERASE, Address);
+}
+
+/**
+ * @brief  : This Function is Used to Erase The 64 KB Block Holding an Address
+ * @fn     : SPIFLASH_EraseBlock
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Address => This Parameter is Used to Pass an Address Inside The Block
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIFLASH_EraseBlock(SPIFLASH_Handle_t *Handle, uint32_t Address)
+{
+    return SPIFLASH_Erase(Handle, SPIFLASH_CMD_BLOCK_ERASE, Address);
+}
+
+/**
+ * @brief  : This Function is Used to Erase The Whole Flash
+ * @fn     : SPIFLASH_EraseChip
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIFLASH_EraseChip(SPIFLASH_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    if ((NULL == Handle) || (NULL == Handle->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (0U == Handle->Size)
+    {
+        Local_u8ErrorStatus = SPIFLASH_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SPIFLASH_PrepareWrite(Handle);
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SPIFLASH_SendCommand(Handle, SPIFLASH_CMD_CHIP_ERASE);
+        }
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            Handle->WriteInProgress = 1;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Check if The Last Program or Erase is Still Running
+ * @fn     : SPIFLASH_IsBusy
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @param  : Busy   => This Parameter is Used to Return 1 While Running , 0 Otherwise
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPIFLASH_IsBusy(SPIFLASH_Handle_t *Handle, uint8_t *Busy)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    uint8_t Local_u8Status = 0;
+
+    if ((NULL == Handle) || (NULL == Handle->Device) || (NULL == Busy))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        if (Handle->WriteInProgress)
+        {
+            Local_u8ErrorStatus = SPIFLASH_ReadStatus(Handle, &Local_u8Status);
+
+            if ((SPIFLASH_OK == Local_u8ErrorStatus) && (0U == (Local_u8Status & SPIFLASH_STATUS_BUSY)))
+            {
+                Handle->WriteInProgress = 0;
+            }
+        }
+
+        *Busy = Handle->WriteInProgress;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Wait Until The Last Program or Erase Ends
+ * @fn     : SPIFLASH_WaitReady
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => TIME_OUT_ERROR if The Flash is Still Busy After SPIFLASH_BUSY_POLL_LIMIT Status Reads
+ */
+ERRORS_t SPIFLASH_WaitReady(SPIFLASH_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    uint8_t Local_u8Busy = 0;
+
+    uint32_t Local_u32Polls = 0;
+
+    do
+    {
+        Local_u8ErrorStatus = SPIFLASH_IsBusy(Handle, &Local_u8Busy);
+
+        Local_u32Polls++;
+
+    } while ((SPIFLASH_OK == Local_u8ErrorStatus) && Local_u8Busy && (Local_u32Polls < SPIFLASH_BUSY_POLL_LIMIT));
+
+    if ((SPIFLASH_OK == Local_u8ErrorStatus) && Local_u8Busy)
+    {
+        Local_u8ErrorStatus = TIME_OUT_ERROR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Take The Bus For The Flash , Waiting While Queued Transactions Run on it
+ * @fn     : SPIFLASH_Begin
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_Begin(const SPIFLASH_Handle_t *Handle)
+{
+    ERRORS_t Local_u8BusStatus = SPIBUS_OK;
+
+    do
+    {
+        Local_u8BusStatus = SPIBUS_Begin(Handle->Device);
+
+    } while (SPIBUS_BUSY == Local_u8BusStatus);
+
+    return (SPIBUS_OK == Local_u8BusStatus) ? SPIFLASH_OK : SPIFLASH_NOK;
+}
+
+/**
+ * @brief  : This Function is Used to Take The Bus & Send an Instruction Followed By a 24 Bits Address , Chip Select is Left Low
+ * @fn     : SPIFLASH_BeginCommand
+ * @param  : Handle     => This Parameter is Used to Pass The Flash Handle
+ * @param  : Command    => This Parameter is Used to Pass The Instruction
+ * @param  : Address    => This Parameter is Used to Pass The Address
+ * @param  : HeaderSize => This Parameter is Used to Pass SPIFLASH_HEADER_SIZE , or SPIFLASH_FAST_READ_HEADER_SIZE to Add The Dummy Byte
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_BeginCommand(const SPIFLASH_Handle_t *Handle, uint8_t Command, uint32_t Address, uint8_t HeaderSize)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    /* Address is Sent Most Significant Byte First */
+    const uint8_t Local_u8Header[SPIFLASH_FAST_READ_HEADER_SIZE] = {Command, (uint8_t)(Address >> 16), (uint8_t)(Address >> 8),
+                                                                    (uint8_t)Address, 0xFF};
+
+    Local_u8ErrorStatus = SPIFLASH_Begin(Handle);
+
+    if ((SPIFLASH_OK == Local_u8ErrorStatus) && (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, Local_u8Header, NULL, HeaderSize)))
+    {
+        SPIBUS_End(Handle->Device);
+
+        Local_u8ErrorStatus = SPIFLASH_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send a One Byte Instruction
+ * @fn     : SPIFLASH_SendCommand
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Command => This Parameter is Used to Pass The Instruction
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_SendCommand(const SPIFLASH_Handle_t *Handle, uint8_t Command)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_Begin(Handle);
+
+    if (SPIFLASH_OK == Local_u8ErrorStatus)
+    {
+        if (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, &Command, NULL, 1U))
+        {
+            Local_u8ErrorStatus = SPIFLASH_NOK;
+        }
+
+        SPIBUS_End(Handle->Device);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read Status Register 1
+ * @fn     : SPIFLASH_ReadStatus
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @param  : Status => This Parameter is Used to Return The Register Value
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_ReadStatus(const SPIFLASH_Handle_t *Handle, uint8_t *Status)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_Begin(Handle);
+
+    const uint8_t Local_u8Command[2] = {SPIFLASH_CMD_READ_STATUS1, 0xFF};
+    uint8_t Local_u8Response[2] = {0};
+
+    if (SPIFLASH_OK == Local_u8ErrorStatus)
+    {
+        if (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, Local_u8Command, Local_u8Response, 2U))
+        {
+            Local_u8ErrorStatus = SPIFLASH_NOK;
+        }
+
+        SPIBUS_End(Handle->Device);
+
+        *Status = Local_u8Response[1];
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Wait For The Last Program or Erase & Set The Write Enable Latch For The Next One
+ * @fn     : SPIFLASH_PrepareWrite
+ * @param  : Handle => This Parameter is Used to Pass The Flash Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_PrepareWrite(SPIFLASH_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_WaitReady(Handle);
+
+    /* The Latch is Cleared By The Flash at The End of Every Program or Erase */
+    if (SPIFLASH_OK == Local_u8ErrorStatus)
+    {
+        Local_u8ErrorStatus = SPIFLASH_SendCommand(Handle, SPIFLASH_CMD_WRITE_ENABLE);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Issue an Erase Instruction For an Address Inside The Flash
+ * @fn     : SPIFLASH_Erase
+ * @param  : Handle  => This Parameter is Used to Pass The Flash Handle
+ * @param  : Command => This Parameter is Used to Pass The Erase Instruction
+ * @param  : Address => This Parameter is Used to Pass an Address Inside The Area to Erase
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPIFLASH_Erase(SPIFLASH_Handle_t *Handle, uint8_t Command, uint32_t Address)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIFLASH_OK;
+
+    if ((NULL == Handle) || (NULL == Handle->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (Address >= Handle->Size)
+    {
+        Local_u8ErrorStatus = SPIFLASH_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SPIFLASH_PrepareWrite(Handle);
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = SPIFLASH_BeginCommand(Handle, Command, Address, SPIFLASH_HEADER_SIZE);
+        }
+
+        if (SPIFLASH_OK == Local_u8ErrorStatus)
+        {
+            /* Erasing Starts on The Chip Select Rising Edge */
+            SPIBUS_End(Handle->Device);
+
+            Handle->WriteInProgress = 1;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
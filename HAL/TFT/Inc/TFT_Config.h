@@ -0,0 +1,29 @@
+/*
+ ******************************************************************************
+ * @file           : TFT_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : TFT Configuration Header file
+ * @Date           : Sep 28, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef TFT_INC_TFT_CONFIG_H_
+#define TFT_INC_TFT_CONFIG_H_
+
+/* ======================================================================
+ * CONFIGURATION PARAMETERS
+ * ====================================================================== */
+
+/* Dirty Rectangles Each Display Tracks Between Two TFT_Flush Calls
+ * When All Are Used a New One is Merged Into The One That Grows The Least */
+#define TFT_DIRTY_RECTS_MAX 4U
+
+/* Pixels in The Stack Buffer a Solid Fill is Streamed From , Each Chunk is One SPI Transfer */
+#define TFT_FILL_CHUNK_SIZE 32U
+
+#endif /* TFT_INC_TFT_CONFIG_H_ */
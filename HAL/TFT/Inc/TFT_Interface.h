@@ -0,0 +1,179 @@
+/*
+ ******************************************************************************
+ * @file           : TFT_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : TFT Interface Header file
+ * @Date           : Sep 28, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef TFT_INC_TFT_INTERFACE_H_
+#define TFT_INC_TFT_INTERFACE_H_
+
+#include "TFT_Config.h"
+
+/* ======================================================================
+ * TFT MACROS
+ * ====================================================================== */
+
+/* Packs 8 Bits Red , Green & Blue Into One RGB565 Pixel */
+#define TFT_RGB565(RED, GREEN, BLUE) ((uint16_t)((((RED) & 0xF8U) << 8) | (((GREEN) & 0xFCU) << 3) | ((BLUE) >> 3)))
+
+#define TFT_COLOR_BLACK 0x0000U
+#define TFT_COLOR_WHITE 0xFFFFU
+#define TFT_COLOR_RED   0xF800U
+#define TFT_COLOR_GREEN 0x07E0U
+#define TFT_COLOR_BLUE  0x001FU
+
+/* ======================================================================
+ * TFT Option Enums
+ * ====================================================================== */
+
+/**
+ * @brief : This Enum Holds Values of The Supported Controllers
+ * @enum  : @TFT_Controller_t
+ */
+typedef enum
+{
+    TFT_ST7735 = 0,  /* Up to 132 x 162 , 128 x 160 & 128 x 128 Panels */
+    TFT_ILI9341 = 1, /* 240 x 320 */
+
+} TFT_Controller_t;
+
+/**
+ * @brief : This Enum Holds Values of The Memory Access Control ( MADCTL ) Scan Directions
+ * @enum  : @TFT_Orientation_t
+ * @note  : Panels Are Mounted Differently , Pick The One That Shows The Image Upright
+ */
+typedef enum
+{
+    TFT_PORTRAIT = 0x00,
+    TFT_LANDSCAPE = 0x60,         /* Rows & Columns Exchanged , Columns Mirrored */
+    TFT_PORTRAIT_FLIPPED = 0xC0,  /* Rows & Columns Mirrored */
+    TFT_LANDSCAPE_FLIPPED = 0xA0, /* Rows & Columns Exchanged , Rows Mirrored */
+
+} TFT_Orientation_t;
+
+/**
+ * @brief : This Enum Holds Values of The Panel Sub Pixel Order
+ * @enum  : @TFT_ColorOrder_t
+ */
+typedef enum
+{
+    TFT_RGB = 0x00,
+    TFT_BGR = 0x08, /* Most ILI9341 Panels & Some ST7735 Ones , Red & Blue Appear Swapped Otherwise */
+
+} TFT_ColorOrder_t;
+
+/* ======================================================================
+ * TFT Option Structs
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds a Rectangle in Display Pixels
+ * @struct: @TFT_Rect_t
+ */
+typedef struct
+{
+    uint16_t X;      /* Left Column */
+    uint16_t Y;      /* Top Row */
+    uint16_t Width;
+    uint16_t Height;
+
+} TFT_Rect_t;
+
+/**
+ * @brief : This Struct Holds One Display Connected Over SPI
+ * @struct: @TFT_Handle_t
+ * @note  : DirtyRects & DirtyCount Are Managed By The Driver , The Other Fields Are Set By The Application
+ */
+typedef struct
+{
+    const SPIBUS_Device_t *Device;      /* Mode 0 , MSB First , ST7735 Up to 15 MHz & ILI9341 Up to 10 MHz For Writes */
+    Port_t DCPort;                      /* Data / Command Select , Low For Commands */
+    Pin_t DCPin;
+    Port_t RSTPort;                     /* Hardware Reset , Active Low */
+    Pin_t RSTPin;
+    TFT_Controller_t Controller;        /* @TFT_Controller_t */
+    TFT_Orientation_t Orientation;      /* @TFT_Orientation_t */
+    TFT_ColorOrder_t ColorOrder;        /* @TFT_ColorOrder_t */
+    uint16_t Width;                     /* Pixels as Seen in The Selected Orientation */
+    uint16_t Height;
+    uint16_t XOffset;                   /* Panel Position Inside The Controller Memory ( e.g. 2 & 1 For Some 128 x 160 ST7735 ) */
+    uint16_t YOffset;
+    uint16_t *FrameBuffer;              /* Width x Height RGB565 Pixels , Row After Row , Used By TFT_Flush ( NULL if Not Used ) */
+    TFT_Rect_t DirtyRects[TFT_DIRTY_RECTS_MAX];
+    uint8_t DirtyCount;
+
+} TFT_Handle_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Reset a Display , Run The Controller Initialization Sequence & Turn it on
+ * @fn     : TFT_Init
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle -> @TFT_Handle_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The GPIO Port Clocks Must Be Enabled & SYSTICK Initialized , The Sequence Waits About 300 ms
+ *           The Panel Content is Undefined After Init , Clear it With TFT_FillRect
+ */
+ERRORS_t TFT_Init(TFT_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Write a Block of Pixels to a Region of The Display
+ * @fn     : TFT_WriteRegion
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Region , Must Lie Inside The Display -> @TFT_Rect_t
+ * @param  : Pixels => This Parameter is Used to Pass ( Region Width x Region Height ) RGB565 Pixels , Row After Row
+ * @return : ERRORS_t => TFT_NOK if The Region Does Not Lie Inside The Display
+ * @note   : The Region is Addressed With CASET / RASET Then The Pixels Are Streamed After One RAMWR
+ *           When a Frame Buffer is Attached it is Updated Too , So a Later TFT_Flush Does Not Bring Back Old Pixels
+ */
+ERRORS_t TFT_WriteRegion(TFT_Handle_t *Handle, const TFT_Rect_t *Region, const uint16_t *Pixels);
+
+/**
+ * @brief  : This Function is Used to Fill a Region of The Display With One Color
+ * @fn     : TFT_FillRect
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Region , Must Lie Inside The Display -> @TFT_Rect_t
+ * @param  : Color  => This Parameter is Used to Pass The RGB565 Color
+ * @return : ERRORS_t => TFT_NOK if The Region Does Not Lie Inside The Display
+ * @note   : The Color is Sent as a Run , Repeated From a TFT_FILL_CHUNK_SIZE Pixels Buffer , So No Frame Buffer is Needed
+ *           When a Frame Buffer is Attached it is Updated Too
+ */
+ERRORS_t TFT_FillRect(TFT_Handle_t *Handle, const TFT_Rect_t *Region, uint16_t Color);
+
+/**
+ * @brief  : This Function is Used to Mark a Region of The Frame Buffer as Changed
+ * @fn     : TFT_Invalidate
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Changed Region , Must Lie Inside The Display -> @TFT_Rect_t
+ * @return : ERRORS_t => TFT_NOK if The Region Does Not Lie Inside The Display or No Frame Buffer is Attached
+ * @note   : Regions Are Merged When The Union Costs No More Pixels Than Sending Both ( Overlapping or Side by Side )
+ *           When TFT_DIRTY_RECTS_MAX Are Tracked The Region is Merged Into The One That Grows The Least ,
+ *           So Some Unchanged Pixels May Be Sent Again But None is Missed
+ */
+ERRORS_t TFT_Invalidate(TFT_Handle_t *Handle, const TFT_Rect_t *Region);
+
+/**
+ * @brief  : This Function is Used to Send The Dirty Regions of The Frame Buffer to The Display & Clear Them
+ * @fn     : TFT_Flush
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @return : ERRORS_t => TFT_NOK if No Frame Buffer is Attached
+ * @note   : All Regions Are Sent Under One Chip Select , Each Pixel Row of a Region is One 16 Bit Frames Transfer
+ *           Nothing is Sent When No Region Was Invalidated
+ */
+ERRORS_t TFT_Flush(TFT_Handle_t *Handle);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* TFT_INC_TFT_INTERFACE_H_ */
@@ -0,0 +1,136 @@
+/*
+ ******************************************************************************
+ * @file           : TFT_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : TFT Private Header file
+ * @Date           : Sep 28, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef TFT_INC_TFT_PRIVATE_H_
+#define TFT_INC_TFT_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+/* Commands Shared By Both Controllers */
+#define TFT_CMD_NOP     0x00U
+#define TFT_CMD_SWRESET 0x01U /* Software Reset */
+#define TFT_CMD_SLPOUT  0x11U /* Sleep Out */
+#define TFT_CMD_NORON   0x13U /* Normal Display Mode On */
+#define TFT_CMD_INVOFF  0x20U /* Display Inversion Off */
+#define TFT_CMD_GAMSET  0x26U /* Gamma Curve Select */
+#define TFT_CMD_DISPON  0x29U /* Display On */
+#define TFT_CMD_CASET   0x2AU /* Column Address Set */
+#define TFT_CMD_RASET   0x2BU /* Row Address Set */
+#define TFT_CMD_RAMWR   0x2CU /* Memory Write */
+#define TFT_CMD_MADCTL  0x36U /* Memory Data Access Control */
+#define TFT_CMD_COLMOD  0x3AU /* Interface Pixel Format */
+
+/* Initialization Sequences : Command , Argument Count ( | TFT_INIT_DELAY ) , Arguments , [ Delay in ms ] */
+#define TFT_INIT_DELAY      0x80U /* a Delay Byte Follows The Arguments */
+#define TFT_INIT_COUNT_MASK 0x7FU
+#define TFT_INIT_END        0xFFU /* Not a Command of Either Controller */
+
+#define TFT_RESET_PULSE_MS 1U   /* Reset Low Time , 10 us Min */
+#define TFT_RESET_WAIT_MS  150U /* Reset Completion , 120 ms Max */
+
+/* Pixels Per 16 Bit Frames Transfer When Whole Rows Are Contiguous in The Frame Buffer */
+#define TFT_STREAM_CHUNK_SIZE 0x8000U
+
+/* ======================================================================
+ * PRIVATE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Take The Bus & Select The Display , Waiting While Queued Transactions Run on it
+ * @fn     : TFT_Select
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_Select(const TFT_Handle_t *Handle);
+
+/**
+ * @brief  : This Function is Used to Send a Command & Its Arguments in 8 Bit Frames
+ * @fn     : TFT_WriteCommand
+ * @param  : Handle    => This Parameter is Used to Pass The Selected Display
+ * @param  : Command   => This Parameter is Used to Pass The Command
+ * @param  : Arguments => This Parameter is Used to Pass The Argument Bytes
+ * @param  : Count     => This Parameter is Used to Pass The Number of Argument Bytes ( May Be 0 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_WriteCommand(const TFT_Handle_t *Handle, uint8_t Command, const uint8_t *Arguments, uint8_t Count);
+
+/**
+ * @brief  : This Function is Used to Send a Command & Its Arguments in 16 Bit Frames
+ * @fn     : TFT_WriteCommand16
+ * @param  : Handle    => This Parameter is Used to Pass The Selected Display
+ * @param  : Command   => This Parameter is Used to Pass The Command
+ * @param  : Arguments => This Parameter is Used to Pass The 16 Bit Arguments , Each is Sent High Byte First
+ * @param  : Count     => This Parameter is Used to Pass The Number of Argument Frames ( May Be 0 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Command Frame is Led By a NOP Byte , So Drawing Never Switches The Bus Back to 8 Bit Frames
+ */
+static ERRORS_t TFT_WriteCommand16(const TFT_Handle_t *Handle, uint8_t Command, const uint16_t *Arguments, uint8_t Count);
+
+/**
+ * @brief  : This Function is Used to Address a Region & Start a Memory Write , The Pixels Follow in 16 Bit Frames
+ * @fn     : TFT_SetWindow
+ * @param  : Handle => This Parameter is Used to Pass The Selected Display
+ * @param  : Region => This Parameter is Used to Pass The Region
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_SetWindow(const TFT_Handle_t *Handle, const TFT_Rect_t *Region);
+
+/**
+ * @brief  : This Function is Used to Stream Pixels After a Memory Write , Splitting Them Into Transfers of Up to TFT_STREAM_CHUNK_SIZE
+ * @fn     : TFT_WritePixels
+ * @param  : Handle => This Parameter is Used to Pass The Selected Display
+ * @param  : Pixels => This Parameter is Used to Pass The RGB565 Pixels
+ * @param  : Count  => This Parameter is Used to Pass The Number of Pixels
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_WritePixels(const TFT_Handle_t *Handle, const uint16_t *Pixels, uint32_t Count);
+
+/**
+ * @brief  : This Function is Used to Check That a Region is Not Empty & Lies Inside The Display
+ * @fn     : TFT_CheckRegion
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Region
+ * @return : ERRORS_t => TFT_NOK if The Region is Empty or Crosses an Edge of The Display
+ */
+static ERRORS_t TFT_CheckRegion(const TFT_Handle_t *Handle, const TFT_Rect_t *Region);
+
+/**
+ * @brief  : This Function is Used to Run an Initialization Sequence on The Selected Display
+ * @fn     : TFT_RunSequence
+ * @param  : Handle   => This Parameter is Used to Pass The Selected Display
+ * @param  : Sequence => This Parameter is Used to Pass The Sequence , Ended By TFT_INIT_END
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_RunSequence(const TFT_Handle_t *Handle, const uint8_t *Sequence);
+
+/**
+ * @brief  : Rectangle Helpers Used By The Dirty Regions Tracking ( Private Functions )
+ * @note   : Two Regions Are Worth Merging When Their Union Costs No More Pixels Than Sending Both
+ */
+static uint8_t TFT_RectsMergeable(const TFT_Rect_t *First, const TFT_Rect_t *Second);
+static TFT_Rect_t TFT_RectUnion(const TFT_Rect_t *First, const TFT_Rect_t *Second);
+static uint32_t TFT_RectArea(const TFT_Rect_t *Rect);
+
+/**
+ * @brief  : This Function is Used to Merge Into a Dirty Region Every Other Dirty Region Worth Merging
+ * @fn     : TFT_MergeDirty
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Index  => This Parameter is Used to Pass The Dirty Region That Has Just Grown
+ * @return : void
+ */
+static void TFT_MergeDirty(TFT_Handle_t *Handle, uint8_t Index);
+
+#endif /* TFT_INC_TFT_PRIVATE_H_ */
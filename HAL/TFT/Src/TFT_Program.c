@@ -0,0 +1,706 @@
+/*
+ ******************************************************************************
+ * @file           : TFT_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 28, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../../MCAL/SPI/Inc/SPI_Interface.h"
+#include "../../../MCAL/SYSTICK/Inc/SYSTICK_Interface.h"
+
+#include "../../SPIBUS/Inc/SPIBUS_Interface.h"
+
+#include "../Inc/TFT_Interface.h"
+#include "../Inc/TFT_Config.h"
+#include "../Inc/TFT_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION START
+ *==============================================================================================================================================*/
+
+/* ST7735R Power Up Sequence ( Frame Rate , Power & Gamma From The Datasheet Example ) , 16 Bits Per Pixel */
+static const uint8_t TFT_ST7735_INIT[] = {
+    TFT_CMD_SWRESET, TFT_INIT_DELAY, 150U,
+    TFT_CMD_SLPOUT, TFT_INIT_DELAY, 150U,
+    0xB1U, 3U, 0x01U, 0x2CU, 0x2DU,                   /* FRMCTR1 : Normal Mode Frame Rate */
+    0xB2U, 3U, 0x01U, 0x2CU, 0x2DU,                   /* FRMCTR2 : Idle Mode Frame Rate */
+    0xB3U, 6U, 0x01U, 0x2CU, 0x2DU, 0x01U, 0x2CU, 0x2DU, /* FRMCTR3 : Partial Mode Frame Rate */
+    0xB4U, 1U, 0x07U,                                 /* INVCTR : No Inversion */
+    0xC0U, 3U, 0xA2U, 0x02U, 0x84U,                   /* PWCTR1 */
+    0xC1U, 1U, 0xC5U,                                 /* PWCTR2 */
+    0xC2U, 2U, 0x0AU, 0x00U,                          /* PWCTR3 */
+    0xC3U, 2U, 0x8AU, 0x2AU,                          /* PWCTR4 */
+    0xC4U, 2U, 0x8AU, 0xEEU,                          /* PWCTR5 */
+    0xC5U, 1U, 0x0EU,                                 /* VMCTR1 */
+    TFT_CMD_INVOFF, 0U,
+    TFT_CMD_COLMOD, 1U, 0x05U,                        /* 16 Bits Per Pixel */
+    0xE0U, 16U, 0x02U, 0x1CU, 0x07U, 0x12U, 0x37U, 0x32U, 0x29U, 0x2DU,
+                0x29U, 0x25U, 0x2BU, 0x39U, 0x00U, 0x01U, 0x03U, 0x10U, /* GMCTRP1 */
+    0xE1U, 16U, 0x03U, 0x1DU, 0x07U, 0x06U, 0x2EU, 0x2CU, 0x29U, 0x2DU,
+                0x2EU, 0x2EU, 0x37U, 0x3FU, 0x00U, 0x00U, 0x02U, 0x10U, /* GMCTRN1 */
+    TFT_CMD_NORON, TFT_INIT_DELAY, 10U,
+    TFT_CMD_DISPON, TFT_INIT_DELAY, 100U,
+    TFT_INIT_END,
+};
+
+/* ILI9341 Power Up Sequence ( Power , Timing & Gamma From The Panel Vendors Example ) , 16 Bits Per Pixel */
+static const uint8_t TFT_ILI9341_INIT[] = {
+    TFT_CMD_SWRESET, TFT_INIT_DELAY, 150U,
+    0xCBU, 5U, 0x39U, 0x2CU, 0x00U, 0x34U, 0x02U,     /* Power Control A */
+    0xCFU, 3U, 0x00U, 0xC1U, 0x30U,                   /* Power Control B */
+    0xE8U, 3U, 0x85U, 0x00U, 0x78U,                   /* Driver Timing Control A */
+    0xEAU, 2U, 0x00U, 0x00U,                          /* Driver Timing Control B */
+    0xEDU, 4U, 0x64U, 0x03U, 0x12U, 0x81U,            /* Power On Sequence Control */
+    0xF7U, 1U, 0x20U,                                 /* Pump Ratio Control */
+    0xC0U, 1U, 0x23U,                                 /* Power Control 1 : GVDD = 4.6 V */
+    0xC1U, 1U, 0x10U,                                 /* Power Control 2 */
+    0xC5U, 2U, 0x3EU, 0x28U,                          /* VCOM Control 1 */
+    0xC7U, 1U, 0x86U,                                 /* VCOM Control 2 */
+    TFT_CMD_COLMOD, 1U, 0x55U,                        /* 16 Bits Per Pixel */
+    0xB1U, 2U, 0x00U, 0x18U,                          /* Frame Rate Control : 79 Hz */
+    0xB6U, 3U, 0x08U, 0x82U, 0x27U,                   /* Display Function Control */
+    0xF2U, 1U, 0x00U,                                 /* 3 Gamma Function Disable */
+    TFT_CMD_GAMSET, 1U, 0x01U,                        /* Gamma Curve 1 */
+    0xE0U, 15U, 0x0FU, 0x31U, 0x2BU, 0x0CU, 0x0EU, 0x08U, 0x4EU, 0xF1U,
+                0x37U, 0x07U, 0x10U, 0x03U, 0x0EU, 0x09U, 0x00U, /* Positive Gamma Correction */
+    0xE1U, 15U, 0x00U, 0x0EU, 0x14U, 0x03U, 0x11U, 0x07U, 0x31U, 0xC1U,
+                0x48U, 0x08U, 0x0FU, 0x0CU, 0x31U, 0x36U, 0x0FU, /* Negative Gamma Correction */
+    TFT_CMD_SLPOUT, TFT_INIT_DELAY, 150U,
+    TFT_CMD_DISPON, TFT_INIT_DELAY, 150U,
+    TFT_INIT_END,
+};
+
+static const uint8_t *const TFT_INIT_SEQUENCE[] = {TFT_ST7735_INIT, TFT_ILI9341_INIT};
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Reset a Display , Run The Controller Initialization Sequence & Turn it on
+ * @fn     : TFT_Init
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle -> @TFT_Handle_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t TFT_Init(TFT_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    uint8_t Local_u8MemoryAccess = 0;
+
+    GPIO_PinConfig_t Local_OutputPin = {
+        .Mode = OUTPUT_MAXSPEED_50MHZ,
+        .OutMode = OUTPUT_PUSH_PULL,
+    };
+
+    if ((NULL == Handle) || (NULL == Handle->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Handle->Controller > TFT_ILI9341) || (0U == Handle->Width) || (0U == Handle->Height) ||
+             (SPIBUS_OK != SPIBUS_InitDevice(Handle->Device)))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    else
+    {
+        Handle->DirtyCount = 0;
+
+        /* Latch The Idle Levels First So The Pins Do Not Glitch When They Become Outputs */
+        Local_OutputPin.Port = Handle->DCPort;
+        Local_OutputPin.PinNum = Handle->DCPin;
+
+        if ((OK != GPIO_u8SetPinValue(Handle->DCPort, Handle->DCPin, PIN_HIGH)) ||
+            (OK != GPIO_u8PinInit(&Local_OutputPin)))
+        {
+            Local_u8ErrorStatus = TFT_NOK;
+        }
+
+        Local_OutputPin.Port = Handle->RSTPort;
+        Local_OutputPin.PinNum = Handle->RSTPin;
+
+        if ((OK != GPIO_u8SetPinValue(Handle->RSTPort, Handle->RSTPin, PIN_HIGH)) ||
+            (OK != GPIO_u8PinInit(&Local_OutputPin)))
+        {
+            Local_u8ErrorStatus = TFT_NOK;
+        }
+    }
+
+    if (TFT_OK == Local_u8ErrorStatus)
+    {
+        GPIO_u8SetPinValue(Handle->RSTPort, Handle->RSTPin, PIN_LOW);
+        SYSTICK_Delayms(TFT_RESET_PULSE_MS);
+        GPIO_u8SetPinValue(Handle->RSTPort, Handle->RSTPin, PIN_HIGH);
+        SYSTICK_Delayms(TFT_RESET_WAIT_MS);
+
+        Local_u8ErrorStatus = TFT_Select(Handle);
+
+        if (TFT_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = TFT_RunSequence(Handle, TFT_INIT_SEQUENCE[Handle->Controller]);
+
+            if (TFT_OK == Local_u8ErrorStatus)
+            {
+                Local_u8MemoryAccess = (uint8_t)Handle->Orientation | (uint8_t)Handle->ColorOrder;
+
+                Local_u8ErrorStatus = TFT_WriteCommand(Handle, TFT_CMD_MADCTL, &Local_u8MemoryAccess, 1U);
+            }
+
+            SPIBUS_End(Handle->Device);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Write a Block of Pixels to a Region of The Display
+ * @fn     : TFT_WriteRegion
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Region , Must Lie Inside The Display -> @TFT_Rect_t
+ * @param  : Pixels => This Parameter is Used to Pass ( Region Width x Region Height ) RGB565 Pixels , Row After Row
+ * @return : ERRORS_t => TFT_NOK if The Region Does Not Lie Inside The Display
+ */
+ERRORS_t TFT_WriteRegion(TFT_Handle_t *Handle, const TFT_Rect_t *Region, const uint16_t *Pixels)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    uint16_t *Local_pu16Row = NULL;
+
+    uint16_t Local_u16Row = 0;
+    uint16_t Local_u16Column = 0;
+
+    if ((NULL == Handle) || (NULL == Region) || (NULL == Pixels))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (TFT_OK != TFT_CheckRegion(Handle, Region))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    else
+    {
+        Local_u8ErrorStatus = TFT_Select(Handle);
+
+        if (TFT_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = TFT_SetWindow(Handle, Region);
+
+            if (TFT_OK == Local_u8ErrorStatus)
+            {
+                Local_u8ErrorStatus = TFT_WritePixels(Handle, Pixels, (uint32_t)Region->Width * Region->Height);
+            }
+
+            SPIBUS_End(Handle->Device);
+        }
+
+        if (NULL != Handle->FrameBuffer)
+        {
+            for (Local_u16Row = 0; Local_u16Row < Region->Height; Local_u16Row++)
+            {
+                Local_pu16Row = &Handle->FrameBuffer[((uint32_t)(Region->Y + Local_u16Row) * Handle->Width) + Region->X];
+
+                for (Local_u16Column = 0; Local_u16Column < Region->Width; Local_u16Column++)
+                {
+                    Local_pu16Row[Local_u16Column] = *Pixels++;
+                }
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Fill a Region of The Display With One Color
+ * @fn     : TFT_FillRect
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Region , Must Lie Inside The Display -> @TFT_Rect_t
+ * @param  : Color  => This Parameter is Used to Pass The RGB565 Color
+ * @return : ERRORS_t => TFT_NOK if The Region Does Not Lie Inside The Display
+ */
+ERRORS_t TFT_FillRect(TFT_Handle_t *Handle, const TFT_Rect_t *Region, uint16_t Color)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    uint16_t Local_au16Run[TFT_FILL_CHUNK_SIZE];
+
+    uint16_t *Local_pu16Row = NULL;
+
+    uint32_t Local_u32Remaining = 0;
+
+    uint16_t Local_u16Chunk = 0;
+    uint16_t Local_u16Row = 0;
+    uint16_t Local_u16Column = 0;
+
+    if ((NULL == Handle) || (NULL == Region))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (TFT_OK != TFT_CheckRegion(Handle, Region))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    else
+    {
+        for (Local_u16Chunk = 0; Local_u16Chunk < TFT_FILL_CHUNK_SIZE; Local_u16Chunk++)
+        {
+            Local_au16Run[Local_u16Chunk] = Color;
+        }
+
+        Local_u8ErrorStatus = TFT_Select(Handle);
+
+        if (TFT_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = TFT_SetWindow(Handle, Region);
+
+            /* The Controller Keeps Writing Inside The Window , So The Run is Just The Same Buffer Sent Again */
+            Local_u32Remaining = (uint32_t)Region->Width * Region->Height;
+
+            while ((TFT_OK == Local_u8ErrorStatus) && (Local_u32Remaining > 0U))
+            {
+                Local_u16Chunk = (Local_u32Remaining < TFT_FILL_CHUNK_SIZE) ? (uint16_t)Local_u32Remaining : TFT_FILL_CHUNK_SIZE;
+
+                if (SPIBUS_OK != SPIBUS_Exchange16(Handle->Device, Local_au16Run, NULL, Local_u16Chunk))
+                {
+                    Local_u8ErrorStatus = TFT_NOK;
+                }
+
+                Local_u32Remaining -= Local_u16Chunk;
+            }
+
+            SPIBUS_End(Handle->Device);
+        }
+
+        if (NULL != Handle->FrameBuffer)
+        {
+            for (Local_u16Row = 0; Local_u16Row < Region->Height; Local_u16Row++)
+            {
+                Local_pu16Row = &Handle->FrameBuffer[((uint32_t)(Region->Y + Local_u16Row) * Handle->Width) + Region->X];
+
+                for (Local_u16Column = 0; Local_u16Column < Region->Width; Local_u16Column++)
+                {
+                    Local_pu16Row[Local_u16Column] = Color;
+                }
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Mark a Region of The Frame Buffer as Changed
+ * @fn     : TFT_Invalidate
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Changed Region , Must Lie Inside The Display -> @TFT_Rect_t
+ * @return : ERRORS_t => TFT_NOK if The Region Does Not Lie Inside The Display or No Frame Buffer is Attached
+ */
+ERRORS_t TFT_Invalidate(TFT_Handle_t *Handle, const TFT_Rect_t *Region)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    TFT_Rect_t Local_Union = {0};
+
+    uint32_t Local_u32Growth = 0;
+    uint32_t Local_u32LeastGrowth = 0xFFFFFFFFUL;
+
+    uint8_t Local_u8Index = 0;
+    uint8_t Local_u8Target = 0;
+
+    if ((NULL == Handle) || (NULL == Region))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((NULL == Handle->FrameBuffer) || (TFT_OK != TFT_CheckRegion(Handle, Region)))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    else
+    {
+        Local_u8Target = Handle->DirtyCount;
+
+        /* Join a Tracked Region When That Costs No Extra Pixels */
+        for (Local_u8Index = 0; (Local_u8Index < Handle->DirtyCount) && (Local_u8Target == Handle->DirtyCount); Local_u8Index++)
+        {
+            if (TFT_RectsMergeable(&Handle->DirtyRects[Local_u8Index], Region))
+            {
+                Local_u8Target = Local_u8Index;
+            }
+        }
+
+        if ((Local_u8Target == Handle->DirtyCount) && (Handle->DirtyCount < TFT_DIRTY_RECTS_MAX))
+        {
+            Handle->DirtyRects[Handle->DirtyCount] = *Region;
+            Handle->DirtyCount++;
+        }
+        else
+        {
+            /* All Slots Used , Grow The Region That Adds The Fewest Pixels */
+            if (Local_u8Target == Handle->DirtyCount)
+            {
+                for (Local_u8Index = 0; Local_u8Index < Handle->DirtyCount; Local_u8Index++)
+                {
+                    Local_Union = TFT_RectUnion(&Handle->DirtyRects[Local_u8Index], Region);
+                    Local_u32Growth = TFT_RectArea(&Local_Union) - TFT_RectArea(&Handle->DirtyRects[Local_u8Index]);
+
+                    if (Local_u32Growth < Local_u32LeastGrowth)
+                    {
+                        Local_u32LeastGrowth = Local_u32Growth;
+                        Local_u8Target = Local_u8Index;
+                    }
+                }
+            }
+
+            Handle->DirtyRects[Local_u8Target] = TFT_RectUnion(&Handle->DirtyRects[Local_u8Target], Region);
+
+            TFT_MergeDirty(Handle, Local_u8Target);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send The Dirty Regions of The Frame Buffer to The Display & Clear Them
+ * @fn     : TFT_Flush
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @return : ERRORS_t => TFT_NOK if No Frame Buffer is Attached
+ */
+ERRORS_t TFT_Flush(TFT_Handle_t *Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    const TFT_Rect_t *Local_Rect = NULL;
+
+    uint8_t Local_u8Index = 0;
+
+    uint16_t Local_u16Row = 0;
+
+    if (NULL == Handle)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (NULL == Handle->FrameBuffer)
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    else if (0U != Handle->DirtyCount)
+    {
+        Local_u8ErrorStatus = TFT_Select(Handle);
+
+        if (TFT_OK == Local_u8ErrorStatus)
+        {
+            for (Local_u8Index = 0; (Local_u8Index < Handle->DirtyCount) && (TFT_OK == Local_u8ErrorStatus); Local_u8Index++)
+            {
+                Local_Rect = &Handle->DirtyRects[Local_u8Index];
+
+                Local_u8ErrorStatus = TFT_SetWindow(Handle, Local_Rect);
+
+                if (Local_Rect->Width == Handle->Width)
+                {
+                    /* Full Width Rows Follow Each Other in The Frame Buffer */
+                    if (TFT_OK == Local_u8ErrorStatus)
+                    {
+                        Local_u8ErrorStatus = TFT_WritePixels(Handle, &Handle->FrameBuffer[(uint32_t)Local_Rect->Y * Handle->Width],
+                                                              (uint32_t)Local_Rect->Width * Local_Rect->Height);
+                    }
+                }
+                else
+                {
+                    /* The Window Wraps to Its Next Row by Itself , So The Rows Are Just Sent One After Another */
+                    for (Local_u16Row = 0; (Local_u16Row < Local_Rect->Height) && (TFT_OK == Local_u8ErrorStatus); Local_u16Row++)
+                    {
+                        Local_u8ErrorStatus = TFT_WritePixels(Handle, &Handle->FrameBuffer[((uint32_t)(Local_Rect->Y + Local_u16Row) * Handle->Width) + Local_Rect->X],
+                                                              Local_Rect->Width);
+                    }
+                }
+            }
+
+            SPIBUS_End(Handle->Device);
+        }
+
+        /* Failed Regions Are Kept So The Next Flush Sends Them Again */
+        if (TFT_OK == Local_u8ErrorStatus)
+        {
+            Handle->DirtyCount = 0;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Take The Bus & Select The Display , Waiting While Queued Transactions Run on it
+ * @fn     : TFT_Select
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_Select(const TFT_Handle_t *Handle)
+{
+    ERRORS_t Local_u8BusStatus = SPIBUS_OK;
+
+    do
+    {
+        Local_u8BusStatus = SPIBUS_Begin(Handle->Device);
+
+    } while (SPIBUS_BUSY == Local_u8BusStatus);
+
+    return (SPIBUS_OK == Local_u8BusStatus) ? TFT_OK : TFT_NOK;
+}
+
+/**
+ * @brief  : This Function is Used to Send a Command & Its Arguments in 8 Bit Frames
+ * @fn     : TFT_WriteCommand
+ * @param  : Handle    => This Parameter is Used to Pass The Selected Display
+ * @param  : Command   => This Parameter is Used to Pass The Command
+ * @param  : Arguments => This Parameter is Used to Pass The Argument Bytes
+ * @param  : Count     => This Parameter is Used to Pass The Number of Argument Bytes ( May Be 0 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_WriteCommand(const TFT_Handle_t *Handle, uint8_t Command, const uint8_t *Arguments, uint8_t Count)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    GPIO_u8SetPinValue(Handle->DCPort, Handle->DCPin, PIN_LOW);
+
+    if (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, &Command, NULL, 1U))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+
+    GPIO_u8SetPinValue(Handle->DCPort, Handle->DCPin, PIN_HIGH);
+
+    if ((TFT_OK == Local_u8ErrorStatus) && (0U != Count) &&
+        (SPIBUS_OK != SPIBUS_Exchange(Handle->Device, Arguments, NULL, Count)))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send a Command & Its Arguments in 16 Bit Frames
+ * @fn     : TFT_WriteCommand16
+ * @param  : Handle    => This Parameter is Used to Pass The Selected Display
+ * @param  : Command   => This Parameter is Used to Pass The Command
+ * @param  : Arguments => This Parameter is Used to Pass The 16 Bit Arguments , Each is Sent High Byte First
+ * @param  : Count     => This Parameter is Used to Pass The Number of Argument Frames ( May Be 0 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_WriteCommand16(const TFT_Handle_t *Handle, uint8_t Command, const uint16_t *Arguments, uint8_t Count)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    /* The Controller Skips The NOP & Takes The Command From The Low Byte */
+    uint16_t Local_u16Frame = ((uint16_t)TFT_CMD_NOP << 8) | Command;
+
+    GPIO_u8SetPinValue(Handle->DCPort, Handle->DCPin, PIN_LOW);
+
+    if (SPIBUS_OK != SPIBUS_Exchange16(Handle->Device, &Local_u16Frame, NULL, 1U))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+
+    GPIO_u8SetPinValue(Handle->DCPort, Handle->DCPin, PIN_HIGH);
+
+    if ((TFT_OK == Local_u8ErrorStatus) && (0U != Count) &&
+        (SPIBUS_OK != SPIBUS_Exchange16(Handle->Device, Arguments, NULL, Count)))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Address a Region & Start a Memory Write , The Pixels Follow in 16 Bit Frames
+ * @fn     : TFT_SetWindow
+ * @param  : Handle => This Parameter is Used to Pass The Selected Display
+ * @param  : Region => This Parameter is Used to Pass The Region
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_SetWindow(const TFT_Handle_t *Handle, const TFT_Rect_t *Region)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    /* Start & End Addresses , Both Inclusive */
+    uint16_t Local_au16Columns[2] = {(uint16_t)(Handle->XOffset + Region->X), (uint16_t)(Handle->XOffset + Region->X + Region->Width - 1U)};
+    uint16_t Local_au16Rows[2] = {(uint16_t)(Handle->YOffset + Region->Y), (uint16_t)(Handle->YOffset + Region->Y + Region->Height - 1U)};
+
+    if ((TFT_OK != TFT_WriteCommand16(Handle, TFT_CMD_CASET, Local_au16Columns, 2U)) ||
+        (TFT_OK != TFT_WriteCommand16(Handle, TFT_CMD_RASET, Local_au16Rows, 2U)) ||
+        (TFT_OK != TFT_WriteCommand16(Handle, TFT_CMD_RAMWR, NULL, 0U)))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stream Pixels After a Memory Write , Splitting Them Into Transfers of Up to TFT_STREAM_CHUNK_SIZE
+ * @fn     : TFT_WritePixels
+ * @param  : Handle => This Parameter is Used to Pass The Selected Display
+ * @param  : Pixels => This Parameter is Used to Pass The RGB565 Pixels
+ * @param  : Count  => This Parameter is Used to Pass The Number of Pixels
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_WritePixels(const TFT_Handle_t *Handle, const uint16_t *Pixels, uint32_t Count)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    uint16_t Local_u16Chunk = 0;
+
+    while ((TFT_OK == Local_u8ErrorStatus) && (Count > 0U))
+    {
+        Local_u16Chunk = (Count < TFT_STREAM_CHUNK_SIZE) ? (uint16_t)Count : TFT_STREAM_CHUNK_SIZE;
+
+        if (SPIBUS_OK != SPIBUS_Exchange16(Handle->Device, Pixels, NULL, Local_u16Chunk))
+        {
+            Local_u8ErrorStatus = TFT_NOK;
+        }
+
+        Pixels += Local_u16Chunk;
+        Count -= Local_u16Chunk;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Check That a Region is Not Empty & Lies Inside The Display
+ * @fn     : TFT_CheckRegion
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Region => This Parameter is Used to Pass The Region
+ * @return : ERRORS_t => TFT_NOK if The Region is Empty or Crosses an Edge of The Display
+ */
+static ERRORS_t TFT_CheckRegion(const TFT_Handle_t *Handle, const TFT_Rect_t *Region)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    if ((0U == Region->Width) || (0U == Region->Height) ||
+        (((uint32_t)Region->X + Region->Width) > Handle->Width) || (((uint32_t)Region->Y + Region->Height) > Handle->Height))
+    {
+        Local_u8ErrorStatus = TFT_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Run an Initialization Sequence on The Selected Display
+ * @fn     : TFT_RunSequence
+ * @param  : Handle   => This Parameter is Used to Pass The Selected Display
+ * @param  : Sequence => This Parameter is Used to Pass The Sequence , Ended By TFT_INIT_END
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t TFT_RunSequence(const TFT_Handle_t *Handle, const uint8_t *Sequence)
+{
+    ERRORS_t Local_u8ErrorStatus = TFT_OK;
+
+    uint8_t Local_u8Command = 0;
+    uint8_t Local_u8Count = 0;
+
+    while ((TFT_OK == Local_u8ErrorStatus) && (TFT_INIT_END != *Sequence))
+    {
+        Local_u8Command = *Sequence++;
+        Local_u8Count = *Sequence++;
+
+        Local_u8ErrorStatus = TFT_WriteCommand(Handle, Local_u8Command, Sequence, Local_u8Count & TFT_INIT_COUNT_MASK);
+
+        Sequence += (Local_u8Count & TFT_INIT_COUNT_MASK);
+
+        if (Local_u8Count & TFT_INIT_DELAY)
+        {
+            SYSTICK_Delayms(*Sequence++);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/* Union Not Larger Than Both Regions Sent Apart */
+static uint8_t TFT_RectsMergeable(const TFT_Rect_t *First, const TFT_Rect_t *Second)
+{
+    TFT_Rect_t Local_Union = TFT_RectUnion(First, Second);
+
+    return (TFT_RectArea(&Local_Union) <= (TFT_RectArea(First) + TFT_RectArea(Second)));
+}
+
+/* Smallest Region Holding Both */
+static TFT_Rect_t TFT_RectUnion(const TFT_Rect_t *First, const TFT_Rect_t *Second)
+{
+    TFT_Rect_t Local_Union = {0};
+
+    uint16_t Local_u16Right = ((First->X + First->Width) > (Second->X + Second->Width)) ? (First->X + First->Width) : (Second->X + Second->Width);
+    uint16_t Local_u16Bottom = ((First->Y + First->Height) > (Second->Y + Second->Height)) ? (First->Y + First->Height) : (Second->Y + Second->Height);
+
+    Local_Union.X = (First->X < Second->X) ? First->X : Second->X;
+    Local_Union.Y = (First->Y < Second->Y) ? First->Y : Second->Y;
+    Local_Union.Width = Local_u16Right - Local_Union.X;
+    Local_Union.Height = Local_u16Bottom - Local_Union.Y;
+
+    return Local_Union;
+}
+
+static uint32_t TFT_RectArea(const TFT_Rect_t *Rect)
+{
+    return ((uint32_t)Rect->Width * Rect->Height);
+}
+
+/**
+ * @brief  : This Function is Used to Merge Into a Dirty Region Every Other Dirty Region Worth Merging
+ * @fn     : TFT_MergeDirty
+ * @param  : Handle => This Parameter is Used to Pass The Display Handle
+ * @param  : Index  => This Parameter is Used to Pass The Dirty Region That Has Just Grown
+ * @return : void
+ */
+static void TFT_MergeDirty(TFT_Handle_t *Handle, uint8_t Index)
+{
+    uint8_t Local_u8Other = 0;
+
+    while (Local_u8Other < Handle->DirtyCount)
+    {
+        if ((Local_u8Other != Index) && TFT_RectsMergeable(&Handle->DirtyRects[Index], &Handle->DirtyRects[Local_u8Other]))
+        {
+            Handle->DirtyRects[Index] = TFT_RectUnion(&Handle->DirtyRects[Index], &Handle->DirtyRects[Local_u8Other]);
+
+            /* Fill The Hole With The Last Region , Which Moves Too if it Was The Grown One */
+            Handle->DirtyCount--;
+            Handle->DirtyRects[Local_u8Other] = Handle->DirtyRects[Handle->DirtyCount];
+
+            if (Index == Handle->DirtyCount)
+            {
+                Index = Local_u8Other;
+            }
+
+            /* The Grown Region May Now Be Worth Merging With One Already Checked */
+            Local_u8Other = 0;
+        }
+        else
+        {
+            Local_u8Other++;
+        }
+    }
+}
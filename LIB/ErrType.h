@@ -46,18 +46,72 @@ typedef enum
 	APB1DisPeripheralError,
 	APB2EnPeripheralError,
 	APB2DisPeripheralError,
+	APB1RstPeripheralError,
+	APB2RstPeripheralError,
 	/*==============================================================================================================================================
 	 * USART ERRORS
 	 *==============================================================================================================================================*/
 	USART_OK,
 	USART_NOK,
 	USART_WRONG_CONFIGURATION,
+	USART_BUSY,
+	USART_OVERRUN_ERROR,
 	/*==============================================================================================================================================
 	 * SPI ERRORS
 	 *==============================================================================================================================================*/
 	SPI_OK,
 	SPI_NOK,
 	SPI_INVALID_CONFIG,
+	SPI_BUSY,
+	SPI_CRC_ERROR,
+	SPI_OVERRUN_ERROR,
+	/*==============================================================================================================================================
+	 * DMA ERRORS
+	 *==============================================================================================================================================*/
+	DMA_OK,
+	DMA_NOK,
+	DMA_CHANNEL_BUSY,
+	/*==============================================================================================================================================
+	 * LOG ERRORS
+	 *==============================================================================================================================================*/
+	LOG_OK,
+	LOG_NOK,
+	LOG_BUFFER_FULL,
+	/*==============================================================================================================================================
+	 * LIN ERRORS
+	 *==============================================================================================================================================*/
+	LIN_OK,
+	LIN_NOK,
+	/*==============================================================================================================================================
+	 * COBS ERRORS
+	 *==============================================================================================================================================*/
+	COBS_OK,
+	COBS_NOK,
+	/*==============================================================================================================================================
+	 * SPIBUS ERRORS
+	 *==============================================================================================================================================*/
+	SPIBUS_OK,
+	SPIBUS_NOK,
+	SPIBUS_BUSY,
+	SPIBUS_QUEUE_FULL,
+	/*==============================================================================================================================================
+	 * SPIFLASH ERRORS
+	 *==============================================================================================================================================*/
+	SPIFLASH_OK,
+	SPIFLASH_NOK,
+	SPIFLASH_NOT_FOUND,
+	/*==============================================================================================================================================
+	 * SDCARD ERRORS
+	 *==============================================================================================================================================*/
+	SDCARD_OK,
+	SDCARD_NOK,
+	SDCARD_NOT_FOUND,
+	SDCARD_UNSUPPORTED,
+	/*==============================================================================================================================================
+	 * TFT ERRORS
+	 *==============================================================================================================================================*/
+	TFT_OK,
+	TFT_NOK,
 
 } ERRORS_t;
 
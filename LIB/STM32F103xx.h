@@ -27,6 +27,8 @@
 /* --------------------------------------------------------------------------------------------- */
 #define RCC_BASE_ADDRESS 0x40021000UL
 
+#define DMA1_BASE_ADDRESS 0x40020000UL
+
 /* ---------------------------------------------------------------------------------------------- */
 /* ------------------------------- APB1 PERIPHERAL BASE ADDRESSES ------------------------------- */
 /* ---------------------------------------------------------------------------------------------- */
@@ -52,6 +54,8 @@
 #define SPI1_BASE_ADDRESS 0x40013000UL
 
 #define EXTI_BASE_ADDRESS 0x40010400UL
+
+#define AFIO_BASE_ADDRESS 0x40010000UL
 /* ------------------------------------------------------------------------------------------------------------- */
 /* ------------------------------- CORTEX-M3 INTERNAL PERIPHERALS BASE ADDRESSES ------------------------------- */
 /* ------------------------------------------------------------------------------------------------------------- */
@@ -502,4 +506,81 @@ typedef struct
 
 #define EXTI  ( ( EXTI_RegDef_t* ) EXTI_BASE_ADDRESS )
 
+/* -------------------------------------------------------------------------------------------------- */
+/* ------------------------------- AFIO REGISTERS Definition Structure ------------------------------ */
+/* -------------------------------------------------------------------------------------------------- */
+
+typedef struct
+{
+	volatile uint32_t EVCR;		 /* Event Control Register */
+	volatile uint32_t MAPR;		 /* AF Remap and Debug I/O Configuration Register */
+	volatile uint32_t EXTICR[4]; /* External Interrupt Configuration Registers 1 to 4 , 4 Bits Port Code Per Line */
+	uint32_t RESERVED;
+	volatile uint32_t MAPR2; /* AF Remap and Debug I/O Configuration Register 2 */
+
+} AFIO_RegDef_t;
+
+/* ------------------------------------------------------------------------------------------ */
+/* ------------------------------- AFIO Peripheral Definition ------------------------------- */
+/* ------------------------------------------------------------------------------------------ */
+
+#define AFIO ((AFIO_RegDef_t *)AFIO_BASE_ADDRESS)
+
+/* ------------------------------------------------------------------------------------------------- */
+/* ------------------------------- DMA REGISTERS Definition Structure ------------------------------ */
+/* ------------------------------------------------------------------------------------------------- */
+
+typedef struct
+{
+	volatile uint32_t CCR;	 /* DMA Channel Configuration Register */
+	volatile uint32_t CNDTR; /* DMA Channel Number of Data Register */
+	volatile uint32_t CPAR;	 /* DMA Channel Peripheral Address Register */
+	volatile uint32_t CMAR;	 /* DMA Channel Memory Address Register */
+	uint32_t RESERVED;
+
+} DMA_Channel_RegDef_t;
+
+typedef struct
+{
+	volatile uint32_t ISR;	/* DMA Interrupt Status Register */
+	volatile uint32_t IFCR; /* DMA Interrupt Flag Clear Register */
+	DMA_Channel_RegDef_t Channel[7];
+
+} DMA_RegDef_t;
+
+/* ----------------------------------------------------------------------------------------- */
+/* ------------------------------- DMA Peripheral Definition ------------------------------- */
+/* ----------------------------------------------------------------------------------------- */
+#define DMA1 ((DMA_RegDef_t *)DMA1_BASE_ADDRESS)
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------------------- DMA REGISTERS' Bits ------------------------------- */
+/* ----------------------------------------------------------------------------------- */
+
+typedef enum
+{
+	DMA_EN = 0,		  /* Channel Enable */
+	DMA_TCIE = 1,	  /* Transfer Complete Interrupt Enable */
+	DMA_HTIE = 2,	  /* Half Transfer Interrupt Enable */
+	DMA_TEIE = 3,	  /* Transfer Error Interrupt Enable */
+	DMA_DIR = 4,	  /* Data Transfer Direction */
+	DMA_CIRC = 5,	  /* Circular Mode */
+	DMA_PINC = 6,	  /* Peripheral Increment Mode */
+	DMA_MINC = 7,	  /* Memory Increment Mode */
+	DMA_PSIZE = 8,	  /* Peripheral Size */
+	DMA_MSIZE = 10,	  /* Memory Size */
+	DMA_PL = 12,	  /* Channel Priority Level */
+	DMA_MEM2MEM = 14, /* Memory to Memory Mode */
+
+} DMA_CCR_BITS_t;
+
+typedef enum
+{
+	DMA_GIF = 0,  /* Channel Global Interrupt Flag */
+	DMA_TCIF = 1, /* Channel Transfer Complete Flag */
+	DMA_HTIF = 2, /* Channel Half Transfer Flag */
+	DMA_TEIF = 3, /* Channel Transfer Error Flag */
+
+} DMA_ISR_BITS_t;
+
 #endif /* STM32F103XX_H_ */
@@ -0,0 +1,208 @@
+/*
+ ******************************************************************************
+ * @file           : DMA_Interface.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : DMA Interface Header file
+ * @Date           : Sep 2, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef DMA_INC_DMA_INTERFACE_H_
+#define DMA_INC_DMA_INTERFACE_H_
+
+/* ======================================================================
+ * DMA Option Enums
+ * ====================================================================== */
+
+/**
+ * @brief : This Enum Holds Values of DMA1 Channels
+ * @enum  : @DMA_Channel_t
+ * @note  : Request Mapping ( RM0008 Table 78 ) :
+ *          Channel 2 => SPI1_RX / USART3_TX     Channel 3 => SPI1_TX / USART3_RX
+ *          Channel 4 => SPI2_RX / USART1_TX     Channel 5 => SPI2_TX / USART1_RX
+ *          Channel 6 => USART2_RX               Channel 7 => USART2_TX
+ */
+typedef enum
+{
+    DMA_CHANNEL_1 = 0,
+    DMA_CHANNEL_2 = 1,
+    DMA_CHANNEL_3 = 2,
+    DMA_CHANNEL_4 = 3,
+    DMA_CHANNEL_5 = 4,
+    DMA_CHANNEL_6 = 5,
+    DMA_CHANNEL_7 = 6,
+    DMA_CHANNEL_NUM = 7,
+
+} DMA_Channel_t;
+
+/**
+ * @brief : This Enum Holds Values of DMA Transfer Direction Options
+ * @enum  : @DMA_Direction_t
+ */
+typedef enum
+{
+    DMA_PERIPH_TO_MEM = 0, /* Read From Peripheral Address , Write to Memory Address */
+    DMA_MEM_TO_PERIPH = 1, /* Read From Memory Address , Write to Peripheral Address */
+    DMA_MEM_TO_MEM = 2,    /* Read From Peripheral Address , Write to Memory Address ( Both in Memory ) */
+
+} DMA_Direction_t;
+
+/**
+ * @brief : This Enum Holds Values of DMA Mode Options
+ * @enum  : @DMA_Mode_t
+ */
+typedef enum
+{
+    DMA_NORMAL_MODE = 0,   /* Channel Stops After Transferring Length Items */
+    DMA_CIRCULAR_MODE = 1, /* Channel Reloads Length & Addresses And Keeps Running */
+
+} DMA_Mode_t;
+
+/**
+ * @brief : This Enum Holds Values of DMA Data Size Options
+ * @enum  : @DMA_DataSize_t
+ */
+typedef enum
+{
+    DMA_SIZE_8_BITS = 0,
+    DMA_SIZE_16_BITS = 1,
+    DMA_SIZE_32_BITS = 2,
+
+} DMA_DataSize_t;
+
+/**
+ * @brief : This Enum Holds Values of DMA Address Increment Options
+ * @enum  : @DMA_Increment_t
+ */
+typedef enum
+{
+    DMA_INC_DIS = 0,
+    DMA_INC_EN = 1,
+
+} DMA_Increment_t;
+
+/**
+ * @brief : This Enum Holds Values of DMA Channel Priority Options
+ * @enum  : @DMA_Priority_t
+ */
+typedef enum
+{
+    DMA_PRIORITY_LOW = 0,
+    DMA_PRIORITY_MEDIUM = 1,
+    DMA_PRIORITY_HIGH = 2,
+    DMA_PRIORITY_VERY_HIGH = 3,
+
+} DMA_Priority_t;
+
+/**
+ * @brief : This Enum Holds Values of DMA Interrupt Types Ordered to access Call Back Function Easily
+ * @enum  : @DMA_IT_t
+ */
+typedef enum
+{
+    DMA_IT_TC = 0, /* Transfer Complete */
+    DMA_IT_HT = 1, /* Half Transfer */
+    DMA_IT_TE = 2, /* Transfer Error */
+    DMA_IT_NUM = 3,
+
+} DMA_IT_t;
+
+/**
+ * @brief : This Struct Holds Values of DMA Channel Configuration Options
+ * @struct: @DMA_Config_t
+ * @note  : This Struct is Used in DMA_Init Function to Configure a Specific DMA Channel
+ */
+typedef struct
+{
+    DMA_Channel_t Channel;
+    DMA_Direction_t Direction;
+    DMA_Mode_t Mode;
+    DMA_DataSize_t PeriphSize;
+    DMA_DataSize_t MemSize;
+    DMA_Increment_t PeriphIncrement;
+    DMA_Increment_t MemIncrement;
+    DMA_Priority_t Priority;
+
+} DMA_Config_t;
+
+/* ------------------------------------------------------------------------------------------------ */
+/* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
+/* ------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief  : This Function is Used to Reserve a DMA Channel For a Driver or The Application
+ * @fn     : DMA_ClaimChannel
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel to Be Reserved -> @DMA_Channel_t
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The Channel is Already Claimed
+ * @note   : Each Channel Serves Several Peripherals , So Every User Must Claim The Channel Before Using it
+ */
+ERRORS_t DMA_ClaimChannel(DMA_Channel_t Channel);
+
+/**
+ * @brief  : This Function is Used to Release a Previously Claimed DMA Channel
+ * @fn     : DMA_ReleaseChannel
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel to Be Released -> @DMA_Channel_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Channel is Stopped & Its Call Back Functions Are Cleared
+ */
+ERRORS_t DMA_ReleaseChannel(DMA_Channel_t Channel);
+
+/**
+ * @brief  : This Function is Used to Configure a DMA Channel
+ * @fn     : DMA_Init
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The Channel
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : DMA1 Clock Must Be Enabled Using RCC Before Calling This Function & The Channel is Left Disabled
+ */
+ERRORS_t DMA_Init(DMA_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Set CallBack Function For a Specific DMA Channel Interrupt
+ * @fn     : DMA_SetCallBack
+ * @param  : Channel         => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @param  : ITNumber        => This Parameter is Used to Select The Interrupt Type -> @DMA_IT_t
+ * @param  : Pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function , it Receives The Channel That Raised The Interrupt
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Only Interrupts That Have a CallBack Are Enabled When The Transfer is Started
+ */
+ERRORS_t DMA_SetCallBack(DMA_Channel_t Channel, DMA_IT_t ITNumber, void (*Pv_CallBackFunc)(DMA_Channel_t));
+
+/**
+ * @brief  : This Function is Used to Start a Transfer on a Configured DMA Channel
+ * @fn     : DMA_StartTransfer
+ * @param  : Channel       => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @param  : PeriphAddress => This Parameter is Used to Pass The Peripheral Address ( Source in Memory to Memory Mode )
+ * @param  : MemAddress    => This Parameter is Used to Pass The Memory Address
+ * @param  : Length        => This Parameter is Used to Pass The Number of Items to Be Transferred ( 1 to 65535 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Channel IRQ Must Be Enabled in NVIC For The CallBack Functions to Be Invoked
+ */
+ERRORS_t DMA_StartTransfer(DMA_Channel_t Channel, uint32_t PeriphAddress, uint32_t MemAddress, uint16_t Length);
+
+/**
+ * @brief  : This Function is Used to Stop a Running Transfer on a DMA Channel
+ * @fn     : DMA_StopTransfer
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t DMA_StopTransfer(DMA_Channel_t Channel);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Items Left to Be Transferred on a DMA Channel
+ * @fn     : DMA_GetRemaining
+ * @param  : Channel   => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @param  : Remaining => This Parameter is Used to Return The Number of Items Left
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t DMA_GetRemaining(DMA_Channel_t Channel, uint16_t *Remaining);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
+/* ---------------------------------------------------------------------------------------------- */
+
+#endif /* DMA_INC_DMA_INTERFACE_H_ */
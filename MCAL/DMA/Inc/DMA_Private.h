@@ -0,0 +1,83 @@
+/*
+ ******************************************************************************
+ * @file           : DMA_Private.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : DMA Private Header file
+ * @Date           : Sep 2, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef DMA_INC_DMA_PRIVATE_H_
+#define DMA_INC_DMA_PRIVATE_H_
+
+/* ======================================================================
+ * PRIVATE FUNCTION
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Handle The Interrupts of a DMA Channel
+ * @fn     : DMA_HANDLE_IT
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @return : void
+ * @note   : This Function is Used Inside All IRQ Handlers to Handle The Interrupts ( Private Function )
+ */
+static void DMA_HANDLE_IT(DMA_Channel_t Channel);
+
+/* ======================================================================
+ * PRIVATE MACROS
+ * ====================================================================== */
+
+/* Each Channel Owns 4 Flags in ISR / IFCR */
+#define DMA_FLAGS_SHIFT(CHANNEL) ((uint32_t)(CHANNEL) * 4U)
+
+/* All Flags of a Channel ( GIF , TCIF , HTIF , TEIF ) */
+#define DMA_CHANNEL_FLAGS_MASK 0x0FUL
+
+/* CCR Fields Written By DMA_Init ( Everything Except EN & Interrupt Enables ) */
+#define DMA_CCR_CONFIG_MASK 0x7FF0UL
+
+/* CCR Interrupt Enable Bits ( TCIE , HTIE , TEIE ) */
+#define DMA_CCR_IT_MASK 0x000EUL
+
+/* ======================================================================
+ * PRIVATE INLINE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Mask All Configurable Interrupts & Return The Previous PRIMASK
+ * @fn     : DMA_EnterCritical
+ * @return : uint32_t => Previous PRIMASK Value to Be Passed to DMA_ExitCritical
+ */
+static inline uint32_t DMA_EnterCritical(void)
+{
+    uint32_t Local_u32PriMask;
+
+    __asm volatile("MRS %0, PRIMASK \n"
+                   "CPSID i"
+                   : "=r"(Local_u32PriMask)
+                   :
+                   : "memory");
+
+    return Local_u32PriMask;
+}
+
+/**
+ * @brief  : This Function is Used to Restore PRIMASK Saved By DMA_EnterCritical
+ * @fn     : DMA_ExitCritical
+ * @param  : PriMask => This Parameter is Used to Pass The Value Returned By DMA_EnterCritical
+ * @return : void
+ */
+static inline void DMA_ExitCritical(uint32_t PriMask)
+{
+    __asm volatile("MSR PRIMASK, %0"
+                   :
+                   : "r"(PriMask)
+                   : "memory");
+}
+
+#endif /* DMA_INC_DMA_PRIVATE_H_ */
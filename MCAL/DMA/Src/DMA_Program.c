@@ -0,0 +1,407 @@
+/*
+ ******************************************************************************
+ * @file           : DMA_Program.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Main program body
+ * @Date           : Sep 2, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../../LIB/STM32F103xx.h"
+#include "../../../LIB/ErrType.h"
+
+#include "../Inc/DMA_Interface.h"
+#include "../Inc/DMA_Private.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION START
+ *==============================================================================================================================================*/
+
+static void (*DMA_PTR_TO_FUNC[DMA_CHANNEL_NUM][DMA_IT_NUM])(DMA_Channel_t) = {NULL};
+
+static uint8_t DMA_ChannelClaimed[DMA_CHANNEL_NUM] = {0};
+
+/*==============================================================================================================================================
+ * GLOBAL VARIABLES SECTION END
+ *==============================================================================================================================================*/
+
+/*==============================================================================================================================================
+ * MODULES IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Reserve a DMA Channel For a Driver or The Application
+ * @fn     : DMA_ClaimChannel
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel to Be Reserved -> @DMA_Channel_t
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The Channel is Already Claimed
+ * @note   : Each Channel Serves Several Peripherals , So Every User Must Claim The Channel Before Using it
+ */
+ERRORS_t DMA_ClaimChannel(DMA_Channel_t Channel)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    uint32_t Local_u32PriMask = 0;
+
+    if (Channel < DMA_CHANNEL_1 || Channel > DMA_CHANNEL_7)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* A Driver Claiming From an ISR Must Not See The Channel Free Between The Check & The Write */
+        Local_u32PriMask = DMA_EnterCritical();
+
+        if (0 != DMA_ChannelClaimed[Channel])
+        {
+            Local_u8ErrorStatus = DMA_CHANNEL_BUSY;
+        }
+        else
+        {
+            DMA_ChannelClaimed[Channel] = 1;
+        }
+
+        DMA_ExitCritical(Local_u32PriMask);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Release a Previously Claimed DMA Channel
+ * @fn     : DMA_ReleaseChannel
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel to Be Released -> @DMA_Channel_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Channel is Stopped & Its Call Back Functions Are Cleared
+ */
+ERRORS_t DMA_ReleaseChannel(DMA_Channel_t Channel)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    uint8_t Local_u8Counter = 0;
+
+    if (Channel < DMA_CHANNEL_1 || Channel > DMA_CHANNEL_7)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        DMA_StopTransfer(Channel);
+
+        for (Local_u8Counter = 0; Local_u8Counter < DMA_IT_NUM; Local_u8Counter++)
+        {
+            DMA_PTR_TO_FUNC[Channel][Local_u8Counter] = NULL;
+        }
+
+        DMA_ChannelClaimed[Channel] = 0;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Configure a DMA Channel
+ * @fn     : DMA_Init
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The Channel
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : DMA1 Clock Must Be Enabled Using RCC Before Calling This Function & The Channel is Left Disabled
+ */
+ERRORS_t DMA_Init(DMA_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    uint32_t Local_u32CCR = 0;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Config->Channel < DMA_CHANNEL_1 || Config->Channel > DMA_CHANNEL_7) ||
+             (Config->Direction < DMA_PERIPH_TO_MEM || Config->Direction > DMA_MEM_TO_MEM) ||
+             (Config->Mode < DMA_NORMAL_MODE || Config->Mode > DMA_CIRCULAR_MODE) ||
+             (Config->PeriphSize < DMA_SIZE_8_BITS || Config->PeriphSize > DMA_SIZE_32_BITS) ||
+             (Config->MemSize < DMA_SIZE_8_BITS || Config->MemSize > DMA_SIZE_32_BITS) ||
+             (Config->PeriphIncrement < DMA_INC_DIS || Config->PeriphIncrement > DMA_INC_EN) ||
+             (Config->MemIncrement < DMA_INC_DIS || Config->MemIncrement > DMA_INC_EN) ||
+             (Config->Priority < DMA_PRIORITY_LOW || Config->Priority > DMA_PRIORITY_VERY_HIGH) ||
+             (DMA_MEM_TO_MEM == Config->Direction && DMA_CIRCULAR_MODE == Config->Mode))
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* Channel Must Be Disabled Before Being Configured */
+        DMA1->Channel[Config->Channel].CCR &= (~(1UL << DMA_EN));
+
+        if (DMA_MEM_TO_PERIPH == Config->Direction)
+        {
+            Local_u32CCR |= (1UL << DMA_DIR);
+        }
+        else if (DMA_MEM_TO_MEM == Config->Direction)
+        {
+            Local_u32CCR |= (1UL << DMA_MEM2MEM);
+        }
+
+        Local_u32CCR |= ((uint32_t)Config->Mode << DMA_CIRC);
+        Local_u32CCR |= ((uint32_t)Config->PeriphIncrement << DMA_PINC);
+        Local_u32CCR |= ((uint32_t)Config->MemIncrement << DMA_MINC);
+        Local_u32CCR |= ((uint32_t)Config->PeriphSize << DMA_PSIZE);
+        Local_u32CCR |= ((uint32_t)Config->MemSize << DMA_MSIZE);
+        Local_u32CCR |= ((uint32_t)Config->Priority << DMA_PL);
+
+        DMA1->Channel[Config->Channel].CCR = (DMA1->Channel[Config->Channel].CCR & (~DMA_CCR_CONFIG_MASK)) | Local_u32CCR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set CallBack Function For a Specific DMA Channel Interrupt
+ * @fn     : DMA_SetCallBack
+ * @param  : Channel         => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @param  : ITNumber        => This Parameter is Used to Select The Interrupt Type -> @DMA_IT_t
+ * @param  : Pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function , it Receives The Channel That Raised The Interrupt
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Only Interrupts That Have a CallBack Are Enabled When The Transfer is Started
+ */
+ERRORS_t DMA_SetCallBack(DMA_Channel_t Channel, DMA_IT_t ITNumber, void (*Pv_CallBackFunc)(DMA_Channel_t))
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    if (Channel < DMA_CHANNEL_1 || Channel > DMA_CHANNEL_7 ||
+        ITNumber < DMA_IT_TC || ITNumber > DMA_IT_TE)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* NULL is Accepted to Remove a CallBack */
+        DMA_PTR_TO_FUNC[Channel][ITNumber] = Pv_CallBackFunc;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start a Transfer on a Configured DMA Channel
+ * @fn     : DMA_StartTransfer
+ * @param  : Channel       => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @param  : PeriphAddress => This Parameter is Used to Pass The Peripheral Address ( Source in Memory to Memory Mode )
+ * @param  : MemAddress    => This Parameter is Used to Pass The Memory Address
+ * @param  : Length        => This Parameter is Used to Pass The Number of Items to Be Transferred ( 1 to 65535 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Channel IRQ Must Be Enabled in NVIC For The CallBack Functions to Be Invoked
+ */
+ERRORS_t DMA_StartTransfer(DMA_Channel_t Channel, uint32_t PeriphAddress, uint32_t MemAddress, uint16_t Length)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    uint32_t Local_u32ITEnable = 0;
+
+    if (Channel < DMA_CHANNEL_1 || Channel > DMA_CHANNEL_7 || 0 == Length)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else if (0 == PeriphAddress || 0 == MemAddress)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        /* Addresses & Length Can Only Be Written While The Channel is Disabled */
+        DMA1->Channel[Channel].CCR &= (~(1UL << DMA_EN));
+
+        /* Clear Any Stale Flags From a Previous Transfer */
+        DMA1->IFCR = (DMA_CHANNEL_FLAGS_MASK << DMA_FLAGS_SHIFT(Channel));
+
+        DMA1->Channel[Channel].CPAR = PeriphAddress;
+        DMA1->Channel[Channel].CMAR = MemAddress;
+        DMA1->Channel[Channel].CNDTR = Length;
+
+        /* Enable Only The Interrupts Someone is Waiting For */
+        if (NULL != DMA_PTR_TO_FUNC[Channel][DMA_IT_TC])
+        {
+            Local_u32ITEnable |= (1UL << DMA_TCIE);
+        }
+        if (NULL != DMA_PTR_TO_FUNC[Channel][DMA_IT_HT])
+        {
+            Local_u32ITEnable |= (1UL << DMA_HTIE);
+        }
+        if (NULL != DMA_PTR_TO_FUNC[Channel][DMA_IT_TE])
+        {
+            Local_u32ITEnable |= (1UL << DMA_TEIE);
+        }
+
+        DMA1->Channel[Channel].CCR = (DMA1->Channel[Channel].CCR & (~DMA_CCR_IT_MASK)) | Local_u32ITEnable;
+
+        /* Enable Channel */
+        DMA1->Channel[Channel].CCR |= (1UL << DMA_EN);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop a Running Transfer on a DMA Channel
+ * @fn     : DMA_StopTransfer
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t DMA_StopTransfer(DMA_Channel_t Channel)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    if (Channel < DMA_CHANNEL_1 || Channel > DMA_CHANNEL_7)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else
+    {
+        /* Disable Channel & Its Interrupts */
+        DMA1->Channel[Channel].CCR &= (~((1UL << DMA_EN) | DMA_CCR_IT_MASK));
+
+        /* Clear Channel Flags */
+        DMA1->IFCR = (DMA_CHANNEL_FLAGS_MASK << DMA_FLAGS_SHIFT(Channel));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Number of Items Left to Be Transferred on a DMA Channel
+ * @fn     : DMA_GetRemaining
+ * @param  : Channel   => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @param  : Remaining => This Parameter is Used to Return The Number of Items Left
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t DMA_GetRemaining(DMA_Channel_t Channel, uint16_t *Remaining)
+{
+    ERRORS_t Local_u8ErrorStatus = DMA_OK;
+
+    if (Channel < DMA_CHANNEL_1 || Channel > DMA_CHANNEL_7)
+    {
+        Local_u8ErrorStatus = DMA_NOK;
+    }
+    else if (NULL == Remaining)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        *Remaining = (uint16_t)DMA1->Channel[Channel].CNDTR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @brief  : This Function is Used to Handle The Interrupts of a DMA Channel
+ * @fn     : DMA_HANDLE_IT
+ * @param  : Channel => This Parameter is Used to Select The DMA Channel -> @DMA_Channel_t
+ * @return : void
+ * @note   : This Function is Used Inside All IRQ Handlers to Handle The Interrupts ( Private Function )
+ */
+static void DMA_HANDLE_IT(DMA_Channel_t Channel)
+{
+    uint32_t Local_u32Flags = (DMA1->ISR >> DMA_FLAGS_SHIFT(Channel)) & DMA_CHANNEL_FLAGS_MASK;
+    uint32_t Local_u32CCR = DMA1->Channel[Channel].CCR;
+
+    /* Transfer Error , Hardware Has Already Disabled The Channel */
+    if ((Local_u32Flags & (1UL << DMA_TEIF)) && (Local_u32CCR & (1UL << DMA_TEIE)))
+    {
+        DMA1->IFCR = (DMA_CHANNEL_FLAGS_MASK << DMA_FLAGS_SHIFT(Channel));
+        DMA1->Channel[Channel].CCR &= (~DMA_CCR_IT_MASK);
+
+        if (NULL != DMA_PTR_TO_FUNC[Channel][DMA_IT_TE])
+        {
+            DMA_PTR_TO_FUNC[Channel][DMA_IT_TE](Channel);
+        }
+        return;
+    }
+
+    /* Half Transfer */
+    if ((Local_u32Flags & (1UL << DMA_HTIF)) && (Local_u32CCR & (1UL << DMA_HTIE)))
+    {
+        DMA1->IFCR = ((1UL << DMA_HTIF) << DMA_FLAGS_SHIFT(Channel));
+
+        if (NULL != DMA_PTR_TO_FUNC[Channel][DMA_IT_HT])
+        {
+            DMA_PTR_TO_FUNC[Channel][DMA_IT_HT](Channel);
+        }
+    }
+
+    /* Transfer Complete */
+    if ((Local_u32Flags & (1UL << DMA_TCIF)) && (Local_u32CCR & (1UL << DMA_TCIE)))
+    {
+        DMA1->IFCR = ((1UL << DMA_TCIF) << DMA_FLAGS_SHIFT(Channel));
+
+        if (0 == (Local_u32CCR & (1UL << DMA_CIRC)))
+        {
+            /* Normal Mode , Channel is Done */
+            DMA1->Channel[Channel].CCR &= (~((1UL << DMA_EN) | DMA_CCR_IT_MASK));
+        }
+
+        if (NULL != DMA_PTR_TO_FUNC[Channel][DMA_IT_TC])
+        {
+            DMA_PTR_TO_FUNC[Channel][DMA_IT_TC](Channel);
+        }
+    }
+}
+
+/*==============================================================================================================================================
+ * INTERRUPT HANDLERS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/* DMA1 Channel 1 Interrupt Handler */
+void DMA1_Channel1_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_1);
+}
+
+/* DMA1 Channel 2 Interrupt Handler */
+void DMA1_Channel2_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_2);
+}
+
+/* DMA1 Channel 3 Interrupt Handler */
+void DMA1_Channel3_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_3);
+}
+
+/* DMA1 Channel 4 Interrupt Handler */
+void DMA1_Channel4_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_4);
+}
+
+/* DMA1 Channel 5 Interrupt Handler */
+void DMA1_Channel5_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_5);
+}
+
+/* DMA1 Channel 6 Interrupt Handler */
+void DMA1_Channel6_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_6);
+}
+
+/* DMA1 Channel 7 Interrupt Handler */
+void DMA1_Channel7_IRQHandler(void)
+{
+    DMA_HANDLE_IT(DMA_CHANNEL_7);
+}
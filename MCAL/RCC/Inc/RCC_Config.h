@@ -0,0 +1,30 @@
+/*
+ ******************************************************************************
+ * @file           : RCC_Config.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Configuration File
+ * @version        : 1.0.1
+ * @Date           : Sep 9, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ */
+
+
+#ifndef RCC_RCC_CONFIG_H_
+#define RCC_RCC_CONFIG_H_
+
+/* ------------------------------------------------------------------ */
+/* ----------------------- Oscillator Values ----------------------- */
+/* ------------------------------------------------------------------ */
+
+/* External Crystal Frequency Mounted on The Board ( Hz ) */
+#define RCC_HSE_VALUE                       8000000UL
+
+/* Internal RC Oscillator Frequency ( Hz ) */
+#define RCC_HSI_VALUE                       8000000UL
+
+
+#endif /* RCC_RCC_CONFIG_H_ */
@@ -427,6 +427,89 @@ uint8_t RCC_APB2EnableCLK ( RCC_APB2_t Copy_eAPB2Peripheral ) ;
 uint8_t RCC_APB2DisableCLK ( RCC_APB2_t Copy_eRCC_APB2_tAPB2Peripheral ) ;
 
 
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_APB1ResetPeripheral                                      ----------------- */
+/* ----------------      FUNCTION : Reset The Registers of an APB1 Peripheral                    ----------------- */
+/* ----------------      ARGUMENT : APB1 Peripheral to Reset Enum Type                           ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------                 Same Peripherals as RCC_APB1EnableCLK                        ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------      RETURN   : Erorr Status                                                 ----------------- */
+/* ----------------      NOTE     : The Clock is Left as it is , The Registers Go Back to Reset  ----------------- */
+/* ----------------                 Values & Any Data Held in The Peripheral is Dropped          ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint8_t RCC_APB1ResetPeripheral ( RCC_APB1_t Copy_eAPB1Peripheral ) ;
+
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_APB2ResetPeripheral                                      ----------------- */
+/* ----------------      FUNCTION : Reset The Registers of an APB2 Peripheral                    ----------------- */
+/* ----------------      ARGUMENT : APB2 Peripheral to Reset Enum Type                           ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------                 Same Peripherals as RCC_APB2EnableCLK                        ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------      RETURN   : Erorr Status                                                 ----------------- */
+/* ----------------      NOTE     : The Clock is Left as it is , The Registers Go Back to Reset  ----------------- */
+/* ----------------                 Values & Any Data Held in The Peripheral is Dropped          ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint8_t RCC_APB2ResetPeripheral ( RCC_APB2_t Copy_eAPB2Peripheral ) ;
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetSYSCLKFreq                			     	     ----------------- */
+/* ----------------      FUNCTION : Get The Current System Clock Frequency in Hz    	         ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : SYSCLK Frequency ( Hz )                                      ----------------- */
+/* ----------------      NOTE     : Decoded From SWS , PLLSRC , PLLXTPRE & PLLMUL in RCC_CFGR    ----------------- */
+/* ----------------                 Using RCC_HSE_VALUE & RCC_HSI_VALUE in RCC_Config.h          ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetSYSCLKFreq ( void ) ;
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetHCLKFreq                			     	         ----------------- */
+/* ----------------      FUNCTION : Get The Current AHB Clock Frequency in Hz    	             ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : HCLK Frequency ( Hz )                                        ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetHCLKFreq ( void ) ;
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetPCLK1Freq                			     	         ----------------- */
+/* ----------------      FUNCTION : Get The Current APB1 Clock Frequency in Hz    	             ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : PCLK1 Frequency ( Hz )                                       ----------------- */
+/* ----------------      NOTE     : Clocks USART2 , USART3 , SPI2 , I2C1 & I2C2                  ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetPCLK1Freq ( void ) ;
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetPCLK2Freq                			     	         ----------------- */
+/* ----------------      FUNCTION : Get The Current APB2 Clock Frequency in Hz    	             ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : PCLK2 Frequency ( Hz )                                       ----------------- */
+/* ----------------      NOTE     : Clocks USART1 & SPI1                                         ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetPCLK2Freq ( void ) ;
+
+
+
 /* ---------------------------------------------------------------------------------------- */
 /* ------------------------------- PROTOTYPES SECTION END   ------------------------------- */
 /* ---------------------------------------------------------------------------------------- */
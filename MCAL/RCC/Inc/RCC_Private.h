@@ -33,6 +33,20 @@
 #define SW_MASK                   (uint32_t)0xFFFFFFFC
 #define PLL_MUL_MASK              (uint32_t)0xFFC3FFFF
 
+/* CFGR Fields Read Back By The Clock Frequency Getters */
+#define SWS_READ_MASK             (uint32_t)0x00000003
+#define PLL_MUL_READ_MASK         (uint32_t)0x0000000F
+#define HPRE_READ_MASK            (uint32_t)0x0000000F
+#define PPRE_READ_MASK            (uint32_t)0x00000007
+
+/* SWS Values */
+#define SWS_HSI                   (uint32_t)0x00000000
+#define SWS_HSE                   (uint32_t)0x00000001
+#define SWS_PLL                   (uint32_t)0x00000002
+
+/* PLLMUL 0b1110 & 0b1111 Both Mean x16 */
+#define PLL_MUL_MAX               (uint32_t)16
+
 
 
 /* ------------------------------------------------------------ */
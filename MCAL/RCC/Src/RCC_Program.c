@@ -23,6 +23,7 @@
 
 #include "../Inc/RCC_Private.h"
 #include "../Inc/RCC_Interface.h"
+#include "../Inc/RCC_Config.h"
 
 /* ---------------------------------------------------------------------------------------------------------------------------- */
 /* -------------------------------------------------- INCLUDES SECTION END   -------------------------------------------------- */
@@ -30,6 +31,18 @@
 
 
 
+/* ---------------------------------------------------------------------------------------------------------------------------- */
+/* -------------------------------------------------- GLOBAL VARIABLES SECTION ------------------------------------------------ */
+/* ---------------------------------------------------------------------------------------------------------------------------- */
+
+/* Right Shift Applied to SYSCLK For Each HPRE Value ( /1 , /2 .. /512 , Note That /32 Does Not Exist ) */
+static const uint8_t RCC_AHBPrescShift[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9 } ;
+
+/* Right Shift Applied to HCLK For Each PPRE1 / PPRE2 Value ( /1 , /2 .. /16 ) */
+static const uint8_t RCC_APBPrescShift[8]  = { 0, 0, 0, 0, 1, 2, 3, 4 } ;
+
+
+
 /* ---------------------------------------------------------------------------------------------------------------------------- */
 /* -------------------------------------------------- MAIN FUNCTIONS SECTION -------------------------------------------------- */
 /* ---------------------------------------------------------------------------------------------------------------------------- */
@@ -540,6 +553,174 @@ uint8_t RCC_APB2DisableCLK ( RCC_APB2_t Copy_eAPB2Peripheral )
 	return Local_ErrorStatus ;
 }
 
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_APB1ResetPeripheral                                      ----------------- */
+/* ----------------      FUNCTION : Reset The Registers of an APB1 Peripheral                    ----------------- */
+/* ----------------      ARGUMENT : APB1 Peripheral to Reset Enum Type                           ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------                 Same Peripherals as RCC_APB1EnableCLK                        ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------      RETURN   : Erorr Status                                                 ----------------- */
+/* ----------------      NOTE     : The Clock is Left as it is , The Registers Go Back to Reset  ----------------- */
+/* ----------------                 Values & Any Data Held in The Peripheral is Dropped          ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint8_t RCC_APB1ResetPeripheral ( RCC_APB1_t Copy_eAPB1Peripheral )
+{
+	/* Error Status to If Wrong Input is Detected */
+	uint8_t Local_ErrorStatus = OK ;
+
+	/* Pulse The Reset Bit , Same Position as The Enable Bit */
+	if( ( Copy_eAPB1Peripheral >= TIM2_CLK ) && ( Copy_eAPB1Peripheral <= DAC_CLK ) )
+	{
+		RCC -> RCC_APB1RSTR |= ( 1 << Copy_eAPB1Peripheral )  ;
+		RCC -> RCC_APB1RSTR &= ( ~ ( 1 << Copy_eAPB1Peripheral ) )  ;
+	}
+	else
+	{
+		Local_ErrorStatus = APB1RstPeripheralError ;
+	}
+	return Local_ErrorStatus ;
+}
+
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_APB2ResetPeripheral                                      ----------------- */
+/* ----------------      FUNCTION : Reset The Registers of an APB2 Peripheral                    ----------------- */
+/* ----------------      ARGUMENT : APB2 Peripheral to Reset Enum Type                           ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------                 Same Peripherals as RCC_APB2EnableCLK                        ----------------- */
+/* ----------------                                                                              ----------------- */
+/* ----------------      RETURN   : Erorr Status                                                 ----------------- */
+/* ----------------      NOTE     : The Clock is Left as it is , The Registers Go Back to Reset  ----------------- */
+/* ----------------                 Values & Any Data Held in The Peripheral is Dropped          ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint8_t RCC_APB2ResetPeripheral ( RCC_APB2_t Copy_eAPB2Peripheral )
+{
+	/* Error Status to If Wrong Input is Detected */
+	uint8_t Local_ErrorStatus = OK ;
+
+	/* Pulse The Reset Bit , Same Position as The Enable Bit */
+	if( ( Copy_eAPB2Peripheral >= AFIO_CLK ) && ( Copy_eAPB2Peripheral <= TIM11_CLK ) )
+	{
+		RCC -> RCC_APB2RSTR |= ( 1 << Copy_eAPB2Peripheral )  ;
+		RCC -> RCC_APB2RSTR &= ( ~ ( 1 << Copy_eAPB2Peripheral ) )  ;
+	}
+	else
+	{
+		Local_ErrorStatus = APB2RstPeripheralError ;
+	}
+	return Local_ErrorStatus ;
+}
+
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetSYSCLKFreq                			     	     ----------------- */
+/* ----------------      FUNCTION : Get The Current System Clock Frequency in Hz    	         ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : SYSCLK Frequency ( Hz )                                      ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetSYSCLKFreq ( void )
+{
+	uint32_t Local_u32CFGR    = RCC -> RCC_CFGR ;
+	uint32_t Local_u32SYSCLK  = RCC_HSI_VALUE ;
+	uint32_t Local_u32PLLMul  = 0 ;
+	uint32_t Local_u32PLLIn   = 0 ;
+
+	switch ( ( Local_u32CFGR >> CFGR_SWS ) & SWS_READ_MASK )
+	{
+	case SWS_HSE :
+		Local_u32SYSCLK = RCC_HSE_VALUE ;
+		break ;
+
+	case SWS_PLL :
+		/* PLLMUL Field Starts at x2 */
+		Local_u32PLLMul = ( ( Local_u32CFGR >> CFGR_PLLMUL ) & PLL_MUL_READ_MASK ) + 2U ;
+		if( Local_u32PLLMul > PLL_MUL_MAX )
+		{
+			Local_u32PLLMul = PLL_MUL_MAX ;
+		}
+
+		if( Local_u32CFGR & ( 1UL << CFGR_PLLSRC ) )
+		{
+			/* HSE , Optionally Divided By 2 */
+			Local_u32PLLIn = ( Local_u32CFGR & ( 1UL << CFGR_PLLXTPRE ) ) ? ( RCC_HSE_VALUE >> 1 ) : RCC_HSE_VALUE ;
+		}
+		else
+		{
+			/* HSI is Always Divided By 2 at The PLL Entry */
+			Local_u32PLLIn = ( RCC_HSI_VALUE >> 1 ) ;
+		}
+		Local_u32SYSCLK = Local_u32PLLIn * Local_u32PLLMul ;
+		break ;
+
+	default :
+		/* HSI */
+		break ;
+	}
+	return Local_u32SYSCLK ;
+}
+
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetHCLKFreq                			     	         ----------------- */
+/* ----------------      FUNCTION : Get The Current AHB Clock Frequency in Hz    	             ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : HCLK Frequency ( Hz )                                        ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetHCLKFreq ( void )
+{
+	uint32_t Local_u32HPRE = ( ( RCC -> RCC_CFGR ) >> CFGR_HPRE ) & HPRE_READ_MASK ;
+
+	return ( RCC_u32GetSYSCLKFreq() >> RCC_AHBPrescShift[Local_u32HPRE] ) ;
+}
+
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetPCLK1Freq                			     	         ----------------- */
+/* ----------------      FUNCTION : Get The Current APB1 Clock Frequency in Hz    	             ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : PCLK1 Frequency ( Hz )                                       ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetPCLK1Freq ( void )
+{
+	uint32_t Local_u32PPRE1 = ( ( RCC -> RCC_CFGR ) >> CFGR_PPRE1 ) & PPRE_READ_MASK ;
+
+	return ( RCC_u32GetHCLKFreq() >> RCC_APBPrescShift[Local_u32PPRE1] ) ;
+}
+
+
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* ----------------      NAME     : RCC_u32GetPCLK2Freq                			     	         ----------------- */
+/* ----------------      FUNCTION : Get The Current APB2 Clock Frequency in Hz    	             ----------------- */
+/* ----------------      ARGUMENT : Void                                                         ----------------- */
+/* ----------------      RETURN   : PCLK2 Frequency ( Hz )                                       ----------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+/* --------------------------------------------------------------------------------------------------------------- */
+uint32_t RCC_u32GetPCLK2Freq ( void )
+{
+	uint32_t Local_u32PPRE2 = ( ( RCC -> RCC_CFGR ) >> CFGR_PPRE2 ) & PPRE_READ_MASK ;
+
+	return ( RCC_u32GetHCLKFreq() >> RCC_APBPrescShift[Local_u32PPRE2] ) ;
+}
+
 /* ******************************************************************************************************* */
 /* ***************************************** SOURCE REVISION LOG ***************************************** */
 /* ******************************************************************************************************* */
@@ -547,5 +728,6 @@ uint8_t RCC_APB2DisableCLK ( RCC_APB2_t Copy_eAPB2Peripheral )
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  *
    Mohammed Ayman            11APR2023                       ALL Functions
    Mohammed Ayman            12APR2023                       Documentation For Functions
+   Mohammed Ayman            09SEP2023                       Clock Frequency Getters
 
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -106,6 +106,8 @@ typedef enum
  * ========================================================================
  *  @brief : This Enum is used to select the SPI CRC Status
  *  @enum  : @SPI_CRC_STATUS_t
+ *  @note  : When Enabled , The Buffer Transfers in Full Duplex & Simplex Tx Modes Append The CRC After The Data
+ *           & Check The Received One , a Mismatch is Reported as SPI_CRC_ERROR
  * ========================================================================
  */
 typedef enum
@@ -286,6 +288,7 @@ typedef struct
     SPI_SS_OTYPE_t SlaveSelectOutputType;
     SPI_CRC_STATUS_t CRC_Status;
     SPI_IT_ENABLE_t InterruptEnable;
+    uint16_t CRCPolynomial; /* Written to CRCPR When CRC is Enabled , 0 Keeps The Reset Value ( 0x0007 ) */
 
 } SPI_Config_t;
 
@@ -314,6 +317,16 @@ ERRORS_t SPI_Init(SPI_Config_t *Config);
  */
 ERRORS_t SPI_ENABLE_IT(SPI_Config_t *Config);
 
+/**
+ * @brief  : This Function is Used to Change The Frame Format of an Initialized SPI Master ( Clock Polarity , Clock Phase , BaudRate , Data Width & Direction )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @return : ERRORS_t => SPI_BUSY if a Non Blocking Transfer is Still Running on The Peripheral
+ * @note   : Only The Format Bits of CR1 Are Rewritten , & Only if They Differ From The Current Ones
+ *           CR2 , The Mode & The Slave Management Are Kept , So Switching Between Devices Sharing a Bus is Cheap
+ */
+ERRORS_t SPI_SetFrameFormat(SPI_Config_t *Config);
+
 /**
  * @brief  : This Function is Used to Read SPI Flag Status ( Set or Reset )
  *
@@ -389,12 +402,28 @@ ERRORS_t SPI_TransceiveData(SPI_Config_t *Config, uint16_t *ReceivedData, uint16
  * @param  : ReceviedBuffer => This is a Pointer to uint8_t Array That Holds The Received Data
  * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent
  * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
- * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @return : ERRORS_t => SPI_NOK if The Peripheral is Configured For 16 Bit Frames ( Use SPI_TransceiveBuffer16 )
  * @note   : IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter ,
  *      IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter
+ *      In Full Duplex & Simplex Tx Modes The Next Item is Written While The Current One is Shifting Out ,
+ *      So The Clock Runs Back to Back & Each Item Costs One Frame Only
+ *      With CRC Enabled The CRC Follows The Last Item & SPI_CRC_ERROR is Returned if The Received One Does Not Match
+ *      SPI_OVERRUN_ERROR is Returned if an Interrupt Delayed The Reads Long Enough For a Received Item to Be Lost ,
+ *      The Transfer is Aborted & The Received Buffer is Only Partially Filled
  */
 ERRORS_t SPI_TransceiveBuffer(SPI_Config_t *Config, uint8_t *ReceviedBuffer, uint8_t *BufferToSend, uint16_t BufferSize);
 
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames at The Same Time
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @return : ERRORS_t => SPI_NOK if The Peripheral is Configured For 8 Bit Frames ( Use SPI_TransceiveBuffer )
+ * @note   : Same Behavior as SPI_TransceiveBuffer With DataWidth Set to SPI_2BYTE , a Dummy 0xFFFF is Sent if BufferToSend is NULL
+ */
+ERRORS_t SPI_TransceiveBuffer16(SPI_Config_t *Config, uint16_t *ReceivedBuffer, const uint16_t *BufferToSend, uint16_t BufferSize);
+
 /**
  * @brief  : This Function is Used to Send & Receive Data Using Interrupts ( Non Blocking Function ) AKA Asynchronous
  *
@@ -416,10 +445,110 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
  * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent
  * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
  * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
- * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer is Still Running on The Same Peripheral , SPI_NOK For 16 Bit Frames
  * @note   : You Can Use This Function Directly without Enabling RXNE Interrupt in The Configuration Struct , as This Function Enables it Automatically
  *         if You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can NULL to The BufferToSend Parameter
+ *         In Full Duplex & Simplex Tx Modes Both Buffers Are Transferred at The Same Time , a Dummy 0xFF is Sent if BufferToSend is NULL
+ *         Each Peripheral Has Its Own Context , So SPI1 & SPI2 Transfers Can Run in Parallel
+ *         With CRC Enabled The Call Back Can Read The CRC Check Result Through SPI_GetTransferStatus
+ *         While Receiving The Error Interrupt is Enabled , an Overrun Ends The Transfer & is Reported Through SPI_GetTransferStatus
  */
 ERRORS_t SPI_TransceiveBuffer_IT(SPI_Config_t *Config, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
 
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Using Interrupts ( Non Blocking Function ) AKA Asynchronous
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer is Still Running on The Same Peripheral , SPI_NOK For 8 Bit Frames
+ * @note   : Same Behavior as SPI_TransceiveBuffer_IT With DataWidth Set to SPI_2BYTE , a Dummy 0xFFFF is Sent if BufferToSend is NULL
+ */
+ERRORS_t SPI_TransceiveBuffer16_IT(SPI_Config_t *Config, uint16_t *ReceivedBuffer, const uint16_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Get The Result of The Last SPI_TransceiveBuffer_IT / SPI_TransceiveBuffer16_IT Transfer
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Status => This Parameter is Used to Return SPI_OK , SPI_CRC_ERROR if The Received CRC Did Not Match ,
+ *           or SPI_OVERRUN_ERROR if a Received Item Was Lost & The Transfer Was Ended Early
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Meant to Be Called From The Completion Call Back
+ */
+ERRORS_t SPI_GetTransferStatus(SPI_t SPINum, ERRORS_t *Status);
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of Data Through DMA ( Non Blocking Function )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent , Must Stay Valid Until The Call Back
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t Array That Holds The Received Data , Must Stay Valid Until The Call Back
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked With SPI_OK When The Last Item is Received or SPI_NOK on a DMA Error ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver , SPI_NOK For 16 Bit Frames
+ * @note   : DMA1 Clock Must Be Enabled & The Channel IRQs Enabled in NVIC ( SPI1 => CH2 & CH3 , SPI2 => CH4 & CH5 )
+ *           IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , The Received Bytes Are Discarded
+ *           IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter , a Dummy 0xFF is Sent For Each Byte
+ *           Full Duplex & Simplex Tx Modes Only , The Call Back Runs in Interrupt Context
+ *           With CRC Enabled The Call Back Gets SPI_CRC_ERROR if The Received CRC Does Not Match
+ */
+ERRORS_t SPI_TransferDMA(SPI_Config_t *Config, const uint8_t *BufferToSend, uint8_t *ReceivedBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(ERRORS_t));
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Through DMA ( Non Blocking Function )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Data to Be Sent , Must Stay Valid Until The Call Back
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Data , Must Stay Valid Until The Call Back
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked With SPI_OK When The Last Frame is Received or SPI_NOK on a DMA Error ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver , SPI_NOK For 8 Bit Frames
+ * @note   : Same Behavior as SPI_TransferDMA With DataWidth Set to SPI_2BYTE , Both Channels Move Half Words
+ */
+ERRORS_t SPI_TransferDMA16(SPI_Config_t *Config, const uint16_t *BufferToSend, uint16_t *ReceivedBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(ERRORS_t));
+
+/**
+ * @brief  : This Function is Used to Start The Slave Engine , Answering Each Master Transaction With a Pre Armed Response ( Non Blocking Function )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : RxBuffer0 => This is a Pointer to uint8_t Array That Receives The Bytes of Even Transactions
+ * @param  : RxBuffer1 => This is a Pointer to uint8_t Array That Receives The Bytes of Odd Transactions
+ * @param  : RxSize => This is a Variable of Type uint16_t That Holds The Size of Each Rx Buffer , Extra Bytes in a Transaction Are Dropped
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked After Each Transaction With The Filled Rx Buffer & The Number of Received Bytes ( May Be NULL )
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer Owns The Peripheral , DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver
+ * @note   : Slave , Full Duplex , 8 Bit Frames , No CRC & Hardware NSS Only ( SPI1 => PA4 , SPI2 => PB12 ) , SPI_Init Must Be Called First
+ *           AFIO & DMA1 Clocks Must Be Enabled & The NSS EXTI IRQ Enabled in NVIC ( SPI1 => PA4 EXTI4 , SPI2 => PB12 EXTI15_10 ) Before This Call
+ *           Both Directions Run Through DMA , So The Response is Clocked Out at Any SCK Rate Without CPU Help
+ *           The Transaction Ends on NSS Rising Edge , Where The Published Response is Swapped in & The Next Transaction is Armed
+ *           The Master Must Leave a Gap After NSS Rises That Covers The EXTI Interrupt Latency Before it Pulls NSS Low Again
+ *           The Call Back Runs in Interrupt Context , Its Rx Buffer Stays Untouched Until The Next Transaction Ends
+ */
+ERRORS_t SPI_SlaveStart(SPI_Config_t *Config, uint8_t *RxBuffer0, uint8_t *RxBuffer1, uint16_t RxSize, void (*pv_CallBackFunc)(const uint8_t *ReceivedBuffer, uint16_t ReceivedSize));
+
+/**
+ * @brief  : This Function is Used to Publish The Response The Slave Engine Sends in The Next Transaction
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @param  : Response => This is a Pointer to uint8_t Array That Holds The Response , NULL Sends 0xFF Dummy Bytes
+ * @param  : ResponseSize => This is a Variable of Type uint16_t That Holds The Size of The Response
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Safe to Call While a Transaction is Clocked Out , The Response Takes Effect on The Next NSS Rising Edge
+ *           Publishing Again Before That Edge Replaces The Previous One , Without a New One The Current Response is Sent Again
+ *           The Response Must Stay Valid Until a Newer One is Swapped in on a Later NSS Rising Edge
+ *           Bytes The Master Clocks Past The End of The Response Repeat Its Last Byte
+ *           May Be Called Before SPI_SlaveStart to Arm The First Response
+ */
+ERRORS_t SPI_SlavePublish(SPI_t SPINumber, const uint8_t *Response, uint16_t ResponseSize);
+
+/**
+ * @brief  : This Function is Used to Stop The Slave Engine & Give Both DMA Channels Back
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @return : ERRORS_t => SPI_NOK if The Slave Engine is Not Running on This Peripheral
+ * @note   : The Peripheral is Left as SPI_Init Left it , Its TXEIE & RXNEIE Settings Are Put Back
+ */
+ERRORS_t SPI_SlaveStop(SPI_t SPINumber);
+
 #endif /* SPI_INTERFACE_H_ */
@@ -46,31 +46,109 @@ static ERRORS_t SPI_SetMode(SPI_Config_t *Config);
  */
 static ERRORS_t SPI_HANDLE_IT(SPI_t SPINumber);
 
+/**
+ * @brief  : Width Independent Workers Behind The 8 & 16 Bit Buffer Functions ( Private Functions )
+ * @note   : The Buffers Hold uint8_t or uint16_t Items Following The DataWidth in The Configuration Struct
+ */
+static ERRORS_t SPI_TransferItems(SPI_Config_t *Config, void *ReceivedBuffer, const void *BufferToSend, uint16_t BufferSize);
+static ERRORS_t SPI_StartTransferItems_IT(SPI_Config_t *Config, void *ReceivedBuffer, const void *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+static ERRORS_t SPI_StartTransferItems_DMA(SPI_Config_t *Config, const void *BufferToSend, void *ReceivedBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(ERRORS_t));
+
+/**
+ * @brief  : Helpers to Access 8 or 16 Bit Buffers Following The Peripheral DataWidth ( Private Functions )
+ */
+static uint16_t SPI_ReadItem(const void *Buffer, uint16_t Index, SPI_DATA_SIZE_t DataWidth);
+static void SPI_WriteItem(void *Buffer, uint16_t Index, uint16_t Item, SPI_DATA_SIZE_t DataWidth);
+
+/**
+ * @brief  : Hardware CRC Helpers Used By The Buffer Transfers ( Private Functions )
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ */
+static void SPI_ResetCRC(SPI_t SPINumber);
+static ERRORS_t SPI_CheckCRC(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Clear The Overrun Flag & Drop The Item Left in DR
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ */
+static void SPI_ClearOverrun(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Find The SPI Peripheral Served By a DMA Channel
+ *
+ * @param  : Channel => This Parameter is Used to Pass The DMA Channel That Raised The Interrupt
+ * @param  : ChannelMap => This Parameter is Used to Pass The Rx or Tx Channel Table
+ * @return : SPI_t => The SPI Peripheral Number , or SPI_MAX_NUM if No Peripheral Uses This Channel
+ */
+static SPI_t SPI_DMA_FindPeriph(DMA_Channel_t Channel, const DMA_Channel_t *ChannelMap);
+
+/**
+ * @brief  : This Function is Used to Stop an SPI DMA Transfer & Give Both Channels Back
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @param  : Status => This Parameter is Used to Pass The Transfer Result to The Call Back Function
+ */
+static void SPI_DMA_EndTransfer(SPI_t SPINumber, ERRORS_t Status);
+
+/**
+ * @brief  : DMA CallBacks Used By SPI_TransferDMA ( Private Functions )
+ * @param  : Channel => This Parameter is Used to Pass The DMA Channel That Raised The Interrupt
+ */
+static void SPI_DMA_TransferComplete(DMA_Channel_t Channel);
+static void SPI_DMA_TransferError(DMA_Channel_t Channel);
+
+/**
+ * @brief  : This Function is Used to Reset an SPI Peripheral Through RCC & Reload The Slave Engine Settings
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @note   : The Reset Drops The Byte Left in DR & The Shift Register By The Last Transaction , SPE is Left Cleared
+ */
+static void SPI_SlaveReset(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to Arm Both DMA Channels of The Slave Engine For The Next Transaction & Enable The Peripheral
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @note   : The First Response Byte is Moved to DR Here , Before The Master Pulls NSS Low
+ */
+static void SPI_SlaveArm(SPI_t SPINumber);
+
+/**
+ * @brief  : This Function is Used to End a Slave Transaction on NSS Rising Edge , Swap The Buffers & Arm The Next One
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ */
+static void SPI_SlaveNSSRise(SPI_t SPINumber);
+
+/**
+ * @brief  : EXTI CallBacks of The NSS Pins , One Per Peripheral ( Private Functions )
+ */
+static void SPI_Slave1NSSRise(void);
+static void SPI_Slave2NSSRise(void);
+
 /* ======================================================================
  * PRIVATE MACROS
  * ====================================================================== */
 
 #define SPI_BR_MASK 0xFFC7
 
-#define SPI_BUFFER_SIZE_NOT_REACHED 0x00
-#define SPI_BUFFER_SIZE_REACHED 0x01
+/* CPHA , CPOL , BR[2:0] , LSBFIRST & DFF Bits of CR1 */
+#define SPI_FRAME_FORMAT_MASK 0x08BB
+
+/* Value Clocked Out When Only Receiving is Required , 8 Bit Frames Only Use The Low Byte */
+#define SPI_DUMMY_ITEM 0xFFFF
+
+/* One Item in The Shift Register & One Waiting in DR */
+#define SPI_MAX_ITEMS_IN_FLIGHT 2U
+
+/* The Slave Engine Receives in One Buffer While The Application Reads The Other */
+#define SPI_SLAVE_RX_BUFFERS 2U
+
 
 /* ======================================================================
  * PRIVATE ENUMS
  * ====================================================================== */
 
-/**
- * @brief  : This Enum is Used to Specify The SPI Interrupts
- */
-typedef enum
-{
-    SPI_IT_TXE = 0x00,
-    SPI_IT_RXNE = 0x01,
-    SPI_IT_ERR = 0x02,
-    SPI_IT_MAX_NUM = 0x03
-
-} SPI_IT_SRC_t;
-
 /**
  * @brief  : This Enum is Used to Specify The SPI Interrupt Sources
  */
@@ -79,15 +157,91 @@ typedef enum
     SPI_NO_IRQ_SRC = 0x00,
     SPI_TRANSCEIVE_DATA_IRQ_SRC = 0x01,
     SPI_TRANSCEIVE_BUFFER_IRQ_SRC = 0x02,
+    SPI_TRANSFER_DMA_IRQ_SRC = 0x03,
+    SPI_SLAVE_DMA_IRQ_SRC = 0x04,
 
 } SPI_IRQ_SRC_t;
 
-typedef enum
+/* ======================================================================
+ * PRIVATE STRUCTS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Struct Holds The Transfer State of One SPI Peripheral
+ */
+typedef struct
 {
-    SPI_ROLE_TRANSMIT = 0x00,
-    SPI_ROLE_RECEIVE = 0x01,
-} SPI_ROLE_DIR_t;
+    SPI_IRQ_SRC_t IrqSource;         /* Transfer Currently Owning The Peripheral */
+    uint16_t *DataToBeReceived;      /* SPI_TransceiveData_IT Received Data */
+    const void *TxBuffer;            /* SPI_TransceiveBuffer_IT Buffer to Send , NULL Sends Dummy Items */
+    void *RxBuffer;                  /* SPI_TransceiveBuffer_IT Buffer to Receive in , NULL Discards */
+    SPI_DATA_SIZE_t DataWidth;       /* Buffers Hold uint8_t or uint16_t Items */
+    uint16_t Size;                   /* Items to Transfer */
+    uint16_t TxCounter;              /* Items Written to DR */
+    uint16_t RxCounter;              /* Items Read From DR */
+    uint8_t TxActive;                /* Transmit Side Runs */
+    uint8_t RxActive;                /* Receive Side Runs & Ends The Transfer */
+    uint8_t CrcActive;               /* The Hardware CRC is Sent & Checked After The Data */
+    uint8_t ErrIrqOwned;             /* ERRIE Was Set For This Transfer & is Cleared When it Ends */
+    ERRORS_t Status;                 /* Result of The Last Interrupt Transfer */
+    void (*CallBack)(void);          /* Interrupt Transfer CallBack */
+    void (*DMACallBack)(ERRORS_t);   /* SPI_TransferDMA CallBack */
+
+} SPI_Context_t;
 
+/**
+ * @brief  : This Struct Holds The Slave Engine State of One SPI Peripheral
+ */
+typedef struct
+{
+    const uint8_t *Response;                        /* Response Armed For The Current Transaction , NULL Sends Dummy Bytes */
+    uint16_t ResponseSize;
+    const uint8_t *volatile Pending;                /* Response Published For The Next Transaction */
+    volatile uint16_t PendingSize;
+    volatile uint8_t PendingReady;                  /* Pending is Taken on The Next NSS Rising Edge */
+    uint8_t *RxBuffer[SPI_SLAVE_RX_BUFFERS];
+    uint16_t RxSize;                                /* Size of Each Rx Buffer */
+    uint8_t RxIndex;                                /* Rx Buffer Armed For The Current Transaction */
+    uint16_t CR1;                                   /* Settings Reloaded After Each Peripheral Reset */
+    uint16_t CR2;
+    uint16_t SavedCR2IT;                            /* TXEIE & RXNEIE as SPI_Init Left Them , Put Back By SPI_SlaveStop */
+    void (*CallBack)(const uint8_t *ReceivedBuffer, uint16_t ReceivedSize);
+
+} SPI_Slave_t;
 
+/* ======================================================================
+ * PRIVATE INLINE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Mask All Configurable Interrupts & Return The Previous PRIMASK
+ *
+ * @return : uint32_t => Previous PRIMASK Value to Be Passed to SPI_ExitCritical
+ */
+static inline uint32_t SPI_EnterCritical(void)
+{
+    uint32_t Local_u32PriMask;
+
+    __asm volatile("MRS %0, PRIMASK \n"
+                   "CPSID i"
+                   : "=r"(Local_u32PriMask)
+                   :
+                   : "memory");
+
+    return Local_u32PriMask;
+}
+
+/**
+ * @brief  : This Function is Used to Restore PRIMASK Saved By SPI_EnterCritical
+ *
+ * @param  : PriMask => This Parameter is Used to Pass The Value Returned By SPI_EnterCritical
+ */
+static inline void SPI_ExitCritical(uint32_t PriMask)
+{
+    __asm volatile("MSR PRIMASK, %0"
+                   :
+                   : "r"(PriMask)
+                   : "memory");
+}
 
 #endif /* USART_PRIVATE_H_ */
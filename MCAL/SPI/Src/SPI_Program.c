@@ -22,6 +22,10 @@
 #include "../../../LIB/ErrType.h"
 #include "../../../LIB/STM32F103xx.h"
 
+#include "../../RCC/Inc/RCC_Interface.h"
+#include "../../DMA/Inc/DMA_Interface.h"
+#include "../../EXTI/Inc/EXTI_Interface.h"
+
 #include "../Inc/SPI_Interface.h"
 #include "../Inc/SPI_Private.h"
 
@@ -36,32 +40,29 @@
 /* SPI Peripherals Base Addresses */
 static SPI_RegDef_t *SPI[SPI_MAX_NUM] = {SPI1, SPI2 };
 
-/* SPI Interrupt Pointers to Functions */
-static void (*SPI_PTR_TO_FUNC[SPI_MAX_NUM][SPI_IT_MAX_NUM])(void) = {NULL};
+/* SPI Transfer Contexts , One Per Peripheral So SPI1 & SPI2 Can Transfer at The Same Time */
+static SPI_Context_t SPI_Context[SPI_MAX_NUM] = {0};
 
-/* SPI Transceive Data To Be Received To Use In ISR */
-static uint16_t *SPI_TransceiveDataToBeReceived[SPI_MAX_NUM] = {NULL};
+/* DMA1 Channels Serving Each SPI Peripheral ( RM0008 Table 78 ) */
+static const DMA_Channel_t SPI_DMA_RX_CHANNEL[SPI_MAX_NUM] = {DMA_CHANNEL_2, DMA_CHANNEL_4};
+static const DMA_Channel_t SPI_DMA_TX_CHANNEL[SPI_MAX_NUM] = {DMA_CHANNEL_3, DMA_CHANNEL_5};
 
-/* SPI Transceive Buffer To Be Received To Use In ISR */
-static uint8_t *SPI_TransceiveBufferToBeReceived[SPI_MAX_NUM] = {NULL};
+/* Source of The Dummy Items Clocked Out When No Tx Buffer is Given */
+static const uint16_t SPI_DMADummyTx = SPI_DUMMY_ITEM;
 
-/* SPI Transceive Buffer To Be Sent To Use In ISR */
-static uint8_t *SPI_TransceiveBufferToBeSent[SPI_MAX_NUM] = {NULL};
+/* Sink of The Received Bytes When No Rx Buffer is Given */
+static uint16_t SPI_DMADummyRx = 0;
 
-/* SPI Transceive Buffer Size To Use In ISR */
-static uint16_t SPI_TransceiveBufferSize[SPI_MAX_NUM] = {0};
+/* Slave Engine States , One Per Peripheral */
+static SPI_Slave_t SPI_Slave[SPI_MAX_NUM] = {0};
 
-/* SPI Transceive Buffer Node Role To Check On In ISR */
-/* SPI_MASTER or SPI_SLAVE */
-static SPI_ROLE_t SPI_TransceiveBufferNodeRole[SPI_MAX_NUM] = {0};
+/* Hardware NSS Pins ( Default Mapping ) , The EXTI Line Number is Also The Pin Number */
+static const uint8_t SPI_NSS_AFIO_PORT[SPI_MAX_NUM] = {0U, 1U};
 
-/* SPI Transceive Buffer Role Direction To Check On In ISR */
-/* SPI_ROLE_TRANSMIT or SPI_ROLE_RECEIVE */
-static SPI_ROLE_DIR_t SPI_TransceiveBufferRoleDirection[SPI_MAX_NUM] = {0};
+static const EXTI_LINE_t SPI_NSS_EXTI_LINE[SPI_MAX_NUM] = {EXTI_LINE_4, EXTI_LINE_12};
 
-/* SPI IRQ Sources To Use In ISR */
-/* SPI_NO_IRQ_SRC or SPI_TRANSCEIVE_DATA_IRQ_SRC or SPI_TRANSCEIVE_BUFFER_IRQ_SRC */
-static SPI_IRQ_SRC_t IRQ_SRC[SPI_MAX_NUM] = {SPI_NO_IRQ_SRC};
+/* MEXTI_SetCallBack Does Not Report The Line , So Each Peripheral Gets Its Own CallBack */
+static void (*const SPI_NSS_CALLBACK[SPI_MAX_NUM])(void) = {SPI_Slave1NSSRise, SPI_Slave2NSSRise};
 
 /*==============================================================================================================================================
  * GLOBAL VARIABLES SECTION END
@@ -114,6 +115,12 @@ ERRORS_t SPI_Init(SPI_Config_t *Config)
 		SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_CRCEN));
 		SPI[Config->SPINumber]->CR1 |= (Config->CRC_Status << SPI_CRCEN);
 
+		/* Set CRC Polynomial , Zero Keeps The Reset Value ( 0x0007 ) */
+		if (Config->CRC_Status == SPI_CRC_EN && Config->CRCPolynomial != 0)
+		{
+			SPI[Config->SPINumber]->CRCPR = Config->CRCPolynomial;
+		}
+
 		/* Set Slave Management */
 		/* For Slave Role Only */
 		if (Config->NodeRole == SPI_SLAVE)
@@ -183,6 +190,54 @@ ERRORS_t SPI_ENABLE_IT(SPI_Config_t *Config)
 	return Local_u8ErrorStatus;
 }
 
+/**
+ * @brief  : This Function is Used to Change The Frame Format of an Initialized SPI Master ( Clock Polarity , Clock Phase , BaudRate , Data Width & Direction )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @return : ERRORS_t => SPI_BUSY if a Non Blocking Transfer is Still Running on The Peripheral
+ * @note   : Only The Format Bits of CR1 Are Rewritten , & Only if They Differ From The Current Ones
+ *           CR2 , The Mode & The Slave Management Are Kept , So Switching Between Devices Sharing a Bus is Cheap
+ */
+ERRORS_t SPI_SetFrameFormat(SPI_Config_t *Config)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint16_t Local_u16CR1 = 0;
+
+	if (NULL == Config)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (SPI_INVALID_CONFIG == SPI_CheckConfig(Config) || Config->NodeRole != SPI_MASTER)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_NO_IRQ_SRC != SPI_Context[Config->SPINumber].IrqSource)
+	{
+		/* Another Transfer is Still Running on This Peripheral */
+		Local_u8ErrorStatus = SPI_BUSY;
+	}
+	else
+	{
+		Local_u16CR1 = (SPI[Config->SPINumber]->CR1 & (~SPI_FRAME_FORMAT_MASK)) |
+					   (Config->ClockPhase << SPI_CPHA) | (Config->ClockPolarity << SPI_CPOL) |
+					   (Config->BaudRate << SPI_BR) | (Config->Direction << SPI_LSBFIRST) |
+					   (Config->DataWidth << SPI_DFF);
+
+		if (Local_u16CR1 != SPI[Config->SPINumber]->CR1)
+		{
+			/* The Format Must Not Change in The Middle of a Frame */
+			while (SPI[Config->SPINumber]->SR & (1 << SPI_BUSY_FLAG))
+				;
+
+			/* Disable The Peripheral While Changing The Format , Then Write The New Format & Enable it Back */
+			SPI[Config->SPINumber]->CR1 = (Local_u16CR1 & (~(1 << SPI_SPE)));
+			SPI[Config->SPINumber]->CR1 = (Local_u16CR1 | (1 << SPI_SPE));
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
 /**
  * @brief  : This Function is Used to Read SPI Flag Status ( Set or Reset )
  *
@@ -295,7 +350,7 @@ ERRORS_t SPI_EnableDMALine(SPI_t SPINum, SPI_DMA_LINE_t DMA_Line)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (SPINum < SPI1_APB2 || SPINum > SPI2_APB1)
+	if (SPINum >= SPI1_APB2 && SPINum <= SPI2_APB1)
 	{
 		switch (DMA_Line)
 		{
@@ -330,7 +385,7 @@ ERRORS_t SPI_DisableDMALine(SPI_t SPINum, SPI_DMA_LINE_t DMA_Line)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (SPINum < SPI1_APB2 || SPINum > SPI2_APB1)
+	if (SPINum >= SPI1_APB2 && SPINum <= SPI2_APB1)
 	{
 		switch (DMA_Line)
 		{
@@ -452,28 +507,48 @@ ERRORS_t SPI_TransceiveData(SPI_Config_t *Config, uint16_t *ReceivedData, uint16
  * @param  : ReceviedBuffer => This is a Pointer to uint8_t Array That Holds The Received Data
  * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent
  * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
- * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @return : ERRORS_t => SPI_NOK if The Peripheral is Configured For 16 Bit Frames ( Use SPI_TransceiveBuffer16 )
  * @note   : IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter ,
  *      IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter
+ *      In Full Duplex & Simplex Tx Modes The Next Item is Written While The Current One is Shifting Out ,
+ *      So The Clock Runs Back to Back & Each Item Costs One Frame Only
  */
 ERRORS_t SPI_TransceiveBuffer(SPI_Config_t *Config, uint8_t *ReceviedBuffer, uint8_t *BufferToSend, uint16_t BufferSize)
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	uint16_t Local_u16Counter = 0;
-
-	if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI2_APB1)
+	if (Config->DataWidth != SPI_1BYTE)
 	{
+		/* Each 16 Bit Frame Would Be Truncated Into a Byte */
 		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
-		/* Correct Parameters */
+		Local_u8ErrorStatus = SPI_TransferItems(Config, ReceviedBuffer, BufferToSend, BufferSize);
+	}
+	return Local_u8ErrorStatus;
+}
 
-		for (Local_u16Counter = 0; Local_u16Counter < BufferSize; Local_u16Counter++)
-		{
-			SPI_TransceiveData(Config, (uint16_t *)&ReceviedBuffer[Local_u16Counter], (uint16_t *)&BufferToSend[Local_u16Counter]);
-		}
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames at The Same Time
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @return : ERRORS_t => SPI_NOK if The Peripheral is Configured For 8 Bit Frames ( Use SPI_TransceiveBuffer )
+ * @note   : Same Behavior as SPI_TransceiveBuffer With DataWidth Set to SPI_2BYTE , a Dummy 0xFFFF is Sent if BufferToSend is NULL
+ */
+ERRORS_t SPI_TransceiveBuffer16(SPI_Config_t *Config, uint16_t *ReceivedBuffer, const uint16_t *BufferToSend, uint16_t BufferSize)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Config->DataWidth != SPI_2BYTE)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_u8ErrorStatus = SPI_TransferItems(Config, ReceivedBuffer, BufferToSend, BufferSize);
 	}
 	return Local_u8ErrorStatus;
 }
@@ -497,6 +572,11 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
 	{
 		Local_u8ErrorStatus = SPI_NOK;
 	}
+	else if (SPI_NO_IRQ_SRC != SPI_Context[Config->SPINumber].IrqSource)
+	{
+		/* Another Transfer is Still Running on This Peripheral */
+		Local_u8ErrorStatus = SPI_BUSY;
+	}
 	else
 	{
 		if (pv_CALL_BACK_FUNC != NULL)
@@ -504,17 +584,17 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
 			/* Correct Parameters */
 
 			/* Setting IRQ Source */
-			IRQ_SRC[Config->SPINumber] = SPI_TRANSCEIVE_DATA_IRQ_SRC;
+			SPI_Context[Config->SPINumber].IrqSource = SPI_TRANSCEIVE_DATA_IRQ_SRC;
+
+			/* Set The Call Back Function */
+			SPI_Context[Config->SPINumber].CallBack = pv_CALL_BACK_FUNC;
+
+			/* Set Received Data Globally */
+			SPI_Context[Config->SPINumber].DataToBeReceived = ReceivedData;
 
 			/* Receive Data is Required */
 			if (ReceivedData != NULL)
 			{
-				/* Set The Call Back Function */
-				SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_RXNE] = pv_CALL_BACK_FUNC;
-
-				/* Set Received Data Globally */
-				SPI_TransceiveDataToBeReceived[Config->SPINumber] = ReceivedData;
-
 				/* Check on The Node Role */
 				/* Master Can't Receive Data , So Send Any Value to Initiate Communication */
 				if (Config->NodeRole == SPI_MASTER)
@@ -538,9 +618,6 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
 			/* Sending Data is Required */
 			if (DataToSend != NULL)
 			{
-				/* Set The Call Back Function */
-				SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_TXE] = pv_CALL_BACK_FUNC;
-
 				/* Both Master & Slave Can Send Data */
 				/* Send Data */
 				SPI[Config->SPINumber]->DR = *DataToSend;
@@ -565,352 +642,1205 @@ ERRORS_t SPI_TransceiveData_IT(SPI_Config_t *Config, uint16_t *ReceivedData, uin
  * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent
  * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
  * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
- * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer is Still Running on The Same Peripheral , SPI_NOK For 16 Bit Frames
  * @note   : You Can Use This Function Directly without Enabling RXNE Interrupt in The Configuration Struct , as This Function Enables it Automatically
  *         if You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , IF You Want to Receive Data Only You Can NULL to The BufferToSend Parameter
+ *         In Full Duplex & Simplex Tx Modes Both Buffers Are Transferred at The Same Time , a Dummy 0xFF is Sent if BufferToSend is NULL
+ *         Each Peripheral Has Its Own Context , So SPI1 & SPI2 Transfers Can Run in Parallel
  */
 ERRORS_t SPI_TransceiveBuffer_IT(SPI_Config_t *Config, uint8_t *ReceivedBuffer, uint8_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI2_APB1)
+	if (Config->DataWidth != SPI_1BYTE)
 	{
+		/* Each 16 Bit Frame Would Be Truncated Into a Byte */
 		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
-		/* Correct Parameters */
-		/* Set IRQ Source */
-		IRQ_SRC[Config->SPINumber] = SPI_TRANSCEIVE_BUFFER_IRQ_SRC;
-
-		/* Set Buffer Size Globally */
-		SPI_TransceiveBufferSize[Config->SPINumber] = BufferSize;
-
-		/* Receive Buffer is Required */
-		if (NULL != ReceivedBuffer)
-		{
-			/* Set Call Back Function */
-			SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_RXNE] = pv_CallBackFunc;
-
-			/* Set Direction Globally */
-			SPI_TransceiveBufferRoleDirection[Config->SPINumber] = SPI_ROLE_RECEIVE;
-
-			/* Set ReceivedBuffer Globally */
-			SPI_TransceiveBufferToBeReceived[Config->SPINumber] = ReceivedBuffer;
-
-			/* Check on The Node Role */
-			if (Config->NodeRole == SPI_SLAVE)
-			{
-				/* Set Role Globally */
-				SPI_TransceiveBufferNodeRole[Config->SPINumber] = SPI_SLAVE;
-
-				/* Enable Receive Buffer Not Empty Interrupt */
-				SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXNEIE);
-			}
-			else if (Config->NodeRole == SPI_MASTER)
-			{
-				/* Set Role Globally */
-				SPI_TransceiveBufferNodeRole[Config->SPINumber] = SPI_MASTER;
-
-				/* Wait Until The Transmit Buffer is Empty */
-				SPI_WaitUntilFlagSet(Config->SPINumber, SPI_TRANSMIT_BUFFER_E_FLAG);
-
-				/* Send Any Value to Initiate Communication */
-				SPI[Config->SPINumber]->DR = 0xFF;
-
-				/* Enable Receive Buffer Not Empty Interrupt */
-				SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXNEIE);
-			}
-		}
-
-		/* Sending Buffer is Required */
-		if (BufferToSend != NULL)
-		{
-			/* Set Call Back Function */
-			SPI_PTR_TO_FUNC[Config->SPINumber][SPI_IT_TXE] = pv_CallBackFunc;
-
-			/* Set Direction Globally */
-			SPI_TransceiveBufferRoleDirection[Config->SPINumber] = SPI_ROLE_TRANSMIT;
-
-			/* Set Buffer To Send Globally */
-			SPI_TransceiveBufferToBeSent[Config->SPINumber] = BufferToSend;
-
-			/* wait Until The Transmit Buffer is Empty */
-			SPI_WaitUntilFlagSet(Config->SPINumber, SPI_TRANSMIT_BUFFER_E_FLAG);
-
-			/* Send First Data Item */
-			SPI[Config->SPINumber]->DR = SPI_TransceiveBufferToBeSent[Config->SPINumber][0];
-
-			/* Enable Transmit Buffer Not Interrupt */
-			SPI[Config->SPINumber]->CR2 |= (1 << SPI_TXEIE);
-		}
+		Local_u8ErrorStatus = SPI_StartTransferItems_IT(Config, ReceivedBuffer, BufferToSend, BufferSize, pv_CallBackFunc);
 	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The SPI Mode According to The Required Configuration in The Configuration Struct
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Using Interrupts ( Non Blocking Function ) AKA Asynchronous
  *
  * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
- * @return : ERRORS_t   => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
- * @note   : Private Function Used Inside The SPI_Init Function
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer is Still Running on The Same Peripheral , SPI_NOK For 8 Bit Frames
+ * @note   : Same Behavior as SPI_TransceiveBuffer_IT With DataWidth Set to SPI_2BYTE , a Dummy 0xFFFF is Sent if BufferToSend is NULL
  */
-static ERRORS_t SPI_SetMode(SPI_Config_t *Config)
+ERRORS_t SPI_TransceiveBuffer16_IT(SPI_Config_t *Config, uint16_t *ReceivedBuffer, const uint16_t *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
-	if (Config != NULL)
-	{
-		switch (Config->Mode)
-		{
-		case SPI_FULL_DUPLEX:
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
-			break;
 
-		case SPI_HALF_DUPLEX_TX:
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIOE);
-			break;
+	if (Config->DataWidth != SPI_2BYTE)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_u8ErrorStatus = SPI_StartTransferItems_IT(Config, ReceivedBuffer, BufferToSend, BufferSize, pv_CallBackFunc);
+	}
+	return Local_u8ErrorStatus;
+}
 
-		case SPI_HALF_DUPLEX_RX:
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIOE));
-			break;
+/**
+ * @brief  : This Function is Used to Get The Result of The Last SPI_TransceiveBuffer_IT / SPI_TransceiveBuffer16_IT Transfer
+ *
+ * @param  : SPINum => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @param  : Status => This Parameter is Used to Return SPI_OK , SPI_CRC_ERROR if The Received CRC Did Not Match ,
+ *           or SPI_OVERRUN_ERROR if a Received Item Was Lost & The Transfer Was Ended Early
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Meant to Be Called From The Completion Call Back
+ */
+ERRORS_t SPI_GetTransferStatus(SPI_t SPINum, ERRORS_t *Status)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-		case SPI_SIMPLEX_TX:
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
-			break;
+	if (SPINum < SPI1_APB2 || SPINum > SPI2_APB1)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (NULL == Status)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else
+	{
+		*Status = SPI_Context[SPINum].Status;
+	}
+	return Local_u8ErrorStatus;
+}
 
-		case SPI_SIMPLEX_RX:
-			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
-			SPI[Config->SPINumber]->CR1 |= (1 << SPI_RXONLY);
-			break;
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of Data Through DMA ( Non Blocking Function )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : BufferToSend => This is a Pointer to uint8_t Array That Holds The Data to Be Sent , Must Stay Valid Until The Call Back
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t Array That Holds The Received Data , Must Stay Valid Until The Call Back
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Size of The Buffer to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked With SPI_OK When The Last Item is Received or SPI_NOK on a DMA Error ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver , SPI_NOK For 16 Bit Frames
+ * @note   : DMA1 Clock Must Be Enabled & The Channel IRQs Enabled in NVIC ( SPI1 => CH2 & CH3 , SPI2 => CH4 & CH5 )
+ *           IF You Want to Send Data Only You Can Pass NULL to The ReceivedBuffer Parameter , The Received Bytes Are Discarded
+ *           IF You Want to Receive Data Only You Can Pass NULL to The BufferToSend Parameter , a Dummy 0xFF is Sent For Each Byte
+ *           Both Channels Always Run , So The Call Back Comes After The Last Byte Has Been Clocked on The Bus
+ */
+ERRORS_t SPI_TransferDMA(SPI_Config_t *Config, const uint8_t *BufferToSend, uint8_t *ReceivedBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(ERRORS_t))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-		default:
-			Local_u8ErrorStatus = SPI_NOK;
-			break;
-		}
+	if (NULL == Config)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->DataWidth != SPI_1BYTE)
+	{
+		/* Each 16 Bit Frame Would Be Truncated Into a Byte */
+		Local_u8ErrorStatus = SPI_NOK;
 	}
 	else
 	{
-		Local_u8ErrorStatus = NULL_POINTER;
+		Local_u8ErrorStatus = SPI_StartTransferItems_DMA(Config, BufferToSend, ReceivedBuffer, BufferSize, pv_CallBackFunc);
 	}
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Check on SPI Configuration Structure Before Passing it to The SPI_Init Function
+ * @brief  : This Function is Used to Send & Receive a Buffer of 16 Bit Frames Through DMA ( Non Blocking Function )
  *
- * @param  : Configuration => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
- * @return : ERRORS_t     => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : BufferToSend => This is a Pointer to uint16_t Array That Holds The Data to Be Sent , Must Stay Valid Until The Call Back
+ * @param  : ReceivedBuffer => This is a Pointer to uint16_t Array That Holds The Received Data , Must Stay Valid Until The Call Back
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Frames to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked With SPI_OK When The Last Frame is Received or SPI_NOK on a DMA Error ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver , SPI_NOK For 8 Bit Frames
+ * @note   : Same Behavior as SPI_TransferDMA With DataWidth Set to SPI_2BYTE , Both Channels Move Half Words
  */
-static ERRORS_t SPI_CheckConfig(SPI_Config_t *Configuration)
+ERRORS_t SPI_TransferDMA16(SPI_Config_t *Config, const uint16_t *BufferToSend, uint16_t *ReceivedBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(ERRORS_t))
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (Configuration->SPINumber < SPI1_APB2 || Configuration->SPINumber > SPI2_APB1 ||
-			Configuration->BaudRate < SPI_PERIPH_CLK_BY2 || Configuration->BaudRate > SPI_PERIPH_CLK_BY256 ||
-			Configuration->ClockPhase < SPI_CAPTURE_LEADING || Configuration->ClockPhase > SPI_CAPTURE_TRAILING ||
-			Configuration->ClockPolarity < SPI_CLK_IDLE_LOW || Configuration->ClockPolarity > SPI_CLK_IDLE_HIGH ||
-			Configuration->DataWidth < SPI_1BYTE || Configuration->DataWidth > SPI_2BYTE ||
-			Configuration->Direction < SPI_MSB_FIRST || Configuration->Direction > SPI_LSB_FIRST ||
-			Configuration->CRC_Status < SPI_CRC_DIS || Configuration->CRC_Status > SPI_CRC_EN ||
-			Configuration->Mode < SPI_FULL_DUPLEX || Configuration->Mode > SPI_SIMPLEX_RX ||
-			Configuration->NodeRole < SPI_SLAVE || Configuration->NodeRole > SPI_MASTER ||
-			Configuration->SlaveManage < SPI_HW_SLAVE_MANAGE || Configuration->SlaveManage > SPI_SW_SLAVE_MANAGE ||
-			Configuration->SlaveSelectOutputType < SPI_SS_OUT_DIS || Configuration->SlaveSelectOutputType > SPI_SS_OUT_EN ||
-			Configuration->InterruptEnable.RXNE < SPI_IT_DIS || Configuration->InterruptEnable.RXNE > SPI_IT_EN ||
-			Configuration->InterruptEnable.TXE < SPI_IT_DIS || Configuration->InterruptEnable.TXE > SPI_IT_EN ||
-			Configuration->InterruptEnable.ERR < SPI_IT_DIS || Configuration->InterruptEnable.ERR > SPI_IT_EN)
+	if (NULL == Config)
 	{
-		Local_u8ErrorStatus = SPI_INVALID_CONFIG;
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if (Config->DataWidth != SPI_2BYTE)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		Local_u8ErrorStatus = SPI_StartTransferItems_DMA(Config, BufferToSend, ReceivedBuffer, BufferSize, pv_CallBackFunc);
 	}
-
 	return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Handle The SPI Interrupts
+ * @brief  : This Function is Used to Start The Slave Engine , Answering Each Master Transaction With a Pre Armed Response ( Non Blocking Function )
  *
- * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
- * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
- * @note   : This Function is Used Inside The SPI Interrupt Handlers (Private Function)
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : RxBuffer0 => This is a Pointer to uint8_t Array That Receives The Bytes of Even Transactions
+ * @param  : RxBuffer1 => This is a Pointer to uint8_t Array That Receives The Bytes of Odd Transactions
+ * @param  : RxSize => This is a Variable of Type uint16_t That Holds The Size of Each Rx Buffer , Extra Bytes in a Transaction Are Dropped
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked After Each Transaction With The Filled Rx Buffer & The Number of Received Bytes ( May Be NULL )
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer Owns The Peripheral , DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver
+ * @note   : The AFIO Clock & The NSS EXTI IRQ in NVIC ( SPI1 => PA4 EXTI4 , SPI2 => PB12 EXTI15_10 ) Must Be Enabled Before This Call ,
+ *           Otherwise The NSS Line is Never Routed or Its Edge Never Serviced & The First Transaction Never Ends
  */
-static ERRORS_t SPI_HANDLE_IT(SPI_t SPINumber)
+ERRORS_t SPI_SlaveStart(SPI_Config_t *Config, uint8_t *RxBuffer0, uint8_t *RxBuffer1, uint16_t RxSize, void (*pv_CallBackFunc)(const uint8_t *ReceivedBuffer, uint16_t ReceivedSize))
 {
 	ERRORS_t Local_u8ErrorStatus = SPI_OK;
 
-	if (SPINumber < SPI1_APB2 || SPINumber > SPI2_APB1)
+	SPI_t Local_SPINum = SPI1_APB2;
+
+	SPI_Slave_t *Local_Slave = NULL;
+
+	DMA_IT_t Local_ITNum = DMA_IT_TC;
+
+	uint32_t Local_u32PriMask = 0;
+
+	uint8_t Local_u8Line = 0;
+
+	if ((NULL == Config) || (NULL == RxBuffer0) || (NULL == RxBuffer1))
 	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if ((SPI_INVALID_CONFIG == SPI_CheckConfig(Config)) || (0 == RxSize) ||
+			 (Config->NodeRole != SPI_SLAVE) || (Config->Mode != SPI_FULL_DUPLEX) || (Config->DataWidth != SPI_1BYTE) ||
+			 (Config->SlaveManage != SPI_HW_SLAVE_MANAGE) || (Config->CRC_Status == SPI_CRC_EN))
+	{
+		/* The NSS Pin Must Reach The Peripheral , it Marks Both Ends of Each Transaction */
 		Local_u8ErrorStatus = SPI_NOK;
 	}
+	else if (SPI_NO_IRQ_SRC != SPI_Context[Config->SPINumber].IrqSource)
+	{
+		/* Another Transfer is Still Running on This Peripheral */
+		Local_u8ErrorStatus = SPI_BUSY;
+	}
 	else
 	{
-		/* Correct Parameter */
+		Local_SPINum = Config->SPINumber;
+		Local_Slave = &SPI_Slave[Local_SPINum];
 
-		/* IF The IRQ Source is Transceive Data */
-		if (IRQ_SRC[SPINumber] == SPI_TRANSCEIVE_DATA_IRQ_SRC)
+		/* Both Channels Stay Reserved Until SPI_SlaveStop */
+		Local_u8ErrorStatus = DMA_ClaimChannel(SPI_DMA_RX_CHANNEL[Local_SPINum]);
+
+		if (DMA_OK == Local_u8ErrorStatus)
 		{
-			/* Clear IRQ Source */
-			IRQ_SRC[SPINumber] = SPI_NO_IRQ_SRC;
+			Local_u8ErrorStatus = DMA_ClaimChannel(SPI_DMA_TX_CHANNEL[Local_SPINum]);
 
-			/* Reading is Required Only */
-			/* Read the Received Data */
-			if (SPI_TransceiveDataToBeReceived[SPINumber] != NULL)
+			if (DMA_OK != Local_u8ErrorStatus)
 			{
-				*SPI_TransceiveDataToBeReceived[SPINumber] = SPI[SPINumber]->DR;
+				DMA_ReleaseChannel(SPI_DMA_RX_CHANNEL[Local_SPINum]);
 			}
-			/* If Receiving Or Transmitting is Required
-
-			/* Disable  Rx Buffer Not Empty Interrupt */
-			SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
+		}
 
-			/* Disable  Tx Buffer Not Empty Interrupt */
-			SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
+		if (DMA_OK == Local_u8ErrorStatus)
+		{
+			Local_u8ErrorStatus = SPI_OK;
 
-			/* Invoke Call Back Function */
-			if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
-			{
-				SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
-			}
-			else if( SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE] != NULL )
+			/* The Channels Are Stopped on The NSS Edge , Not By Their Own Interrupts */
+			for (Local_ITNum = DMA_IT_TC; Local_ITNum < DMA_IT_NUM; Local_ITNum++)
 			{
-				SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE]() ;
+				DMA_SetCallBack(SPI_DMA_RX_CHANNEL[Local_SPINum], Local_ITNum, NULL);
+				DMA_SetCallBack(SPI_DMA_TX_CHANNEL[Local_SPINum], Local_ITNum, NULL);
 			}
-		}
-
-		/* IF The IRQ Source is Transceive Buffer */
-		if (IRQ_SRC[SPINumber] == SPI_TRANSCEIVE_BUFFER_IRQ_SRC)
-		{
-			/* Variable to Indicate if The Buffer Size is Reached or Not */
-			static uint8_t BufferSizeReached = SPI_BUFFER_SIZE_NOT_REACHED;
 
-			/* Counter to Indicate The Number of Data Sent or Received For Slave Role */
-			static uint16_t TransmitCounterSlave = 1;
-			static uint16_t ReceiveCounterSlave = 0;
+			Local_Slave->RxBuffer[0] = RxBuffer0;
+			Local_Slave->RxBuffer[1] = RxBuffer1;
+			Local_Slave->RxSize = RxSize;
+			Local_Slave->RxIndex = 0;
+			Local_Slave->CallBack = pv_CallBackFunc;
 
-			/* Counter to Indicate The Number of Data Sent or Received For Master Role */
-			static uint16_t TransmitCounterMaster = 1;
-			static uint16_t ReceiveCounterMaster = 0;
+			/* Take a Response Published Before The Engine Was Started */
+			Local_u32PriMask = SPI_EnterCritical();
 
-			switch (SPI_TransceiveBufferNodeRole[SPINumber])
+			if (Local_Slave->PendingReady)
 			{
-			case SPI_SLAVE:
-
-				/* Slave is Transmitter */
-				if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_TRANSMIT)
-				{
-
-					/* if Buffer Size is Reached */
-					if (TransmitCounterSlave == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						TransmitCounterSlave = 1;
+				Local_Slave->Response = Local_Slave->Pending;
+				Local_Slave->ResponseSize = Local_Slave->PendingSize;
+				Local_Slave->PendingReady = 0;
+			}
 
-					}
-					else
-					{
-						/* Send Next Data */
-						SPI[SPINumber]->DR = SPI_TransceiveBufferToBeSent[SPINumber][TransmitCounterSlave++];
-					}
-				}
-				/* Slave is Receiver */
-				else if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_RECEIVE)
-				{
+			SPI_ExitCritical(Local_u32PriMask);
 
-					/* Receive the Data */
-					SPI_TransceiveBufferToBeReceived[SPINumber][ReceiveCounterSlave++] = SPI[SPINumber]->DR;
+			/* Set IRQ Source */
+			SPI_Context[Local_SPINum].IrqSource = SPI_SLAVE_DMA_IRQ_SRC;
 
-					/* if Buffer Size is Reached */
-					if (ReceiveCounterSlave == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						ReceiveCounterSlave = 0;
-					}
-				}
+			/* Keep The SPI_Init Settings Without The Requests & Interrupts of The Other Transfers */
+			Local_Slave->CR1 = SPI[Local_SPINum]->CR1 & (~(1 << SPI_SPE));
+			Local_Slave->CR2 = SPI[Local_SPINum]->CR2 & (~((1 << SPI_TXDMAEN) | (1 << SPI_RXDMAEN) | (1 << SPI_TXEIE) | (1 << SPI_RXNEIE)));
+			Local_Slave->SavedCR2IT = SPI[Local_SPINum]->CR2 & ((1 << SPI_TXEIE) | (1 << SPI_RXNEIE));
 
-				break;
+			SPI_SlaveReset(Local_SPINum);
+			SPI_SlaveArm(Local_SPINum);
 
-			case SPI_MASTER:
+			/* Route The NSS Pin to Its EXTI Line , Its Rising Edge Ends Each Transaction */
+			Local_u8Line = (uint8_t)SPI_NSS_EXTI_LINE[Local_SPINum];
 
-				/* Master is Transmitter */
-				if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_TRANSMIT)
-				{
-					if (TransmitCounterMaster == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						TransmitCounterMaster = 1;
-					}
-					else
-					{
-						/* Send Next Data */
-						SPI[SPINumber]->DR = SPI_TransceiveBufferToBeSent[SPINumber][TransmitCounterMaster++];
-					}
-				}
-				/* Master is Receiver */
-				else if (SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_RECEIVE)
-				{
+			AFIO->EXTICR[Local_u8Line / 4U] = (AFIO->EXTICR[Local_u8Line / 4U] & (~(0x0FUL << ((Local_u8Line % 4U) * 4U)))) |
+											  ((uint32_t)SPI_NSS_AFIO_PORT[Local_SPINum] << ((Local_u8Line % 4U) * 4U));
 
-					/* Receive the Data */
-					SPI_TransceiveBufferToBeReceived[SPINumber][ReceiveCounterMaster++] = SPI[SPINumber]->DR;
+			MEXTI_SetCallBack(SPI_NSS_EXTI_LINE[Local_SPINum], SPI_NSS_CALLBACK[Local_SPINum]);
+			MEXTI_eEnableEXTILine(SPI_NSS_EXTI_LINE[Local_SPINum], EXTI_TRIGGER_RISING);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
 
-					if (ReceiveCounterMaster == SPI_TransceiveBufferSize[SPINumber])
-					{
-						BufferSizeReached = SPI_BUFFER_SIZE_REACHED;
-						/* Reset Counter */
-						ReceiveCounterMaster = 0;
-					}
-					else
-					{
-						/* Send Any Value to Initiate Communication */
-						SPI[SPINumber]->DR = 0xFF;
-					}
-				}
+/**
+ * @brief  : This Function is Used to Publish The Response The Slave Engine Sends in The Next Transaction
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @param  : Response => This is a Pointer to uint8_t Array That Holds The Response , NULL Sends 0xFF Dummy Bytes
+ * @param  : ResponseSize => This is a Variable of Type uint16_t That Holds The Size of The Response
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t SPI_SlavePublish(SPI_t SPINumber, const uint8_t *Response, uint16_t ResponseSize)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint32_t Local_u32PriMask = 0;
+
+	if ((SPINumber >= SPI_MAX_NUM) || ((NULL != Response) && (0 == ResponseSize)))
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		/* The NSS Edge Must See The Pointer & Size of The Same Response */
+		Local_u32PriMask = SPI_EnterCritical();
+
+		SPI_Slave[SPINumber].Pending = Response;
+		SPI_Slave[SPINumber].PendingSize = ResponseSize;
+		SPI_Slave[SPINumber].PendingReady = 1;
+
+		SPI_ExitCritical(Local_u32PriMask);
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop The Slave Engine & Give Both DMA Channels Back
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @return : ERRORS_t => SPI_NOK if The Slave Engine is Not Running on This Peripheral
+ */
+ERRORS_t SPI_SlaveStop(SPI_t SPINumber)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if ((SPINumber >= SPI_MAX_NUM) || (SPI_SLAVE_DMA_IRQ_SRC != SPI_Context[SPINumber].IrqSource))
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		MEXTI_eDisableEXTILine(SPI_NSS_EXTI_LINE[SPINumber]);
+
+		DMA_StopTransfer(SPI_DMA_TX_CHANNEL[SPINumber]);
+		DMA_StopTransfer(SPI_DMA_RX_CHANNEL[SPINumber]);
+
+		/* Drop The Armed Byte & Leave The Peripheral as SPI_Init Left it , Interrupt Enables Included */
+		SPI_SlaveReset(SPINumber);
+		SPI[SPINumber]->CR2 |= SPI_Slave[SPINumber].SavedCR2IT;
+		SPI[SPINumber]->CR1 |= (1 << SPI_SPE);
+
+		DMA_ReleaseChannel(SPI_DMA_TX_CHANNEL[SPINumber]);
+		DMA_ReleaseChannel(SPI_DMA_RX_CHANNEL[SPINumber]);
+
+		/* Clear IRQ Source */
+		SPI_Context[SPINumber].IrqSource = SPI_NO_IRQ_SRC;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send & Receive a Buffer of 8 or 16 Bit Items at The Same Time ( Blocking )
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t or uint16_t Array ( Following The DataWidth ) That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint8_t or uint16_t Array ( Following The DataWidth ) That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Items to Be Sent & Received
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Private Function Used By SPI_TransceiveBuffer & SPI_TransceiveBuffer16
+ */
+static ERRORS_t SPI_TransferItems(SPI_Config_t *Config, void *ReceivedBuffer, const void *BufferToSend, uint16_t BufferSize)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	uint16_t Local_u16TxCounter = 0;
+	uint16_t Local_u16RxCounter = 0;
+	uint16_t Local_u16Data = 0;
+
+	/* One Extra Item is Received When The CRC Follows The Data */
+	uint8_t Local_u8CrcItems = 0;
+
+	if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI2_APB1)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (Config->Mode == SPI_FULL_DUPLEX || Config->Mode == SPI_SIMPLEX_TX)
+	{
+		/* Correct Parameters */
+
+		if (Config->CRC_Status == SPI_CRC_EN)
+		{
+			Local_u8CrcItems = 1;
+
+			SPI_ResetCRC(Config->SPINumber);
+		}
+
+		/* An Overrun Left Behind By an Aborted Interrupt Transfer Would End This One on The First Pass */
+		SPI_ClearOverrun(Config->SPINumber);
+
+		/* Every Written Item Clocks One Item In , So Tx & Rx Advance Together
+		 * Keep at Most Two Items in Flight ( Shift Register + DR ) , a Third Would Overrun The Receiver */
+		while (Local_u16RxCounter < (BufferSize + Local_u8CrcItems))
+		{
+			/* An Item Read Too Late Was Overwritten , it Will Never Raise RXNE So Waiting For it Would Hang */
+			if (SPI[Config->SPINumber]->SR & (1 << SPI_OVERRUN_FLAG))
+			{
+				Local_u8ErrorStatus = SPI_OVERRUN_ERROR;
 				break;
 			}
-			/* If Buffer Size is Reached  , Disable Rx Buffer Not Empty Interrupt & Invoke Call Back Function */
-			if (BufferSizeReached == SPI_BUFFER_SIZE_REACHED)
+
+			if ((Local_u16TxCounter < BufferSize) &&
+					((uint16_t)(Local_u16TxCounter - Local_u16RxCounter) < SPI_MAX_ITEMS_IN_FLIGHT) &&
+					(SPI[Config->SPINumber]->SR & (1 << SPI_TRANSMIT_BUFFER_E_FLAG)))
 			{
+				/* Clock Out a Dummy Item When Only Receiving is Required */
+				SPI[Config->SPINumber]->DR = (NULL != BufferToSend) ? SPI_ReadItem(BufferToSend, Local_u16TxCounter, Config->DataWidth) : SPI_DUMMY_ITEM;
 
-				/* Clear IRQ Source */
-				IRQ_SRC[SPINumber] = SPI_NO_IRQ_SRC;
+				Local_u16TxCounter++;
+
+				/* The CRC Goes Out Right After The Last Item , it Must Be Requested While That Item is Still Shifting */
+				if (Local_u8CrcItems && (Local_u16TxCounter == BufferSize))
+				{
+					SPI[Config->SPINumber]->CR1 |= (1 << SPI_CRCNEXT);
+				}
+			}
+
+			if (SPI[Config->SPINumber]->SR & (1 << SPI_RECEIVE_BUFFER_NE_FLAG))
+			{
+				/* Always Read DR Even if Not Required , to Clear RXNE & Avoid Overrun */
+				Local_u16Data = SPI[Config->SPINumber]->DR;
 
-				if( SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_TRANSMIT )
+				/* The Received CRC is Only Checked By The Hardware , it is Not Stored */
+				if ((NULL != ReceivedBuffer) && (Local_u16RxCounter < BufferSize))
 				{
-					/* Disable Tx Buffer Not Empty Interrupt */
-					SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
+					SPI_WriteItem(ReceivedBuffer, Local_u16RxCounter, Local_u16Data, Config->DataWidth);
+				}
+
+				Local_u16RxCounter++;
+			}
+		}
+
+		/* Last Item Received , Wait Until The Bus is Idle Before Returning So The Caller Can Release The Slave */
+		while (SPI[Config->SPINumber]->SR & (1 << SPI_BUSY_FLAG))
+			;
+
+		if (SPI_OVERRUN_ERROR == Local_u8ErrorStatus)
+		{
+			/* Items Still in Flight Have Been Clocked Out by Now , Drop Them With The Overrun */
+			SPI_ClearOverrun(Config->SPINumber);
+		}
+		else if (Local_u8CrcItems)
+		{
+			Local_u8ErrorStatus = SPI_CheckCRC(Config->SPINumber);
+		}
+	}
+	else
+	{
+		/* Half Duplex & Rx Only Modes Have No Received Item For Each Sent One , Transfer Item By Item */
+		for (Local_u16TxCounter = 0; Local_u16TxCounter < BufferSize; Local_u16TxCounter++)
+		{
+			Local_u16Data = (NULL != BufferToSend) ? SPI_ReadItem(BufferToSend, Local_u16TxCounter, Config->DataWidth) : SPI_DUMMY_ITEM;
+
+			SPI_TransceiveData(Config, (NULL != ReceivedBuffer) ? &Local_u16Data : NULL, (NULL != BufferToSend) ? &Local_u16Data : NULL);
+
+			if (NULL != ReceivedBuffer)
+			{
+				SPI_WriteItem(ReceivedBuffer, Local_u16TxCounter, Local_u16Data, Config->DataWidth);
+			}
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start Sending & Receiving a Buffer of 8 or 16 Bit Items Using Interrupts
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t or uint16_t Array ( Following The DataWidth ) That Holds The Received Data
+ * @param  : BufferToSend => This is a Pointer to uint8_t or uint16_t Array ( Following The DataWidth ) That Holds The Data to Be Sent
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Items to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function That Holds The Call Back Function Address
+ * @return : ERRORS_t => SPI_BUSY if Another Transfer is Still Running on The Same Peripheral
+ * @note   : Private Function Used By SPI_TransceiveBuffer_IT & SPI_TransceiveBuffer16_IT
+ */
+static ERRORS_t SPI_StartTransferItems_IT(SPI_Config_t *Config, void *ReceivedBuffer, const void *BufferToSend, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	SPI_Context_t *Local_Context = NULL;
+
+	if (Config->SPINumber < SPI1_APB2 || Config->SPINumber > SPI2_APB1 || 0 == BufferSize ||
+			(NULL == ReceivedBuffer && NULL == BufferToSend))
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_NO_IRQ_SRC != SPI_Context[Config->SPINumber].IrqSource)
+	{
+		/* Another Transfer is Still Running on This Peripheral */
+		Local_u8ErrorStatus = SPI_BUSY;
+	}
+	else
+	{
+		/* Correct Parameters */
+		Local_Context = &SPI_Context[Config->SPINumber];
+
+		Local_Context->RxBuffer = ReceivedBuffer;
+		Local_Context->TxBuffer = BufferToSend;
+		Local_Context->Size = BufferSize;
+		Local_Context->DataWidth = Config->DataWidth;
+		Local_Context->TxCounter = 0;
+		Local_Context->RxCounter = 0;
+		Local_Context->CallBack = pv_CallBackFunc;
+		Local_Context->CrcActive = 0;
+		Local_Context->Status = SPI_OK;
+
+		/* Two Line Modes Receive an Item For Each Sent One , So Both Sides Run & The Last Received Item Ends The Transfer
+		 * Single Line Modes Only Run The Side That Has a Buffer , The Clock of Rx Only Master is Started By The Hardware */
+		if (Config->Mode == SPI_FULL_DUPLEX || Config->Mode == SPI_SIMPLEX_TX)
+		{
+			Local_Context->TxActive = 1;
+			Local_Context->RxActive = 1;
+
+			if (Config->CRC_Status == SPI_CRC_EN)
+			{
+				Local_Context->CrcActive = 1;
+
+				SPI_ResetCRC(Config->SPINumber);
+			}
+		}
+		else
+		{
+			Local_Context->TxActive = (NULL != BufferToSend);
+			Local_Context->RxActive = (NULL != ReceivedBuffer);
+		}
+
+		/* Set IRQ Source */
+		Local_Context->IrqSource = SPI_TRANSCEIVE_BUFFER_IRQ_SRC;
+
+		Local_Context->ErrIrqOwned = 0;
+
+		if (Local_Context->RxActive)
+		{
+			/* Drop a Stale Received Item & Any Overrun Left Behind So Neither Ends The New Transfer */
+			SPI_ClearOverrun(Config->SPINumber);
+
+			/* The Error Interrupt Reports an Overrun , Which Otherwise Would Stall The Transfer Forever */
+			if (!(SPI[Config->SPINumber]->CR2 & (1 << SPI_ERRIE)))
+			{
+				Local_Context->ErrIrqOwned = 1;
+
+				SPI[Config->SPINumber]->CR2 |= (1 << SPI_ERRIE);
+			}
+
+			/* Enable Receive Buffer Not Empty Interrupt */
+			SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXNEIE);
+		}
+
+		if (Local_Context->TxActive)
+		{
+			/* The ISR Writes The First Item as Soon as The Transmit Buffer is Empty */
+			SPI[Config->SPINumber]->CR2 |= (1 << SPI_TXEIE);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start Sending & Receiving a Buffer of 8 or 16 Bit Items Through DMA
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @param  : BufferToSend => This is a Pointer to uint8_t or uint16_t Array ( Following The DataWidth ) That Holds The Data to Be Sent
+ * @param  : ReceivedBuffer => This is a Pointer to uint8_t or uint16_t Array ( Following The DataWidth ) That Holds The Received Data
+ * @param  : BufferSize => This is a Variable of Type uint16_t That Holds The Number of Items to Be Sent & Received
+ * @param  : pv_CallBackFunc => This is a Pointer to Function Invoked With The Transfer Result ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if One of The SPI DMA Channels is Used By Another Driver
+ * @note   : Private Function Used By SPI_TransferDMA & SPI_TransferDMA16
+ */
+static ERRORS_t SPI_StartTransferItems_DMA(SPI_Config_t *Config, const void *BufferToSend, void *ReceivedBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(ERRORS_t))
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	DMA_Channel_t Local_RxChannel = DMA_CHANNEL_1;
+	DMA_Channel_t Local_TxChannel = DMA_CHANNEL_1;
+
+	DMA_Config_t Local_RxDMAConfig = {
+		.Direction = DMA_PERIPH_TO_MEM,
+		.Mode = DMA_NORMAL_MODE,
+		.PeriphSize = DMA_SIZE_8_BITS,
+		.MemSize = DMA_SIZE_8_BITS,
+		.PeriphIncrement = DMA_INC_DIS,
+		.MemIncrement = DMA_INC_EN,
+		.Priority = DMA_PRIORITY_HIGH,
+	};
+
+	DMA_Config_t Local_TxDMAConfig = {
+		.Direction = DMA_MEM_TO_PERIPH,
+		.Mode = DMA_NORMAL_MODE,
+		.PeriphSize = DMA_SIZE_8_BITS,
+		.MemSize = DMA_SIZE_8_BITS,
+		.PeriphIncrement = DMA_INC_DIS,
+		.MemIncrement = DMA_INC_EN,
+		.Priority = DMA_PRIORITY_MEDIUM,
+	};
+
+	if (NULL == Config)
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	else if ((SPI_INVALID_CONFIG == SPI_CheckConfig(Config)) || (0 == BufferSize) ||
+			 (Config->Mode != SPI_FULL_DUPLEX && Config->Mode != SPI_SIMPLEX_TX))
+	{
+		/* Only Two Line Modes Receive an Item For Each Sent One */
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else if (SPI_NO_IRQ_SRC != SPI_Context[Config->SPINumber].IrqSource)
+	{
+		/* Another Transfer is Still Running on This Peripheral */
+		Local_u8ErrorStatus = SPI_BUSY;
+	}
+	else
+	{
+		/* Each DR Access Moves One Whole Frame */
+		if (Config->DataWidth == SPI_2BYTE)
+		{
+			Local_RxDMAConfig.PeriphSize = DMA_SIZE_16_BITS;
+			Local_RxDMAConfig.MemSize = DMA_SIZE_16_BITS;
+			Local_TxDMAConfig.PeriphSize = DMA_SIZE_16_BITS;
+			Local_TxDMAConfig.MemSize = DMA_SIZE_16_BITS;
+		}
+
+		Local_RxChannel = SPI_DMA_RX_CHANNEL[Config->SPINumber];
+		Local_TxChannel = SPI_DMA_TX_CHANNEL[Config->SPINumber];
+
+		/* Reserve Both Channels , They Are Released Again When The Transfer Ends */
+		Local_u8ErrorStatus = DMA_ClaimChannel(Local_RxChannel);
+
+		if (DMA_OK == Local_u8ErrorStatus)
+		{
+			Local_u8ErrorStatus = DMA_ClaimChannel(Local_TxChannel);
+
+			if (DMA_OK != Local_u8ErrorStatus)
+			{
+				DMA_ReleaseChannel(Local_RxChannel);
+			}
+		}
+
+		if (DMA_OK == Local_u8ErrorStatus)
+		{
+			Local_u8ErrorStatus = SPI_OK;
+
+			/* Missing Buffers Are Replaced By a Single Dummy Byte That The Channel Keeps Reusing */
+			if (NULL == ReceivedBuffer)
+			{
+				Local_RxDMAConfig.MemIncrement = DMA_INC_DIS;
+				ReceivedBuffer = &SPI_DMADummyRx;
+			}
+
+			if (NULL == BufferToSend)
+			{
+				Local_TxDMAConfig.MemIncrement = DMA_INC_DIS;
+				BufferToSend = &SPI_DMADummyTx;
+			}
+
+			Local_RxDMAConfig.Channel = Local_RxChannel;
+			DMA_Init(&Local_RxDMAConfig);
+
+			Local_TxDMAConfig.Channel = Local_TxChannel;
+			DMA_Init(&Local_TxDMAConfig);
+
+			/* The Rx Channel Finishes Last , its Transfer Complete Ends The Whole Transfer */
+			DMA_SetCallBack(Local_RxChannel, DMA_IT_TC, SPI_DMA_TransferComplete);
+			DMA_SetCallBack(Local_RxChannel, DMA_IT_TE, SPI_DMA_TransferError);
+			DMA_SetCallBack(Local_TxChannel, DMA_IT_TE, SPI_DMA_TransferError);
+
+			/* Setting Call Back Function */
+			SPI_Context[Config->SPINumber].DMACallBack = pv_CallBackFunc;
 
-					/* Invoke Call Back Function */
-					if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE] != NULL)
+			/* Set IRQ Source */
+			SPI_Context[Config->SPINumber].IrqSource = SPI_TRANSFER_DMA_IRQ_SRC;
+
+			/* The Hardware Sends The CRC After The Last Tx DMA Item by Itself , The Received One is Read in The Completion */
+			SPI_Context[Config->SPINumber].CrcActive = (Config->CRC_Status == SPI_CRC_EN);
+
+			if (SPI_Context[Config->SPINumber].CrcActive)
+			{
+				SPI_ResetCRC(Config->SPINumber);
+			}
+
+			/* Drop a Stale Received Item So it is Not Stored as The First One */
+			(void)SPI[Config->SPINumber]->DR;
+
+			/* RM0008 Order : Rx Request First , Then The Channels , Then The Tx Request Which Starts The Clock */
+			SPI[Config->SPINumber]->CR2 |= (1 << SPI_RXDMAEN);
+
+			DMA_StartTransfer(Local_RxChannel, (uint32_t)&SPI[Config->SPINumber]->DR, (uint32_t)ReceivedBuffer, BufferSize);
+			DMA_StartTransfer(Local_TxChannel, (uint32_t)&SPI[Config->SPINumber]->DR, (uint32_t)BufferToSend, BufferSize);
+
+			SPI[Config->SPINumber]->CR2 |= (1 << SPI_TXDMAEN);
+		}
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Read One Item From an 8 or 16 Bit Buffer
+ *
+ * @param  : Buffer => This is a Pointer to uint8_t or uint16_t Array
+ * @param  : Index => This Parameter is Used to Select The Item
+ * @param  : DataWidth => This Parameter is Used to Select The Item Size -> @SPI_DATA_SIZE_t
+ * @return : uint16_t => The Item
+ */
+static uint16_t SPI_ReadItem(const void *Buffer, uint16_t Index, SPI_DATA_SIZE_t DataWidth)
+{
+	return (DataWidth == SPI_2BYTE) ? ((const uint16_t *)Buffer)[Index] : ((const uint8_t *)Buffer)[Index];
+}
+
+/**
+ * @brief  : This Function is Used to Write One Item Into an 8 or 16 Bit Buffer
+ *
+ * @param  : Buffer => This is a Pointer to uint8_t or uint16_t Array
+ * @param  : Index => This Parameter is Used to Select The Item
+ * @param  : Item => This Parameter is Used to Pass The Value Read From DR
+ * @param  : DataWidth => This Parameter is Used to Select The Item Size -> @SPI_DATA_SIZE_t
+ */
+static void SPI_WriteItem(void *Buffer, uint16_t Index, uint16_t Item, SPI_DATA_SIZE_t DataWidth)
+{
+	if (DataWidth == SPI_2BYTE)
+	{
+		((uint16_t *)Buffer)[Index] = Item;
+	}
+	else
+	{
+		((uint8_t *)Buffer)[Index] = (uint8_t)Item;
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Clear The Tx & Rx CRC Registers Before a New Transfer
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @note   : The CRC Registers Are Only Cleared By Toggling CRCEN , Which Needs The Peripheral Disabled
+ */
+static void SPI_ResetCRC(SPI_t SPINumber)
+{
+	while (SPI[SPINumber]->SR & (1 << SPI_BUSY_FLAG))
+		;
+
+	SPI[SPINumber]->CR1 &= (~(1 << SPI_SPE));
+	SPI[SPINumber]->CR1 &= (~(1 << SPI_CRCEN));
+	SPI[SPINumber]->CR1 |= (1 << SPI_CRCEN);
+	SPI[SPINumber]->CR1 |= (1 << SPI_SPE);
+}
+
+/**
+ * @brief  : This Function is Used to Clear The Overrun Flag & Drop The Item Left in DR
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @note   : OVR is Cleared by a DR Read Followed by an SR Read
+ */
+static void SPI_ClearOverrun(SPI_t SPINumber)
+{
+	(void)SPI[SPINumber]->DR;
+	(void)SPI[SPINumber]->SR;
+}
+
+/**
+ * @brief  : This Function is Used to Check & Clear The CRC Error Flag After The CRC Has Been Received
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @return : ERRORS_t => SPI_CRC_ERROR if The Received CRC Did Not Match RXCRCR , SPI_OK Otherwise
+ */
+static ERRORS_t SPI_CheckCRC(SPI_t SPINumber)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (SPI[SPINumber]->SR & (1 << SPI_CRC_ERROR_FLAG))
+	{
+		/* CRCERR is rc_w0 , Writing 1 to The Other Bits Leaves Them Untouched */
+		SPI[SPINumber]->SR = (uint16_t)(~(1 << SPI_CRC_ERROR_FLAG));
+
+		Local_u8ErrorStatus = SPI_CRC_ERROR;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The SPI Mode According to The Required Configuration in The Configuration Struct
+ *
+ * @param  : Config => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @return : ERRORS_t   => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Private Function Used Inside The SPI_Init Function
+ */
+static ERRORS_t SPI_SetMode(SPI_Config_t *Config)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+	if (Config != NULL)
+	{
+		switch (Config->Mode)
+		{
+		case SPI_FULL_DUPLEX:
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
+			break;
+
+		case SPI_HALF_DUPLEX_TX:
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIOE);
+			break;
+
+		case SPI_HALF_DUPLEX_RX:
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_BIDIMODE);
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIOE));
+			break;
+
+		case SPI_SIMPLEX_TX:
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_RXONLY));
+			break;
+
+		case SPI_SIMPLEX_RX:
+			SPI[Config->SPINumber]->CR1 &= (~(1 << SPI_BIDIMODE));
+			SPI[Config->SPINumber]->CR1 |= (1 << SPI_RXONLY);
+			break;
+
+		default:
+			Local_u8ErrorStatus = SPI_NOK;
+			break;
+		}
+	}
+	else
+	{
+		Local_u8ErrorStatus = NULL_POINTER;
+	}
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Check on SPI Configuration Structure Before Passing it to The SPI_Init Function
+ *
+ * @param  : Configuration => This is a Pointer to Struct of Type SPI_Config_t That Holds The Required Configuration
+ * @return : ERRORS_t     => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t SPI_CheckConfig(SPI_Config_t *Configuration)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	if (Configuration->SPINumber < SPI1_APB2 || Configuration->SPINumber > SPI2_APB1 ||
+			Configuration->BaudRate < SPI_PERIPH_CLK_BY2 || Configuration->BaudRate > SPI_PERIPH_CLK_BY256 ||
+			Configuration->ClockPhase < SPI_CAPTURE_LEADING || Configuration->ClockPhase > SPI_CAPTURE_TRAILING ||
+			Configuration->ClockPolarity < SPI_CLK_IDLE_LOW || Configuration->ClockPolarity > SPI_CLK_IDLE_HIGH ||
+			Configuration->DataWidth < SPI_1BYTE || Configuration->DataWidth > SPI_2BYTE ||
+			Configuration->Direction < SPI_MSB_FIRST || Configuration->Direction > SPI_LSB_FIRST ||
+			Configuration->CRC_Status < SPI_CRC_DIS || Configuration->CRC_Status > SPI_CRC_EN ||
+			Configuration->Mode < SPI_FULL_DUPLEX || Configuration->Mode > SPI_SIMPLEX_RX ||
+			Configuration->NodeRole < SPI_SLAVE || Configuration->NodeRole > SPI_MASTER ||
+			Configuration->SlaveManage < SPI_HW_SLAVE_MANAGE || Configuration->SlaveManage > SPI_SW_SLAVE_MANAGE ||
+			Configuration->SlaveSelectOutputType < SPI_SS_OUT_DIS || Configuration->SlaveSelectOutputType > SPI_SS_OUT_EN ||
+			Configuration->InterruptEnable.RXNE < SPI_IT_DIS || Configuration->InterruptEnable.RXNE > SPI_IT_EN ||
+			Configuration->InterruptEnable.TXE < SPI_IT_DIS || Configuration->InterruptEnable.TXE > SPI_IT_EN ||
+			Configuration->InterruptEnable.ERR < SPI_IT_DIS || Configuration->InterruptEnable.ERR > SPI_IT_EN)
+	{
+		Local_u8ErrorStatus = SPI_INVALID_CONFIG;
+	}
+
+	return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Handle The SPI Interrupts
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number to Be Used -> @SPI_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : This Function is Used Inside The SPI Interrupt Handlers (Private Function)
+ */
+static ERRORS_t SPI_HANDLE_IT(SPI_t SPINumber)
+{
+	ERRORS_t Local_u8ErrorStatus = SPI_OK;
+
+	SPI_Context_t *Local_Context = NULL;
+
+	uint16_t Local_u16Data = 0;
+
+	uint8_t Local_u8Done = 0;
+
+	if (SPINumber < SPI1_APB2 || SPINumber > SPI2_APB1)
+	{
+		Local_u8ErrorStatus = SPI_NOK;
+	}
+	else
+	{
+		/* Correct Parameter */
+		Local_Context = &SPI_Context[SPINumber];
+
+		/* IF The IRQ Source is Transceive Data */
+		if (Local_Context->IrqSource == SPI_TRANSCEIVE_DATA_IRQ_SRC)
+		{
+			/* Clear IRQ Source */
+			Local_Context->IrqSource = SPI_NO_IRQ_SRC;
+
+			/* Reading is Required Only */
+			/* Read the Received Data */
+			if (Local_Context->DataToBeReceived != NULL)
+			{
+				*Local_Context->DataToBeReceived = SPI[SPINumber]->DR;
+			}
+
+			/* Disable  Rx Buffer Not Empty Interrupt */
+			SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
+
+			/* Disable  Tx Buffer Not Empty Interrupt */
+			SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
+
+			/* Invoke Call Back Function */
+			if (Local_Context->CallBack != NULL)
+			{
+				Local_Context->CallBack();
+			}
+		}
+
+		/* IF The IRQ Source is Transceive Buffer */
+		else if (Local_Context->IrqSource == SPI_TRANSCEIVE_BUFFER_IRQ_SRC)
+		{
+			/* An RXNE Serviced Too Late Lets The Next Item Overwrite DR , The Lost Item Would Never Complete The Count */
+			if (Local_Context->RxActive && (SPI[SPINumber]->SR & (1 << SPI_OVERRUN_FLAG)))
+			{
+				SPI_ClearOverrun(SPINumber);
+
+				Local_Context->Status = SPI_OVERRUN_ERROR;
+
+				Local_u8Done = 1;
+			}
+			else
+			{
+				/* Transmit Side : Keep at Most Two Items Ahead of The Receiver , Then Wait For RXNE to Re-Enable TXE */
+				if ((SPI[SPINumber]->CR2 & (1 << SPI_TXEIE)) && (SPI[SPINumber]->SR & (1 << SPI_TRANSMIT_BUFFER_E_FLAG)))
+				{
+					if ((Local_Context->TxCounter < Local_Context->Size) &&
+							(!Local_Context->RxActive || (uint16_t)(Local_Context->TxCounter - Local_Context->RxCounter) < SPI_MAX_ITEMS_IN_FLIGHT))
+					{
+						/* Send Next Data , or a Dummy Byte When Only Receiving is Required */
+						SPI[SPINumber]->DR = (NULL != Local_Context->TxBuffer) ? SPI_ReadItem(Local_Context->TxBuffer, Local_Context->TxCounter, Local_Context->DataWidth) : SPI_DUMMY_ITEM;
+
+						Local_Context->TxCounter++;
+
+						/* Request The CRC While The Last Item is Still Shifting */
+						if (Local_Context->CrcActive && (Local_Context->TxCounter == Local_Context->Size))
+						{
+							SPI[SPINumber]->CR1 |= (1 << SPI_CRCNEXT);
+						}
+					}
+					else
 					{
-						SPI_PTR_TO_FUNC[SPINumber][SPI_IT_TXE]();
+						/* Disable Tx Buffer Empty Interrupt */
+						SPI[SPINumber]->CR2 &= (~(1 << SPI_TXEIE));
+
+						/* Transmit Only : Last Item Has Been Moved to The Shift Register */
+						if (!Local_Context->RxActive && (Local_Context->TxCounter == Local_Context->Size))
+						{
+							Local_u8Done = 1;
+						}
 					}
 				}
-				else if( SPI_TransceiveBufferRoleDirection[SPINumber] == SPI_ROLE_RECEIVE )
+
+				/* Receive Side */
+				if (Local_Context->RxActive && (SPI[SPINumber]->SR & (1 << SPI_RECEIVE_BUFFER_NE_FLAG)))
 				{
-					/* Disable  Rx Buffer Not Empty Interrupt */
-					SPI[SPINumber]->CR2 &= (~(1 << SPI_RXNEIE));
+					/* Always Read DR Even if Not Required , to Clear RXNE & Avoid Overrun */
+					Local_u16Data = SPI[SPINumber]->DR;
+
+					if ((NULL != Local_Context->RxBuffer) && (Local_Context->RxCounter < Local_Context->Size))
+					{
+						SPI_WriteItem(Local_Context->RxBuffer, Local_Context->RxCounter, Local_u16Data, Local_Context->DataWidth);
+					}
 
-					/* Invoke Call Back Function */
-					if (SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE] != NULL)
+					Local_Context->RxCounter++;
+
+					/* With CRC The Transfer Ends on The Received CRC , One Item After The Data */
+					if (Local_Context->RxCounter == (Local_Context->Size + Local_Context->CrcActive))
 					{
-						SPI_PTR_TO_FUNC[SPINumber][SPI_IT_RXNE]();
+						Local_u8Done = 1;
+
+						if (Local_Context->CrcActive)
+						{
+							Local_Context->Status = SPI_CheckCRC(SPINumber);
+						}
+					}
+					else if (Local_Context->TxActive && (Local_Context->TxCounter < Local_Context->Size))
+					{
+						/* A Slot is Free Again */
+						SPI[SPINumber]->CR2 |= (1 << SPI_TXEIE);
 					}
 				}
+			}
+
+			/* If Buffer Size is Reached , Disable Interrupts & Invoke Call Back Function */
+			if (Local_u8Done)
+			{
+				/* Clear IRQ Source */
+				Local_Context->IrqSource = SPI_NO_IRQ_SRC;
 
-				/* Reset Variables*/
-				BufferSizeReached = SPI_BUFFER_SIZE_NOT_REACHED;
+				SPI[SPINumber]->CR2 &= (~((1 << SPI_TXEIE) | (1 << SPI_RXNEIE)));
+
+				/* Leave The Error Interrupt as SPI_Init Configured it */
+				if (Local_Context->ErrIrqOwned)
+				{
+					SPI[SPINumber]->CR2 &= (~(1 << SPI_ERRIE));
+				}
+
+				/* Invoke Call Back Function */
+				if (Local_Context->CallBack != NULL)
+				{
+					Local_Context->CallBack();
+				}
 			}
 		}
 	}
 	return Local_u8ErrorStatus;
 }
 
+/**
+ * @brief  : This Function is Used to Find The SPI Peripheral Served By a DMA Channel
+ *
+ * @param  : Channel => This Parameter is Used to Pass The DMA Channel That Raised The Interrupt
+ * @param  : ChannelMap => This Parameter is Used to Pass The Rx or Tx Channel Table
+ * @return : SPI_t => The SPI Peripheral Number , or SPI_MAX_NUM if No Peripheral Uses This Channel
+ */
+static SPI_t SPI_DMA_FindPeriph(DMA_Channel_t Channel, const DMA_Channel_t *ChannelMap)
+{
+	SPI_t Local_SPINum = SPI1_APB2;
+
+	while ((Local_SPINum < SPI_MAX_NUM) && (ChannelMap[Local_SPINum] != Channel))
+	{
+		Local_SPINum++;
+	}
+	return Local_SPINum;
+}
+
+/**
+ * @brief  : This Function is Used to Stop an SPI DMA Transfer & Give Both Channels Back
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ * @param  : Status => This Parameter is Used to Pass The Transfer Result to The Call Back Function
+ */
+static void SPI_DMA_EndTransfer(SPI_t SPINumber, ERRORS_t Status)
+{
+	/* Disable DMA Requests */
+	SPI[SPINumber]->CR2 &= (~((1 << SPI_TXDMAEN) | (1 << SPI_RXDMAEN)));
+
+	DMA_ReleaseChannel(SPI_DMA_TX_CHANNEL[SPINumber]);
+	DMA_ReleaseChannel(SPI_DMA_RX_CHANNEL[SPINumber]);
+
+	/* Clear IRQ Source */
+	SPI_Context[SPINumber].IrqSource = SPI_NO_IRQ_SRC;
+
+	/* Invoke Call Back Function */
+	if (SPI_Context[SPINumber].DMACallBack != NULL)
+	{
+		SPI_Context[SPINumber].DMACallBack(Status);
+	}
+}
+
+/* Last Item Received During SPI_TransferDMA */
+static void SPI_DMA_TransferComplete(DMA_Channel_t Channel)
+{
+	SPI_t Local_SPINum = SPI_DMA_FindPeriph(Channel, SPI_DMA_RX_CHANNEL);
+
+	ERRORS_t Local_u8Status = SPI_OK;
+
+	if (Local_SPINum < SPI_MAX_NUM)
+	{
+		if (SPI_Context[Local_SPINum].CrcActive)
+		{
+			/* The CRC Frame is Right Behind The Last Data Item */
+			while (!(SPI[Local_SPINum]->SR & (1 << SPI_RECEIVE_BUFFER_NE_FLAG)))
+				;
+
+			(void)SPI[Local_SPINum]->DR;
+
+			Local_u8Status = SPI_CheckCRC(Local_SPINum);
+		}
+
+		SPI_DMA_EndTransfer(Local_SPINum, Local_u8Status);
+	}
+}
+
+/* Bus Error on Either Channel During SPI_TransferDMA , Hardware Has Stopped That Channel */
+static void SPI_DMA_TransferError(DMA_Channel_t Channel)
+{
+	SPI_t Local_SPINum = SPI_DMA_FindPeriph(Channel, SPI_DMA_RX_CHANNEL);
 
+	if (Local_SPINum >= SPI_MAX_NUM)
+	{
+		Local_SPINum = SPI_DMA_FindPeriph(Channel, SPI_DMA_TX_CHANNEL);
+	}
+
+	if (Local_SPINum < SPI_MAX_NUM)
+	{
+		SPI_DMA_EndTransfer(Local_SPINum, SPI_NOK);
+	}
+}
+
+/**
+ * @brief  : This Function is Used to Reset an SPI Peripheral Through RCC & Reload The Slave Engine Settings
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ */
+static void SPI_SlaveReset(SPI_t SPINumber)
+{
+	/* A Slave Cannot Empty DR Itself , The Byte Loaded For a Longer Transaction Would Lead The Next Response */
+	if (SPI1_APB2 == SPINumber)
+	{
+		RCC_APB2ResetPeripheral(SPI1_CLK);
+	}
+	else
+	{
+		RCC_APB1ResetPeripheral(SPI2_CLK);
+	}
+
+	SPI[SPINumber]->CR2 = SPI_Slave[SPINumber].CR2;
+	SPI[SPINumber]->CR1 = SPI_Slave[SPINumber].CR1;
+}
+
+/**
+ * @brief  : This Function is Used to Arm Both DMA Channels of The Slave Engine For The Next Transaction & Enable The Peripheral
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ */
+static void SPI_SlaveArm(SPI_t SPINumber)
+{
+	SPI_Slave_t *Local_Slave = &SPI_Slave[SPINumber];
+
+	const void *Local_pvTxBuffer = Local_Slave->Response;
+
+	uint16_t Local_u16TxSize = Local_Slave->ResponseSize;
+
+	DMA_Config_t Local_RxDMAConfig = {
+		.Channel = SPI_DMA_RX_CHANNEL[SPINumber],
+		.Direction = DMA_PERIPH_TO_MEM,
+		.Mode = DMA_NORMAL_MODE,
+		.PeriphSize = DMA_SIZE_8_BITS,
+		.MemSize = DMA_SIZE_8_BITS,
+		.PeriphIncrement = DMA_INC_DIS,
+		.MemIncrement = DMA_INC_EN,
+		.Priority = DMA_PRIORITY_VERY_HIGH,
+	};
+
+	DMA_Config_t Local_TxDMAConfig = {
+		.Channel = SPI_DMA_TX_CHANNEL[SPINumber],
+		.Direction = DMA_MEM_TO_PERIPH,
+		.Mode = DMA_NORMAL_MODE,
+		.PeriphSize = DMA_SIZE_8_BITS,
+		.MemSize = DMA_SIZE_8_BITS,
+		.PeriphIncrement = DMA_INC_DIS,
+		.MemIncrement = DMA_INC_EN,
+		.Priority = DMA_PRIORITY_HIGH,
+	};
+
+	/* No Response Yet , Keep Sending The Dummy Byte For as Long as The Master Can Clock */
+	if (NULL == Local_pvTxBuffer)
+	{
+		Local_TxDMAConfig.MemIncrement = DMA_INC_DIS;
+		Local_pvTxBuffer = &SPI_DMADummyTx;
+		Local_u16TxSize = Local_Slave->RxSize;
+	}
+
+	DMA_Init(&Local_RxDMAConfig);
+	DMA_Init(&Local_TxDMAConfig);
+
+	/* RM0008 Order : Rx Request First , Then The Channels , Then The Tx Request Which Loads The First Byte in DR */
+	SPI[SPINumber]->CR2 |= (1 << SPI_RXDMAEN);
+
+	DMA_StartTransfer(Local_RxDMAConfig.Channel, (uint32_t)&SPI[SPINumber]->DR, (uint32_t)Local_Slave->RxBuffer[Local_Slave->RxIndex], Local_Slave->RxSize);
+	DMA_StartTransfer(Local_TxDMAConfig.Channel, (uint32_t)&SPI[SPINumber]->DR, (uint32_t)Local_pvTxBuffer, Local_u16TxSize);
+
+	SPI[SPINumber]->CR2 |= (1 << SPI_TXDMAEN);
+
+	SPI[SPINumber]->CR1 |= (1 << SPI_SPE);
+}
+
+/**
+ * @brief  : This Function is Used to End a Slave Transaction on NSS Rising Edge , Swap The Buffers & Arm The Next One
+ *
+ * @param  : SPINumber => This Parameter is Used to Select The SPI Peripheral Number -> @SPI_t
+ */
+static void SPI_SlaveNSSRise(SPI_t SPINumber)
+{
+	SPI_Slave_t *Local_Slave = &SPI_Slave[SPINumber];
+
+	uint8_t *Local_pu8Received = NULL;
+
+	uint16_t Local_u16Remaining = 0;
+	uint16_t Local_u16Received = 0;
+
+	if (SPI_SLAVE_DMA_IRQ_SRC == SPI_Context[SPINumber].IrqSource)
+	{
+		/* Freeze Both Channels , The Rx Count Left Tells How Many Bytes The Master Clocked */
+		DMA_StopTransfer(SPI_DMA_TX_CHANNEL[SPINumber]);
+		DMA_GetRemaining(SPI_DMA_RX_CHANNEL[SPINumber], &Local_u16Remaining);
+		DMA_StopTransfer(SPI_DMA_RX_CHANNEL[SPINumber]);
+
+		Local_u16Received = Local_Slave->RxSize - Local_u16Remaining;
+
+		/* The Application Reads This Buffer While The Other One Receives , a Glitch on NSS Keeps The Same One */
+		Local_pu8Received = Local_Slave->RxBuffer[Local_Slave->RxIndex];
+
+		if (0U != Local_u16Received)
+		{
+			Local_Slave->RxIndex ^= 1U;
+		}
+
+		/* Publish Writes With Interrupts Masked , So The Response is Never Seen Half Written Here */
+		if (Local_Slave->PendingReady)
+		{
+			Local_Slave->Response = Local_Slave->Pending;
+			Local_Slave->ResponseSize = Local_Slave->PendingSize;
+			Local_Slave->PendingReady = 0;
+		}
+
+		/* Arm First , The Master May Start The Next Transaction Right After The Required Gap */
+		SPI_SlaveReset(SPINumber);
+		SPI_SlaveArm(SPINumber);
+
+		if ((NULL != Local_Slave->CallBack) && (0U != Local_u16Received))
+		{
+			Local_Slave->CallBack(Local_pu8Received, Local_u16Received);
+		}
+	}
+}
+
+/* NSS EXTI CallBacks */
+static void SPI_Slave1NSSRise(void)
+{
+	SPI_SlaveNSSRise(SPI1_APB2);
+}
+
+static void SPI_Slave2NSSRise(void)
+{
+	SPI_SlaveNSSRise(SPI2_APB1);
+}
 
 /* ======================================================================
  * INTERRUPT HANDLERS
@@ -87,6 +87,14 @@ void SYSTICK_vSetPeriodicInterval( uint32_t Copy_u32Ticks , void(*pvCallBackFunc
  */
 void SYSTICK_vStopInterval( void );
 
+/**
+ * @fn   				 : SYSTICK_vSetOverride
+ * @brief  				 : Function that Routes the SysTick Exception to Another Driver Borrowing SysTick , Then Back to the Interval Modes
+ *
+ * @param pvHandlerFunc  : Function Called on Every SysTick Exception Instead of the Interval CallBack , NULL Ends the Override
+ */
+void SYSTICK_vSetOverride( void(*pvHandlerFunc)(void) ) ;
+
 /**
  * @fn 		: SYSTICK_u32GetElapsedTime
  * @brief   : Function that gets the total Elapsed Time in the form of MilliSeconds which is the Load Value Minus the Current Value
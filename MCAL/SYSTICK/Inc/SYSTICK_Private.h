@@ -27,6 +27,12 @@ extern SYSTICK_CONFIG_t SYSTICK_TIMER_CONFIG ;
 #define AHB_TICK_TIME     	1.0/ SYSTICK_TIMER_CONFIG.CPU_FREQUENCY
 #define AHB_BY8_TICK_TIME 	8.0/ SYSTICK_TIMER_CONFIG.CPU_FREQUENCY
 
+/* SCB Interrupt Control & State Register , Pends & Clears the SysTick Exception */
+#define SCB_ICSR ( *( ( volatile uint32_t * ) 0xE000ED04UL ) )
+
+#define ICSR_PENDSTCLR 25
+#define ICSR_PENDSTSET 26
+
 #define _10POW3 1000UL
 #define _10POW6 1000000UL
 
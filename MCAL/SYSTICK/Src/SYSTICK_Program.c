@@ -42,6 +42,12 @@ volatile uint32_t STK_PeriodicValue ;
 
 STK_MOD_t SYSTICK_MODE = STK_MOD_NONE  ;
 
+/* Set While Another Driver Borrows SysTick , The Interval Above is Left as it Was */
+static void (*SYSTICK_OVERRIDE_PTR_TO_FUNC)(void) = NULL ;
+
+/* The Owner's Exception Was Already Pending When SysTick Was Borrowed */
+static uint8_t SYSTICK_OWNER_PENDING = 0 ;
+
 float _f32TickTime ;
 
 /*==============================================================================================================================================
@@ -281,6 +287,40 @@ void SYSTICK_vStopInterval( void )
 
 }
 
+/**
+ * @fn   				 : SYSTICK_vSetOverride
+ * @brief  				 : Function that Routes the SysTick Exception to Another Driver Borrowing SysTick , Then Back to the Interval Modes
+ *
+ * @param pvHandlerFunc  : Function Called on Every SysTick Exception Instead of the Interval CallBack , NULL Ends the Override
+ * @note                 : The Interval Mode & CallBack Are Kept as They Are , an Exception Already Pending For Them When the Override
+ *                         Starts is Held Back & Pended Again When it Ends , One Pending For the Borrower is Dropped
+ *                         Call With Interrupts Disabled , Around the Borrower's Own Save & Restore of the SysTick Registers
+ */
+void SYSTICK_vSetOverride( void(*pvHandlerFunc)(void) )
+{
+	if( pvHandlerFunc != NULL )
+	{
+		/* Hold Back the Owner's Pending Exception */
+		SYSTICK_OWNER_PENDING = ( uint8_t )( ( ( SCB_ICSR ) >> ICSR_PENDSTSET ) & 0x01 ) ;
+
+		( SCB_ICSR ) = ( 1UL << ICSR_PENDSTCLR ) ;
+	}
+	else
+	{
+		/* Drop the Borrower's Pending Exception & Give the Owner Back its Own */
+		( SCB_ICSR ) = ( 1UL << ICSR_PENDSTCLR ) ;
+
+		if( SYSTICK_OWNER_PENDING == 1 )
+		{
+			( SCB_ICSR ) = ( 1UL << ICSR_PENDSTSET ) ;
+
+			SYSTICK_OWNER_PENDING = 0 ;
+		}
+	}
+
+	SYSTICK_OVERRIDE_PTR_TO_FUNC = pvHandlerFunc ;
+}
+
 /**
  * @fn 		: SYSTICK_u32GetElapsedTime
  * @brief   : Function that gets the total Elapsed Time in the form of MilliSeconds which is the Load Value Minus the Current Value
@@ -346,8 +386,13 @@ uint32_t SYSTICK_u32GetRemainingTimeus (void)
  *==============================================================================================================================================*/
 void SysTick_Handler(void)
 {
+	/* SysTick is Borrowed By Another Driver */
+	if( SYSTICK_OVERRIDE_PTR_TO_FUNC != NULL )
+	{
+		SYSTICK_OVERRIDE_PTR_TO_FUNC(  ) ;
+	}
 	/* Single Interval Mode */
-	if( SYSTICK_MODE == STK_MOD_SINGLE_INTERVAL )
+	else if( SYSTICK_MODE == STK_MOD_SINGLE_INTERVAL )
 	{
 		/* Disable Timer */
 		SYSTICK->SYST_CSR &= (~(1<<CSR_ENABLE)) ;
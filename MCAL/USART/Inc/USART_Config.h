@@ -19,6 +19,33 @@
  * CONFIGURATION PARAMETERS
  * ====================================================================== */
 
-#define F_PCLK 8000000UL
+/* Size of The Continuous Receive Ring Buffer of Each USART Peripheral in Bytes
+ * Must Be a Power of Two ( 16 , 32 , 64 , 128 , 256 , ... )
+ * One Slot is Always Kept Empty , So The Ring Holds ( USART_RX_RING_SIZE - 1 ) Bytes */
+#define USART_RX_RING_SIZE 256U
+
+/* Software Flow Control Watermarks ( Bytes Waiting in The Receive Ring )
+ * XOFF is Sent When The Ring Fills Up to The High Watermark , Leave Room For What The Peer Sends Before it Reacts
+ * XON is Sent When USART_Read Brings it Back Down to The Low Watermark */
+#define USART_XOFF_HIGH_WATERMARK ((USART_RX_RING_SIZE * 3U) / 4U)
+#define USART_XON_LOW_WATERMARK (USART_RX_RING_SIZE / 4U)
+
+/* Size of The Transmit Queue of Each USART Peripheral Used By USART_Write in Bytes
+ * Must Be a Power of Two ( 16 , 32 , 64 , 128 , 256 , ... )
+ * One Slot is Always Kept Empty , So The Queue Holds ( USART_TX_QUEUE_SIZE - 1 ) Bytes */
+#define USART_TX_QUEUE_SIZE 256U
+
+/* Auto BaudRate Detection : Every Bit of The 0x55 Sync Byte Must Be Within This Percentage of The Average Bit Time */
+#define USART_AUTOBAUD_BIT_TOLERANCE_PCT 25U
+
+/* Auto BaudRate Detection : a Measured Rate Within This Error of a Standard Rate ( 9600 , 115200 , ... ) is Rounded to it
+ * Set to 0 to Always Use The Raw Measurement */
+#define USART_AUTOBAUD_SNAP_TOLERANCE_PPM 30000L
+
+/* Auto BaudRate Detection : Highest Rate Accepted , Faster Measurements Are Rejected & Detection Waits For The Next Sync Byte
+ * Each Edge is Time Stamped By an EXTI CallBack , Whose Entry & Dispatch Take Around 100 HCLK Cycles , So a Bit Must Last
+ * Several Times That For Every Edge to Be Caught : at 72 MHz 115200 Leaves 625 Cycles per Bit ( 921600 Would Leave 78 )
+ * Keep it Below HCLK / 500 on Slower Clocks ( 8 MHz => 14400 ) , Higher Rates Need Timer Input Capture Instead of EXTI */
+#define USART_AUTOBAUD_MAX_BAUDRATE 115200UL
 
 #endif /* USART_INC_USART_CONFIG_H_ */
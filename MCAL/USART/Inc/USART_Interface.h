@@ -163,16 +163,78 @@ typedef enum
 } USART_STOP_BITS_t;
 
 /**
- * @brief : This Enum Holds Values of USART Hardware Flow Control Options
+ * @brief : This Enum Holds Values of USART Flow Control Options
  * @enum  : @USART_HW_FLOW_CTRL_t
+ * @note  : Software Flow Control Acts on The Continuous Receive Ring ( XOFF Above USART_XOFF_HIGH_WATERMARK , XON Below USART_XON_LOW_WATERMARK )
+ *          & on Every Transmit Path ( Paused Between a Received XOFF & XON ) , XON & XOFF Are Taken Out of Every Interrupt Reception
+ *          They Are Only Seen While an Interrupt Reception Runs , DMA Receptions Store Them as Data
  */
 typedef enum
 {
     USART_HW_FLOW_CTRL_DIS = 0,
-    USART_HW_FLOW_CTRL_EN = 1,
+    USART_HW_FLOW_CTRL_EN = 1,       /* RTS & CTS */
+    USART_SW_FLOW_CTRL_XON_XOFF = 2, /* XON ( 0x11 ) & XOFF ( 0x13 ) , For 3 Wire Links */
 
 } USART_HW_FLOW_CTRL_t;
 
+/**
+ * @brief : This Enum Holds Values of LIN Break Detection Length Options
+ * @enum  : @USART_LINBreakLength_t
+ */
+typedef enum
+{
+    USART_LIN_BREAK_10_BITS = 0,
+    USART_LIN_BREAK_11_BITS = 1,
+
+} USART_LINBreakLength_t;
+
+/**
+ * @brief : This Enum Holds Values of USART Clock Mode Options
+ * @enum  : @USART_ClockMode_t
+ * @note  : Synchronous Mode Drives The CK Pin as a Master Clock ( Like an SPI Master Without NSS , LSB First )
+ *          The Clock Only Runs While Transmitting , So Use USART_TransceiveBuffer to Read a Slave
+ */
+typedef enum
+{
+    USART_ASYNC_MODE = 0, /* By default */
+    USART_SYNC_MODE = 1,
+
+} USART_ClockMode_t;
+
+/**
+ * @brief : This Enum Holds Values of USART Clock Polarity Options ( Synchronous Mode )
+ * @enum  : @USART_CPOL_t
+ */
+typedef enum
+{
+    USART_CLK_IDLE_LOW = 0, /* By default */
+    USART_CLK_IDLE_HIGH = 1,
+
+} USART_CPOL_t;
+
+/**
+ * @brief : This Enum Holds Values of USART Clock Phase Options ( Synchronous Mode )
+ * @enum  : @USART_CPHA_t
+ */
+typedef enum
+{
+    USART_CAPTURE_LEADING = 0,  /* Sample data at first edge & Setup data at second edge */
+    USART_CAPTURE_TRAILING = 1, /* Setup data at first edge & Sample data at second edge */
+
+} USART_CPHA_t;
+
+/**
+ * @brief : This Enum Holds Values of USART Last Bit Clock Pulse Options ( Synchronous Mode )
+ * @enum  : @USART_LastBitClock_t
+ * @note  : Shift Registers & Most Sensors Need The Pulse , Otherwise The MSB is Never Clocked in
+ */
+typedef enum
+{
+    USART_LAST_BIT_CLK_DIS = 0, /* No Clock Pulse For The Last Data Bit */
+    USART_LAST_BIT_CLK_EN = 1,
+
+} USART_LastBitClock_t;
+
 /**
  * @brief : This Struct Holds Values of USART Configuration Options
  * @struct: @USART_Config_t
@@ -188,9 +250,54 @@ typedef struct
     USART_STOP_BITS_t StopBits;
     USART_HW_FLOW_CTRL_t HW_FlowControlMode;
     uint32_t BaudRate;
+    USART_ClockMode_t ClockMode;       /* Left Zero For Asynchronous Mode */
+    USART_CPOL_t ClockPolarity;        /* Synchronous Mode Only */
+    USART_CPHA_t ClockPhase;           /* Synchronous Mode Only */
+    USART_LastBitClock_t LastBitClock; /* Synchronous Mode Only */
 
 } USART_Config_t;
 
+/**
+ * @brief : This Struct Holds a Validated USART Peripheral Handle Returned By USART_InitHandle
+ * @struct: @USART_Handle_t
+ * @note  : The Handle is Read Only For The Application , The Fast Path Functions Trust it & Skip All Argument Checks
+ */
+typedef struct
+{
+    USART_RegDef_t *Instance; /* Peripheral Registers */
+    USART_t Number;           /* Peripheral Number */
+    uint16_t DataMask;        /* Mask to Strip The Parity Bit From Received Data */
+    uint8_t SwFlowControl;    /* XON / XOFF Enabled , Sent Items Go Through USART_PutByteFlowControl */
+
+} USART_Handle_t;
+
+/**
+ * @brief : This Struct Holds The Result of a BaudRate Calculation Returned By USART_CalculateBaudRate
+ * @struct: @USART_BaudInfo_t
+ */
+typedef struct
+{
+    uint32_t PCLK;             /* Peripheral Clock Used in The Calculation ( Hz ) */
+    uint16_t BRR;              /* Value Written to The BRR Register */
+    uint32_t AchievedBaudRate; /* BaudRate Actually Generated By BRR ( bps ) */
+    int32_t ErrorPPM;          /* ( Achieved - Required ) / Required in Parts Per Million */
+
+} USART_BaudInfo_t;
+
+/**
+ * @brief : This Struct Holds The Line Error Counters of a USART Peripheral Returned By USART_GetErrorStats
+ * @struct: @USART_ErrorStats_t
+ * @note  : Counters Are Updated By The USART Interrupt Handler , So Errors Are Only Counted While an Interrupt is Enabled
+ */
+typedef struct
+{
+    uint32_t ParityErrors;  /* PE  : Parity Check Failed */
+    uint32_t FramingErrors; /* FE  : Stop Bit Not Found ( Baud Mismatch or Break ) */
+    uint32_t NoiseErrors;   /* NE  : Noise Detected on a Sampled Bit */
+    uint32_t OverrunErrors; /* ORE : A Byte Was Lost as DR Was Not Read in Time */
+
+} USART_ErrorStats_t;
+
 /* ------------------------------------------------------------------------------------------------ */
 /* ------------------------------- FUCTION PROTOTYPES SECTION START ------------------------------- */
 /* ------------------------------------------------------------------------------------------------ */
@@ -213,6 +320,29 @@ ERRORS_t USART_ReadFlag(USART_t USART_Type, USART_Flag_t Flag, USART_FlagStatus_
  */
 ERRORS_t USART_Init(USART_Config_t *USART_Config);
 
+/**
+ * @brief  : This Function is Used to Initialize a Specific USART Peripheral & Return a Validated Handle For The Fast Path Functions
+ * @fn     : USART_InitHandle
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Initialize The USART Peripheral
+ * @param  : Handle => This Parameter is Used to Return a Read Only Handle of The Initialized Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Configuration is Checked Here Only , Functions Taking The Handle ( USART_PutByteFast , ... ) Trust it Without Any Check
+ */
+ERRORS_t USART_InitHandle(USART_Config_t *Config, const USART_Handle_t **Handle);
+
+/**
+ * @brief  : This Function is Used to Calculate The BRR Value of a BaudRate From The Current Peripheral Clock
+ * @fn     : USART_CalculateBaudRate
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : BaudRate => This Parameter is Used to Pass The Required BaudRate in bps
+ * @param  : BaudInfo => This Parameter is Used to Return The BRR Value , The Achieved BaudRate & The Error in ppm
+ * @return : ERRORS_t => USART_NOK if The BaudRate is Out of Range For The Peripheral Clock ( BaudRate > PCLK / 16 or BRR > 0xFFFF )
+ * @note   : USART1 is Clocked From PCLK2 , USART2 & USART3 Are Clocked From PCLK1 , Both Are Read From RCC at Call Time
+ *           Tools/USART_BaudTable Prints & Checks The Result For Every Standard BaudRate at PCLK 8 , 36 & 72 MHz
+ *           The Function Does Not Touch The Peripheral , it Can Be Used to Check a BaudRate Before Calling USART_Init
+ */
+ERRORS_t USART_CalculateBaudRate(USART_t USARTNum, uint32_t BaudRate, USART_BaudInfo_t *BaudInfo);
+
 /**
  * @brief  : This Function is Used to Receive Data Using a USART Peripheral ( Blocking Mode )
  *
@@ -254,7 +384,7 @@ ERRORS_t USART_SetCallBack(USART_t USARTNum, USART_IT_t ITNumber, void (*Pv_Call
 ERRORS_t USART_ReceiveData_IT(USART_Config_t *Config, uint16_t *ReceivedData, void (*pv_CallBackFunc)(void));
 
 /**
- * @brief  : This Function is Used to Send String Using a USART Peripheral ( Non-Blocking Mode )
+ * @brief  : This Function is Used to Send String Using a USART Peripheral ( Blocking Mode )
  * @fn     : USART_SendBuffer
  * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send String Using it
  * @param  : Data   => This Parameter is Used to Pass The Buffer of Data to Be Sent Using The USART Peripheral
@@ -327,9 +457,441 @@ ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_
  * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint8_t BufferSize, void(*pv_CallBackFunc));
+ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint8_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Start Continuous Reception on a USART Peripheral ( Non-Blocking Mode )
+ * @fn     : USART_StartContinuousReceive
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Every Received Byte is Pushed By The ISR Into a Driver Owned Ring Buffer ( USART_RX_RING_SIZE in USART_Config.h )
+ *           & The Receive Interrupt Stays Enabled Until USART_StopContinuousReceive is Called , So No Bytes Are Lost Between Reads
+ *           Use USART_Read to Drain The Ring Buffer
+ */
+ERRORS_t USART_StartContinuousReceive(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Stop Continuous Reception on a USART Peripheral
+ * @fn     : USART_StopContinuousReceive
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Stop Receiving on
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Bytes Already in The Ring Buffer Can Still Be Read Using USART_Read
+ */
+ERRORS_t USART_StopContinuousReceive(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Read The Received Bytes From The Continuous Receive Ring Buffer ( Non-Blocking Mode )
+ * @fn     : USART_Read
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Buffer   => This Parameter is Used to Pass The Buffer to Copy The Received Bytes inside it
+ * @param  : MaxSize  => This Parameter is Used to Pass The Maximum Number of Bytes to Be Copied
+ * @param  : ReadSize => This Parameter is Used to Return The Number of Bytes Actually Copied ( May Be Zero )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : This Function Never Waits , it Returns Whatever is Available Up To MaxSize Bytes
+ */
+ERRORS_t USART_Read(USART_t USARTNum, uint8_t *Buffer, uint16_t MaxSize, uint16_t *ReadSize);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Bytes Waiting in The Continuous Receive Ring Buffer
+ * @fn     : USART_GetRxAvailable
+ * @param  : USARTNum  => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Available => This Parameter is Used to Return The Number of Bytes Waiting to Be Read
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_GetRxAvailable(USART_t USARTNum, uint16_t *Available);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Bytes Dropped Because The Continuous Receive Ring Buffer Was Full
+ * @fn     : USART_GetRxDroppedBytes
+ * @param  : USARTNum     => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : DroppedBytes => This Parameter is Used to Return The Number of Dropped Bytes Since Reception Was Started
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_GetRxDroppedBytes(USART_t USARTNum, uint32_t *DroppedBytes);
+
+/**
+ * @brief  : This Function is Used to Queue Data For Transmission on a USART Peripheral ( Non-Blocking Mode )
+ * @fn     : USART_Write
+ * @param  : Config  => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Send on
+ * @param  : Data    => This Parameter is Used to Pass The Buffer of Data to Be Queued
+ * @param  : Size    => This Parameter is Used to Pass The Number of Bytes to Be Queued
+ * @param  : Written => This Parameter is Used to Return The Number of Bytes Actually Queued ( Less Than Size if The Queue is Full )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Data is Copied Into a Driver Owned Queue ( USART_TX_QUEUE_SIZE in USART_Config.h ) & Drained By TXE Interrupts ,
+ *           So Bytes Go Out Back to Back , The USART_IT_TC CallBack ( USART_SetCallBack ) is Invoked Once The Queue is Fully Sent
+ *           Returns USART_BUSY While a USART_SendBuffer_IT / USART_SendData_IT / DMA Transmission is Running on The Same Peripheral
+ */
+ERRORS_t USART_Write(USART_Config_t *Config, const uint8_t *Data, uint16_t Size, uint16_t *Written);
+
+/**
+ * @brief  : This Function is Used to Get The Number of Bytes Still Waiting in The Transmit Queue
+ * @fn     : USART_GetTxPending
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Pending  => This Parameter is Used to Return The Number of Bytes Not Yet Written to The Data Register
+ * @param  : TxBusy   => This Parameter is Used to Return USART_FLAG_SET While The Queue is Still Being Sent on The Line
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_GetTxPending(USART_t USARTNum, uint16_t *Pending, USART_FlagStatus_t *TxBusy);
+
+/**
+ * @brief  : This Function is Used to Take a Snapshot of The Line Error Counters of a USART Peripheral
+ * @fn     : USART_GetErrorStats
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Stats    => This Parameter is Used to Return The Error Counters -> @USART_ErrorStats_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Each Counter is Read Atomically , But The Interrupt May Update One Counter Between Two Reads
+ */
+ERRORS_t USART_GetErrorStats(USART_t USARTNum, USART_ErrorStats_t *Stats);
+
+/**
+ * @brief  : This Function is Used to Reset The Line Error Counters of a USART Peripheral
+ * @fn     : USART_ClearErrorStats
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_ClearErrorStats(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Enable Address Mark Wake Up ( Multiprocessor Mode ) on a Multi-Drop Bus Node
+ * @fn     : USART_EnableAddressMarkMode
+ * @param  : Config      => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : NodeAddress => This Parameter is Used to Pass The Address of This Node ( 0 to 15 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Receiver is Muted at Once , The Hardware Un-Mutes it When an Address Mark Matching NodeAddress is Received
+ *           & Mutes it Again When an Address Mark of Another Node is Received , No RXNE is Raised While Muted
+ *           The Address Mark is The MSB of The Data ( Bit 7 in 8 Bits Mode , Bit 8 in 9 Bits Mode ) , So Parity Must Be Disabled
+ *           The Matching Address Byte Itself is Received Normally ( With Its MSB Set )
+ */
+ERRORS_t USART_EnableAddressMarkMode(USART_Config_t *Config, uint8_t NodeAddress);
+
+/**
+ * @brief  : This Function is Used to Disable Address Mark Wake Up & Un-Mute The Receiver
+ * @fn     : USART_DisableAddressMarkMode
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_DisableAddressMarkMode(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Mute The Receiver Until The Next Address Mark of This Node
+ * @fn     : USART_EnterMute
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Useful When The Node Has Finished With a Frame Before The Next Address Mark is Sent on The Bus
+ */
+ERRORS_t USART_EnterMute(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Send an Address Mark to Select a Node on a Multi-Drop Bus ( Blocking Mode )
+ * @fn     : USART_SendAddress
+ * @param  : Config  => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : Address => This Parameter is Used to Pass The Address of The Node to Be Selected ( 0 to 15 )
+ * @return : ERRORS_t => USART_BUSY if a Non-Blocking Transmission is Running on The Same Peripheral
+ * @note   : The Address is Sent With Its MSB Set , Data Bytes That Follow Must Keep Their MSB Cleared
+ */
+ERRORS_t USART_SendAddress(USART_Config_t *Config, uint8_t Address);
+
+/**
+ * @brief  : This Function is Used to Abort a Running USART_ReceiveData_IT or USART_ReceiveBuffer_IT Reception
+ * @fn     : USART_AbortReceive_IT
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The CallBack is Not Invoked , Other Receive Modes Are Left Untouched
+ */
+ERRORS_t USART_AbortReceive_IT(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Enable LIN Mode on a USART Peripheral
+ * @fn     : USART_EnableLINMode
+ * @param  : Config      => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : BreakLength => This Parameter is Used to Select The Break Detection Length -> @USART_LINBreakLength_t
+ * @return : ERRORS_t => USART_NOK if The Frame Format is Not 8 Data Bits , No Parity , 1 Stop Bit
+ * @note   : Clock Output , Smartcard , Half Duplex & IrDA Are Disabled as Required By LIN Mode , & The LIN Break Interrupt is Enabled
+ *           Set a USART_IT_LBD CallBack ( USART_SetCallBack ) to Be Notified When a Break is Detected
+ */
+ERRORS_t USART_EnableLINMode(USART_Config_t *Config, USART_LINBreakLength_t BreakLength);
+
+/**
+ * @brief  : This Function is Used to Disable LIN Mode on a USART Peripheral
+ * @fn     : USART_DisableLINMode
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_DisableLINMode(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Send a Break Character
+ * @fn     : USART_SendBreak
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Break Follows Any Character Being Sent , Data Written After it is Sent Once The Break is Over
+ *           The Break is 13 Bits Long in LIN Mode & One Frame Long Otherwise
+ */
+ERRORS_t USART_SendBreak(USART_t USARTNum);
+
+/**
+ * @brief  : This Function is Used to Exchange a Buffer With a Slave in Synchronous Mode ( Blocking Mode )
+ * @fn     : USART_TransceiveBuffer
+ * @param  : Config   => This Parameter is Used to Pass The Configuration Struct of a USART Peripheral in Synchronous Mode
+ * @param  : TxBuffer => This Parameter is Used to Pass The Bytes to Send , NULL Sends 0xFF to Only Clock The Slave Out
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored inside it , NULL Discards Them
+ * @param  : Size     => This Parameter is Used to Pass The Number of Bytes to Exchange
+ * @return : ERRORS_t => USART_NOK if The Peripheral is Not in Synchronous Mode With Both Receiver & Transmitter Enabled
+ *                       USART_OVERRUN_ERROR if a Received Byte Was Lost , The Exchange Stops & RxBuffer is Only Partly Filled
+ * @note   : The Next Byte is Written as Soon as The Data Register is Empty , So The Clock Runs Without Gaps Between Bytes
+ */
+ERRORS_t USART_TransceiveBuffer(USART_Config_t *Config, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size);
+
+/**
+ * @brief  : This Function is Used to Exchange a Buffer With a Slave in Synchronous Mode ( Non-Blocking Mode )
+ * @fn     : USART_TransceiveBuffer_IT
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of a USART Peripheral in Synchronous Mode
+ * @param  : TxBuffer        => This Parameter is Used to Pass The Bytes to Send
+ * @param  : RxBuffer        => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored inside it
+ * @param  : Size            => This Parameter is Used to Pass The Number of Bytes to Exchange
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked Once The Last Byte is Received or The Exchange is Aborted
+ * @return : ERRORS_t => USART_BUSY if a Reception or Transmission is Still Running on The Peripheral
+ * @note   : Runs The Buffer Transmit & Buffer Receive Interrupt Paths Together , Each Received Byte Releases The Next One to Send ,
+ *           So at Most USART_SYNC_MAX_IN_FLIGHT Bytes Are Clocked Ahead of The Receiver , The CallBack Marks The End of The Exchange
+ *           An Overrun Ends The Exchange Early , The CallBack Reads The Result Through USART_GetTransceiveStatus
+ *           Replaces The USART_IT_RXNE CallBack , The USART_IT_TC CallBack is Left as it is & Not Invoked
+ */
+ERRORS_t USART_TransceiveBuffer_IT(USART_Config_t *Config, uint8_t *TxBuffer, uint8_t *RxBuffer, uint8_t Size, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Get The Result of The Last USART_TransceiveBuffer_IT Exchange
+ * @fn     : USART_GetTransceiveStatus
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Status   => This Parameter is Used to Return USART_OK , or USART_OVERRUN_ERROR if a Received Byte Was Lost & The Exchange Was Ended Early
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Meant to Be Called From The Completion Call Back
+ */
+ERRORS_t USART_GetTransceiveStatus(USART_t USARTNum, ERRORS_t *Status);
+
+/**
+ * @brief  : This Function is Used to Detect The BaudRate of The Host From a 0x55 Sync Byte & Program BRR ( Non-Blocking Mode )
+ * @fn     : USART_StartAutoBaud
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of an Initialized USART Peripheral , Its BaudRate is Updated
+ * @param  : Timeout         => This Parameter is Used to Pass The Time in Milliseconds to Wait For a Valid Sync Byte ( Non Zero )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With The Detected BaudRate , or 0 on Timeout ( May Be NULL )
+ * @return : ERRORS_t => USART_BUSY if a Detection or a Reception is Already Running
+ * @note   : The RX Pin Edges Are Time Stamped Through EXTI Using SysTick as a Free Running Counter , SysTick is Used EXCLUSIVELY Until
+ *           Detection Ends , Times Out or is Stopped : The SysTick Interrupt Only Counts The Timeout Meanwhile , So No SysTick Delay or
+ *           Time Base May Be Used , Its Settings & The Count Left in Its Current Period Are Restored at The End , Its Ticks Resume Late
+ *           By The Detection Time , The Timeout is Counted in SysTick Wraps ( 2^24 HCLK Cycles , 233 ms at 72 MHz ) & Rounded up to One
+ *           Rates Above USART_AUTOBAUD_MAX_BAUDRATE Are Rejected ( EXTI Can Not Time Faster Edges ) , SysTick Must Not Preempt The EXTI IRQ
+ *           AFIO Clock Must Be Enabled & The EXTI IRQ Enabled in NVIC ( USART1 => PA10 EXTI15_10 , USART2 => PA3 EXTI3 , USART3 => PB11 EXTI15_10 )
+ *           The Receiver is Off Until Detection Ends , So The Sync Byte is Consumed , Default ( Not Remapped ) Pins Only
+ */
+ERRORS_t USART_StartAutoBaud(USART_Config_t *Config, uint32_t Timeout, void (*pv_CallBackFunc)(uint32_t BaudRate));
+
+/**
+ * @brief  : This Function is Used to Abort a Running Auto BaudRate Detection
+ * @fn     : USART_StopAutoBaud
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : BRR is Left Unchanged , The Receiver is Enabled Again & SysTick is Restored , The CallBack is Not Invoked
+ */
+ERRORS_t USART_StopAutoBaud(void);
+
+/**
+ * @brief  : This Function is Used to Send a Buffer Using a USART Peripheral Through DMA ( Non-Blocking Mode )
+ * @fn     : USART_SendBuffer_DMA
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Send on
+ * @param  : DataBuffer      => This Parameter is Used to Pass The Buffer of Data to Be Sent , Must Stay Valid Until The CallBack
+ * @param  : BufferSize      => This Parameter is Used to Pass The Number of Bytes to Be Sent
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function Invoked When DMA Has Loaded The Last Byte ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The USART TX DMA Channel is Used By Another Driver
+ * @note   : DMA1 Clock Must Be Enabled & The Channel IRQ Enabled in NVIC ( USART1 => CH4 , USART2 => CH7 , USART3 => CH2 )
+ *           The Last Byte May Still Be Shifting Out When The CallBack is Invoked , Wait For Transmission Complete Before Disabling The Peripheral
+ *           Transfer Errors Are Reported Through The USART_IT_ERR CallBack , an XOFF From The Peer Holds The DMA Requests Until XON
+ */
+ERRORS_t USART_SendBuffer_DMA(USART_Config_t *Config, const uint8_t *DataBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Receive Continuously Into a Circular Buffer Using a USART Peripheral Through DMA ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveCircular_DMA
+ * @param  : Config             => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : ReceiveBuffer      => This Parameter is Used to Pass The Circular Buffer Filled By DMA
+ * @param  : BufferSize         => This Parameter is Used to Pass The Size of The Circular Buffer in Bytes
+ * @param  : pv_HalfCallBackFunc => This Parameter is Used to Pass The CallBack Invoked When The First Half is Filled ( May Be NULL )
+ * @param  : pv_FullCallBackFunc => This Parameter is Used to Pass The CallBack Invoked When The Second Half is Filled ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The USART RX DMA Channel is Used By Another Driver
+ * @note   : DMA1 Clock Must Be Enabled & The Channel IRQ Enabled in NVIC ( USART1 => CH5 , USART2 => CH6 , USART3 => CH3 )
+ *           Reception Runs Until USART_StopReceive_DMA is Called , The CPU is Not Involved Per Byte
+ */
+ERRORS_t USART_ReceiveCircular_DMA(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize,
+                                   void (*pv_HalfCallBackFunc)(void), void (*pv_FullCallBackFunc)(void));
+
+/**
+ * @brief  : This Function is Used to Stop DMA Reception on a USART Peripheral & Release its DMA Channel
+ * @fn     : USART_StopReceive_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceive_DMA(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Get The Index in The Circular Buffer Where DMA Will Write The Next Received Byte
+ * @fn     : USART_GetReceivePosition_DMA
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Position => This Parameter is Used to Return The Write Index ( 0 to BufferSize - 1 )
+ * @return : ERRORS_t => USART_NOK if No Circular DMA Reception is Running on The Peripheral
+ */
+ERRORS_t USART_GetReceivePosition_DMA(USART_t USARTNum, uint16_t *Position);
+
+/**
+ * @brief  : This Function is Used to Receive Variable Length Frames Separated By an Idle Line Using a USART Peripheral ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveToIdle_IT
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : ReceiveBuffer   => This Parameter is Used to Pass The Buffer Each Frame is Received inside it
+ * @param  : BufferSize      => This Parameter is Used to Pass The Size of The Buffer ( Maximum Frame Length )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With The Frame Length Once The Line Goes Idle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Every Frame Starts at The Beginning of The Buffer , So The CallBack Must Consume The Frame Before Returning
+ *           A Frame Longer Than The Buffer is Delivered in BufferSize Chunks , Reception Stays Armed Until USART_StopReceiveToIdle
+ */
+ERRORS_t USART_ReceiveToIdle_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(uint16_t Length));
+
+/**
+ * @brief  : This Function is Used to Receive Variable Length Frames Separated By an Idle Line Using a USART Peripheral Through DMA ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveToIdle_DMA
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : ReceiveBuffer   => This Parameter is Used to Pass The Buffer Each Frame is Received inside it
+ * @param  : BufferSize      => This Parameter is Used to Pass The Size of The Buffer ( Maximum Frame Length )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With The Frame Length Once The Line Goes Idle
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The USART RX DMA Channel is Used By Another Driver
+ * @note   : Only One Interrupt is Raised Per Frame , DMA is Re-Armed at The Beginning of The Buffer For Every Frame
+ *           DMA1 Clock Must Be Enabled & The Channel IRQ Enabled in NVIC ( USART1 => CH5 , USART2 => CH6 , USART3 => CH3 )
+ */
+ERRORS_t USART_ReceiveToIdle_DMA(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(uint16_t Length));
+
+/**
+ * @brief  : This Function is Used to Stop Receive To Idle Reception ( Interrupt or DMA ) on a USART Peripheral
+ * @fn     : USART_StopReceiveToIdle
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceiveToIdle(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Start Stream Reception , Every Received Byte is Handed to a CallBack From The ISR ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveStream_IT
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With Each Received Byte
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Meant For Protocol Layers ( e.g. COBS ) That Parse The Stream on The Fly , The CallBack Runs in Interrupt Context So Keep it Short
+ *           Reception Stays Armed Until USART_StopReceiveStream is Called
+ */
+ERRORS_t USART_ReceiveStream_IT(USART_Config_t *Config, void (*pv_CallBackFunc)(uint8_t Data));
+
+/**
+ * @brief  : This Function is Used to Stop Stream Reception on a USART Peripheral
+ * @fn     : USART_StopReceiveStream
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceiveStream(USART_Config_t *Config);
+
+/**
+ * @brief  : This Function is Used to Send One Data Item Using a Validated Handle While Software Flow Control is Enabled ( Blocking Mode )
+ * @fn     : USART_PutByteFlowControl
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @param  : Data   => This Parameter is Used to Pass The Data to Be Sent
+ * @return : void
+ * @note   : Called By USART_PutByteFast , Waits While The Peer Holds us With XOFF & For an XON / XOFF Still Owed to The Peer
+ */
+void USART_PutByteFlowControl(const USART_Handle_t *Handle, uint16_t Data);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* ------------------------------- FUCTION PROTOTYPES SECTION END ------------------------------- */
 /* ---------------------------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------------------------------- */
+/* ------------------------------- FAST PATH FUNCTIONS ( INLINE ) ------------------------------- */
+/* ----------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief  : This Function is Used to Send One Data Item Using a Validated Handle ( Blocking Mode )
+ * @fn     : USART_PutByteFast
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @param  : Data   => This Parameter is Used to Pass The Data to Be Sent
+ * @return : void
+ * @note   : Waits For The Data Register Only , Not For Transmission Complete , So Consecutive Calls Keep The Line Busy
+ */
+static inline void USART_PutByteFast(const USART_Handle_t *Handle, uint16_t Data)
+{
+    if (Handle->SwFlowControl)
+    {
+        /* The ISR May Write XON / XOFF to DR , So TXE & DR Are Shared With it */
+        USART_PutByteFlowControl(Handle, Data);
+    }
+    else
+    {
+        while (0 == (Handle->Instance->SR & (1 << USART_TDATA_REG_EMPTY)))
+        {
+        }
+        Handle->Instance->DR = Data;
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Receive One Data Item Using a Validated Handle ( Blocking Mode )
+ * @fn     : USART_GetByteFast
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @return : uint16_t => The Received Data With The Parity Bit Stripped
+ */
+static inline uint16_t USART_GetByteFast(const USART_Handle_t *Handle)
+{
+    while (0 == (Handle->Instance->SR & (1 << USART_RDATA_REG_NEMPTY)))
+    {
+    }
+    return (uint16_t)(Handle->Instance->DR & Handle->DataMask);
+}
+
+/**
+ * @brief  : This Function is Used to Wait Until The Last Data Item Has Left The Line Using a Validated Handle
+ * @fn     : USART_WaitTxCompleteFast
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @return : void
+ */
+static inline void USART_WaitTxCompleteFast(const USART_Handle_t *Handle)
+{
+    while (0 == (Handle->Instance->SR & (1 << USART_TRANSMISSION_COMP)))
+    {
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Send a Buffer Using a Validated Handle ( Blocking Mode )
+ * @fn     : USART_SendBufferFast
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @param  : Data   => This Parameter is Used to Pass The Buffer of Data to Be Sent
+ * @param  : Size   => This Parameter is Used to Pass The Number of Bytes to Be Sent
+ * @return : void
+ */
+static inline void USART_SendBufferFast(const USART_Handle_t *Handle, const uint8_t *Data, uint16_t Size)
+{
+    while (Size--)
+    {
+        USART_PutByteFast(Handle, *Data++);
+    }
+    USART_WaitTxCompleteFast(Handle);
+}
+
+/**
+ * @brief  : This Function is Used to Receive a Buffer Using a Validated Handle ( Blocking Mode )
+ * @fn     : USART_ReceiveBufferFast
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @param  : Data   => This Parameter is Used to Pass The Buffer to Receive inside it
+ * @param  : Size   => This Parameter is Used to Pass The Number of Bytes to Be Received
+ * @return : void
+ */
+static inline void USART_ReceiveBufferFast(const USART_Handle_t *Handle, uint8_t *Data, uint16_t Size)
+{
+    while (Size--)
+    {
+        *Data++ = (uint8_t)USART_GetByteFast(Handle);
+    }
+}
+
 #endif /* USART_INC_USART_INTERFACE_H_ */
@@ -49,9 +49,9 @@ static ERRORS_t USART_SetMode(USART_t UsartNum, USART_Mode_t Mode);
  * @brief  : This Function is Used to Set The BaudRate of USART Peripheral
  *
  * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Set The BaudRate
- * @return : void
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-static void USART_SetBaudRate(USART_Config_t *Config);
+static ERRORS_t USART_SetBaudRate(USART_Config_t *Config);
 
 /**
  * @brief  : This Function is Used to Handle The Interrupts of USART Peripheral
@@ -62,6 +62,106 @@ static void USART_SetBaudRate(USART_Config_t *Config);
  */
 static void USART_HANDLE_IT(USART_t USARTNum);
 
+/**
+ * @brief  : This Function is Used to Find The USART Peripheral Served By a DMA Channel
+ * @fn     : USART_DMA_FindPeriph
+ * @param  : Channel    => This Parameter is Used to Pass The DMA Channel That Raised The Interrupt
+ * @param  : ChannelMap => This Parameter is Used to Pass The TX or RX Channel Table
+ * @return : USART_t => USART_MAX_NUMBER if No USART Uses This Channel
+ */
+static USART_t USART_DMA_FindPeriph(DMA_Channel_t Channel, const DMA_Channel_t *ChannelMap);
+
+/**
+ * @brief  : DMA CallBacks Used By The USART DMA Functions ( Private Functions )
+ * @param  : Channel => This Parameter is Used to Pass The DMA Channel That Raised The Interrupt
+ * @return : void
+ */
+static void USART_DMA_TxComplete(DMA_Channel_t Channel);
+static void USART_DMA_TxError(DMA_Channel_t Channel);
+static void USART_DMA_RxHalfComplete(DMA_Channel_t Channel);
+static void USART_DMA_RxComplete(DMA_Channel_t Channel);
+static void USART_DMA_RxError(DMA_Channel_t Channel);
+
+/**
+ * @brief  : This Function is Used to Deliver a Received Frame & Re-Arm The Receive To Idle Reception
+ * @fn     : USART_IdleFrameReceived
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : Length   => This Parameter is Used to Pass The Number of Bytes in The Received Frame
+ * @return : void
+ */
+static void USART_IdleFrameReceived(USART_t USARTNum, uint16_t Length);
+
+/**
+ * @brief  : This Function is Used to Queue an XON / XOFF Character Ahead of Any Pending Data
+ * @fn     : USART_SendControlChar
+ * @param  : USARTNum    => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : ControlChar => This Parameter is Used to Pass USART_XON_CHAR or USART_XOFF_CHAR
+ * @return : void
+ * @note   : The Character is Written By The TXE Interrupt , a Newer Request Replaces One Not Yet Sent
+ */
+static void USART_SendControlChar(USART_t USARTNum, uint8_t ControlChar);
+
+/**
+ * @brief  : This Function is Used to Act on an XON / XOFF Character Received By Any Interrupt Reception
+ * @fn     : USART_ReceiveControlChar
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : Data     => This Parameter is Used to Pass The Received Byte , Parity Bit Stripped
+ * @return : uint8_t => 1 if The Byte Was XON or XOFF & is Consumed , 0 if it is Data
+ * @note   : XOFF Holds Every Transmit Path Until XON , a DMA Transfer is Held By Clearing Its DMA Request
+ */
+static uint8_t USART_ReceiveControlChar(USART_t USARTNum, uint8_t Data);
+
+/**
+ * @brief  : This Function is Used to End a USART_TransceiveBuffer_IT Exchange & Invoke Its CallBack
+ * @fn     : USART_SyncExchangeEnd
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : Status   => This Parameter is Used to Pass The Result Returned By USART_GetTransceiveStatus
+ * @return : void
+ */
+static void USART_SyncExchangeEnd(USART_t USARTNum, ERRORS_t Status);
+
+/**
+ * @brief  : This Function is Used to Clear & Set Bits of CR1 as One Uninterrupted Read Modify Write
+ * @fn     : USART_UpdateCR1
+ * @param  : USARTNum  => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : ClearBits => This Parameter is Used to Pass The CR1 Bits to Be Cleared
+ * @param  : SetBits   => This Parameter is Used to Pass The CR1 Bits to Be Set
+ * @return : void
+ * @note   : Every CR1 Update Made While The Peripheral Runs Goes Through Here , The ISR Shares The Interrupt Enable Bits
+ */
+static void USART_UpdateCR1(USART_t USARTNum, uint16_t ClearBits, uint16_t SetBits);
+
+/**
+ * @brief  : This Function is Used to Time Stamp an Edge on The RX Pin During Auto BaudRate Detection
+ * @fn     : USART_AutoBaudEdge
+ * @return : void
+ * @note   : EXTI CallBack , Kept Short as Every Bit Boundary of The Sync Byte Raises it
+ */
+static void USART_AutoBaudEdge(void);
+
+/**
+ * @brief  : This Function is Used to Check The Captured Edges , Program BRR & Finish Auto BaudRate Detection
+ * @fn     : USART_AutoBaudEvaluate
+ * @return : void
+ * @note   : Detection Restarts From The Next Falling Edge if The Edges Do Not Look Like a 0x55 Byte
+ */
+static void USART_AutoBaudEvaluate(void);
+
+/**
+ * @brief  : This Function is Used to Release The EXTI Line & SysTick Borrowed By Auto BaudRate Detection
+ * @fn     : USART_AutoBaudRelease
+ * @return : void
+ */
+static void USART_AutoBaudRelease(void);
+
+/**
+ * @brief  : This Function is Used to Count SysTick Wraps During Auto BaudRate Detection & End it Once The Timeout Elapsed
+ * @fn     : USART_AutoBaudTick
+ * @return : void
+ * @note   : Installed as The SysTick Override While Detection Runs , The CallBack Gets a BaudRate of 0 on Timeout
+ */
+static void USART_AutoBaudTick(void);
+
 /* ======================================================================
  * PRIVATE MACROS
  * ====================================================================== */
@@ -75,22 +175,229 @@ static void USART_HANDLE_IT(USART_t USARTNum);
 #define USART_CTSIE_MASK 0xFBFF
 #define USART_EIE_MASK 0xFFFE
 #define USART_STOP_MASK 0xCFFF
+#define USART_CLOCK_MASK 0xF0FF
 
 #define USART_CLEAR_PARITY_8_MASK 0x7F
 #define USART_CLEAR_PARITY_9_MASK 0xFF
 
+#define USART_DATA_8_BITS_MASK 0xFF
+#define USART_DATA_9_BITS_MASK 0x1FF
+
+/* Multiprocessor Communication */
+#define USART_ADD_MASK 0xFFF0
+#define USART_NODE_ADDRESS_MAX 0x0FU
+#define USART_ADDRESS_MARK_8_BITS 0x0080U
+#define USART_ADDRESS_MARK_9_BITS 0x0100U
+
+/* LIN Mode : CLKEN & STOP in CR2 , SCEN , HDSEL & IREN in CR3 Must Be Cleared */
+#define USART_LIN_CR2_CLEAR_MASK 0x3800U
+#define USART_LIN_CR3_CLEAR_MASK 0x002AU
+
+/* Synchronous Mode : LINEN in CR2 , SCEN , HDSEL & IREN in CR3 Must Be Cleared */
+#define USART_SYNC_CR3_CLEAR_MASK 0x002AU
+
+/* Sent in Synchronous Mode When Only Receiving */
+#define USART_SYNC_DUMMY_BYTE 0xFFU
+
+/* Synchronous Exchange : One Byte Shifting & One Waiting in DR , a Third Would Overwrite a Received Byte Not Yet Read */
+#define USART_SYNC_MAX_IN_FLIGHT 2U
+
+/* Auto BaudRate : 0x55 is Sent LSB First , So Every Bit Boundary From The Start Bit to The Stop Bit is an Edge
+ * The First ( Falling ) & Last ( Rising ) Edges Are 9 Bit Times Apart */
+#define USART_AUTOBAUD_EDGES 10U
+#define USART_AUTOBAUD_SYNC_BITS 9U
+
+#define USART_SYSTICK_MAX_RELOAD 0x00FFFFFFUL
+
+/* SysTick Wraps Every 2^24 HCLK Cycles While Detecting , The Timeout is Counted in Those Wraps */
+#define USART_SYSTICK_WRAP_SHIFT 24U
+
+/* SR Line Error Flags ( PE , FE , NE , ORE ) */
+#define USART_SR_ERROR_MASK 0x000FU
+
+/* BRR Limits : USARTDIV Must Be >= 1.0 ( Mantissa Non Zero ) & Fit in 16 Bits */
+#define USART_BRR_MIN 0x10UL
+#define USART_BRR_MAX 0xFFFFUL
+
+#define USART_RX_RING_MASK (USART_RX_RING_SIZE - 1U)
+
+#if ((USART_RX_RING_SIZE & USART_RX_RING_MASK) != 0U) || (USART_RX_RING_SIZE < 2U)
+#error "USART_RX_RING_SIZE Must Be a Power of Two"
+#endif
+
+#if (USART_XON_LOW_WATERMARK >= USART_XOFF_HIGH_WATERMARK) || (USART_XOFF_HIGH_WATERMARK >= USART_RX_RING_SIZE)
+#error "USART Watermarks Must Satisfy XON_LOW < XOFF_HIGH < USART_RX_RING_SIZE"
+#endif
+
+/* Software Flow Control Characters */
+#define USART_XON_CHAR 0x11U
+#define USART_XOFF_CHAR 0x13U
+
+#define USART_TX_QUEUE_MASK (USART_TX_QUEUE_SIZE - 1U)
+
+#if ((USART_TX_QUEUE_SIZE & USART_TX_QUEUE_MASK) != 0U) || (USART_TX_QUEUE_SIZE < 2U)
+#error "USART_TX_QUEUE_SIZE Must Be a Power of Two"
+#endif
+
 /* ======================================================================
  * PRIVATE ENUMS
  * ====================================================================== */
 
+/**
+ * @brief : This Enum Holds The Receive State of a USART Peripheral
+ */
+typedef enum
+{
+    USART_RX_IDLE = 0,
+    USART_RX_DATA = 1,
+    USART_RX_BUFFER = 2,
+    USART_RX_CONTINUOUS = 3,
+    USART_RX_TO_IDLE = 4,
+    USART_RX_TO_IDLE_DMA = 5,
+    USART_RX_CIRCULAR_DMA = 6,
+    USART_RX_STREAM = 7,
+
+} USART_RxState_t;
+
+/**
+ * @brief : This Enum Holds The Transmit State of a USART Peripheral
+ */
 typedef enum
 {
-    USART_NO_SRC = 0,
-    USART_RECEIVE_DATA = 1,
-    USART_SEND_DATA = 2,
-    USART_SEND_BUFFER = 3,
-    USART_RECEIVE_BUFFER = 4,
+    USART_TX_IDLE = 0,
+    USART_TX_DATA = 1,
+    USART_TX_BUFFER = 2,
+    USART_TX_QUEUE = 3,
+    USART_TX_DMA = 4,
+
+} USART_TxState_t;
+
+/* ======================================================================
+ * PRIVATE STRUCTS
+ * ====================================================================== */
+
+/**
+ * @brief : This Struct Holds The Continuous Receive Ring Buffer of a USART Peripheral
+ * @note  : Single Producer ( ISR Writes Head Only ) & Single Consumer ( USART_Read Writes Tail Only ) ,
+ *          So No Locking is Needed Between Them
+ */
+typedef struct
+{
+    uint8_t Buffer[USART_RX_RING_SIZE];
+    volatile uint16_t Head;         /* Next Slot to Be Written By The ISR */
+    volatile uint16_t Tail;         /* Next Slot to Be Read By The Application */
+    volatile uint32_t DroppedBytes; /* Bytes Received While The Ring Was Full */
+    uint8_t DataMask;               /* Mask to Strip The Parity Bit From Received Data */
 
-} USART_IRQ_SRC_t;
+} USART_RxRing_t;
+
+/**
+ * @brief : This Struct Holds The Transmit Queue of a USART Peripheral Used By USART_Write
+ * @note  : Single Producer ( USART_Write Writes Head Only ) & Single Consumer ( ISR Writes Tail Only )
+ */
+typedef struct
+{
+    uint8_t Buffer[USART_TX_QUEUE_SIZE];
+    volatile uint16_t Head; /* Next Slot to Be Written By The Application */
+    volatile uint16_t Tail; /* Next Slot to Be Sent By The ISR */
+
+} USART_TxQueue_t;
+
+/**
+ * @brief : This Struct Holds All Run Time State of a USART Peripheral
+ * @note  : Receive & Transmit Sides Are Independent , So a Reception & a Transmission Can Run at The Same Time
+ *          & Each Peripheral Has Its Own Instance , So USART1 , USART2 & USART3 Never Share Counters
+ */
+typedef struct
+{
+    /* Call Back Functions Indexed By @USART_IT_t */
+    void (*CallBack[USART_IT_NUM])(void);
+
+    /* Receive Side */
+    volatile USART_RxState_t RxState;
+    uint16_t *RxData;                        /* Destination of USART_ReceiveData_IT */
+    uint8_t *RxBuffer;                       /* Destination of Buffer & Receive To Idle Receptions */
+    uint16_t RxSize;                         /* Size of RxBuffer or of The Circular DMA Buffer */
+    volatile uint16_t RxCounter;             /* Bytes Received Into RxBuffer So Far */
+    void (*RxIdleCallBack)(uint16_t Length); /* Receive To Idle Frame CallBack */
+    void (*RxHalfCallBack)(void);            /* Circular DMA First Half CallBack */
+    void (*RxFullCallBack)(void);            /* Circular DMA Second Half CallBack */
+    void (*RxByteCallBack)(uint8_t Data);    /* Stream Reception Per Byte CallBack */
+    USART_RxRing_t RxRing;
+    volatile USART_ErrorStats_t ErrorStats; /* Line Error Counters */
+
+    /* Synchronous Exchange ( USART_TransceiveBuffer_IT ) , Transmit Paced By The Receive Side */
+    volatile uint8_t SyncExchange;  /* Set While The Exchange Runs */
+    volatile ERRORS_t SyncStatus;   /* Result of The Last Exchange */
+
+    /* Transmit Side */
+    volatile USART_TxState_t TxState;
+    uint16_t TxData;              /* Item of USART_SendData_IT , Loaded By The TXE Interrupt */
+    const uint8_t *TxBuffer;      /* Source of USART_SendBuffer_IT */
+    uint16_t TxSize;              /* Size of TxBuffer */
+    volatile uint16_t TxCounter;  /* Bytes Loaded From TxBuffer So Far */
+    void (*TxDMACallBack)(void);  /* USART_SendBuffer_DMA CallBack */
+    USART_TxQueue_t TxQueue;
+
+    /* Software Flow Control ( XON / XOFF ) */
+    uint8_t SwFlowControl;          /* Enabled By USART_Init */
+    volatile uint8_t TxPaused;      /* Peer Sent XOFF , Every Transmit Path Waits For XON */
+    volatile uint8_t XoffSent;      /* This Side Sent XOFF & Owes The Peer an XON */
+    volatile uint8_t TxControlChar; /* XON / XOFF Waiting to Jump Ahead of The Data , 0 When None */
+
+} USART_Context_t;
+
+/**
+ * @brief : This Struct Holds The State of The Auto BaudRate Detection
+ * @note  : Detection Borrows SysTick , So Only One Peripheral Can Be Detecting at a Time
+ */
+typedef struct
+{
+    USART_Config_t *Config;                           /* Peripheral Being Detected , NULL When Idle */
+    void (*CallBack)(uint32_t BaudRate);              /* Invoked Once BRR is Programmed */
+    volatile uint8_t EdgeCount;                       /* Edges Captured So Far */
+    volatile uint32_t EdgeTime[USART_AUTOBAUD_EDGES]; /* SysTick Value at Each Edge ( Counts Down ) */
+    uint32_t SavedCSR;                                /* SysTick Registers of Its Owner , Restored at The End */
+    uint32_t SavedRVR;
+    uint32_t SavedCVR;                                /* Count Left in The Owner's Interrupted Period */
+    uint32_t TimeoutWraps;                            /* SysTick Wraps Allowed Before Giving Up */
+    volatile uint32_t Wraps;                          /* SysTick Wraps Since Detection Started */
+
+} USART_AutoBaud_t;
+
+/* ======================================================================
+ * PRIVATE INLINE FUNCTIONS
+ * ====================================================================== */
+
+/**
+ * @brief  : This Function is Used to Mask All Configurable Interrupts & Return The Previous PRIMASK
+ *
+ * @return : uint32_t => Previous PRIMASK Value to Be Passed to USART_ExitCritical
+ */
+static inline uint32_t USART_EnterCritical(void)
+{
+    uint32_t Local_u32PriMask;
+
+    __asm volatile("MRS %0, PRIMASK \n"
+                   "CPSID i"
+                   : "=r"(Local_u32PriMask)
+                   :
+                   : "memory");
+
+    return Local_u32PriMask;
+}
+
+/**
+ * @brief  : This Function is Used to Restore PRIMASK Saved By USART_EnterCritical
+ *
+ * @param  : PriMask => This Parameter is Used to Pass The Value Returned By USART_EnterCritical
+ */
+static inline void USART_ExitCritical(uint32_t PriMask)
+{
+    __asm volatile("MSR PRIMASK, %0"
+                   :
+                   : "r"(PriMask)
+                   : "memory");
+}
 
 #endif /* USART_INC_USART_PRIVATE_H_ */
@@ -22,6 +22,11 @@
 #include "../../../LIB/STM32F103xx.h"
 #include "../../../LIB/ErrType.h"
 
+#include "../../RCC/Inc/RCC_Interface.h"
+#include "../../DMA/Inc/DMA_Interface.h"
+#include "../../EXTI/Inc/EXTI_Interface.h"
+#include "../../SYSTICK/Inc/SYSTICK_Interface.h"
+
 #include "../Inc/USART_Interface.h"
 #include "../Inc/USART_Config.h"
 #include "../Inc/USART_Private.h"
@@ -36,19 +41,30 @@
 
 static USART_RegDef_t *USART[USART_MAX_NUMBER] = {USART1, USART2, USART3};
 
-static void (*USART_PTR_TO_FUNC[USART_MAX_NUMBER][USART_IT_NUM])(void) = {NULL};
+static USART_Context_t USART_Context[USART_MAX_NUMBER];
+
+static USART_Handle_t USART_Handle[USART_MAX_NUMBER] = {
+    {USART1, USART_PERIPH_1, USART_DATA_8_BITS_MASK, 0},
+    {USART2, USART_PERIPH_2, USART_DATA_8_BITS_MASK, 0},
+    {USART3, USART_PERIPH_3, USART_DATA_8_BITS_MASK, 0},
+};
+
+static const DMA_Channel_t USART_DMA_TX_CHANNEL[USART_MAX_NUMBER] = {DMA_CHANNEL_4, DMA_CHANNEL_7, DMA_CHANNEL_2};
+
+static const DMA_Channel_t USART_DMA_RX_CHANNEL[USART_MAX_NUMBER] = {DMA_CHANNEL_5, DMA_CHANNEL_6, DMA_CHANNEL_3};
 
-static uint16_t *USART_ReceivedData[USART_MAX_NUMBER] = {NULL};
+/* RX Pins Used By Auto BaudRate Detection ( Default Mapping ) , The EXTI Line Number is Also The Pin Number */
+static GPIO_RegDef_t *const USART_RX_PORT[USART_MAX_NUMBER] = {GPIOA, GPIOA, GPIOB};
 
-static uint8_t *USART_SentBuffer[USART_MAX_NUMBER] = {NULL};
+static const uint8_t USART_RX_AFIO_PORT[USART_MAX_NUMBER] = {0U, 0U, 1U};
 
-static uint8_t *USART_ReceivedBuffer[USART_MAX_NUMBER] = {NULL};
+static const EXTI_LINE_t USART_RX_EXTI_LINE[USART_MAX_NUMBER] = {EXTI_LINE_10, EXTI_LINE_3, EXTI_LINE_11};
 
-static uint8_t USART_SentbufferSize[USART_MAX_NUMBER] = {0};
+static const uint32_t USART_STANDARD_BAUDRATES[] = {1200UL, 2400UL, 4800UL, 9600UL, 14400UL, 19200UL, 38400UL,
+                                                    57600UL, 115200UL, 230400UL, 460800UL, 921600UL};
 
-static uint8_t USART_ReceivebufferSize[USART_MAX_NUMBER] = {0};
+static USART_AutoBaud_t USART_AutoBaud = {0};
 
-static USART_IRQ_SRC_t IRQ_SRC[USART_MAX_NUMBER] = {USART_NO_SRC};
 /*==============================================================================================================================================
  * GLOBAL VARIABLES SECTION END
  *==============================================================================================================================================*/
@@ -114,27 +130,173 @@ ERRORS_t USART_Init(USART_Config_t *USART_Config)
         USART[USART_Config->USART_Number]->CR2 &= (USART_STOP_MASK);
         USART[USART_Config->USART_Number]->CR2 |= (USART_Config->StopBits << STOP);
 
+        /* Set Clock Mode */
+        if (USART_SYNC_MODE == USART_Config->ClockMode)
+        {
+            /* CPOL , CPHA & LBCL Must Be Written While The Transmitter is Disabled , USART_SetMode Enables it Again Below */
+            USART[USART_Config->USART_Number]->CR1 &= (~((1 << TE) | (1 << RE)));
+
+            USART[USART_Config->USART_Number]->CR2 &= (~(1 << LINEN));
+            USART[USART_Config->USART_Number]->CR3 &= (~USART_SYNC_CR3_CLEAR_MASK);
+
+            USART[USART_Config->USART_Number]->CR2 = (USART[USART_Config->USART_Number]->CR2 & USART_CLOCK_MASK) |
+                                                     (1 << CLKEN) |
+                                                     (USART_Config->ClockPolarity << CPOL) |
+                                                     (USART_Config->ClockPhase << CPHA) |
+                                                     (USART_Config->LastBitClock << LBCL);
+        }
+        else
+        {
+            USART[USART_Config->USART_Number]->CR2 &= (USART_CLOCK_MASK);
+        }
+
         /* Set BaudRate */
-        USART_SetBaudRate(USART_Config);
+        Local_u8ErrorStatus = USART_SetBaudRate(USART_Config);
 
         /* Set HW Flow Control */
-        if (USART_Config->HW_FlowControlMode == USART_HW_FLOW_CTRL_DIS)
+        if (USART_Config->HW_FlowControlMode == USART_HW_FLOW_CTRL_EN)
         {
-            USART[USART_Config->USART_Number]->CR3 &= (~((1 << CTSE) | (1 << RTSE)));
+            /* Enable Both RTS & CTS */
+            USART[USART_Config->USART_Number]->CR3 |= (1 << CTSE) | (1 << RTSE);
         }
         else
         {
-            /* Enable Both RTS & CTS */
-            USART[USART_Config->USART_Number]->CR3 |= (1 << CTSE) | (1 << RTSE);
+            USART[USART_Config->USART_Number]->CR3 &= (~((1 << CTSE) | (1 << RTSE)));
         }
 
+        /* Set SW Flow Control , Handled By The ISR */
+        USART_Context[USART_Config->USART_Number].SwFlowControl = (USART_Config->HW_FlowControlMode == USART_SW_FLOW_CTRL_XON_XOFF);
+        USART_Context[USART_Config->USART_Number].TxPaused = 0;
+        USART_Context[USART_Config->USART_Number].XoffSent = 0;
+        USART_Context[USART_Config->USART_Number].TxControlChar = 0;
+        USART_Handle[USART_Config->USART_Number].SwFlowControl = USART_Context[USART_Config->USART_Number].SwFlowControl;
+
         /* Set USART Mode */
         USART_SetMode(USART_Config->USART_Number, USART_Config->Mode);
+
+        /* Data Mask Used By The Fast Path to Strip The Parity Bit */
+        if (USART_Config->WordLength == USART_8_BITS_WIDTH)
+        {
+            USART_Handle[USART_Config->USART_Number].DataMask =
+                (USART_PARITY_DIS != USART_Config->ParityMode) ? USART_CLEAR_PARITY_8_MASK : USART_DATA_8_BITS_MASK;
+        }
+        else
+        {
+            USART_Handle[USART_Config->USART_Number].DataMask =
+                (USART_PARITY_DIS != USART_Config->ParityMode) ? USART_CLEAR_PARITY_9_MASK : USART_DATA_9_BITS_MASK;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Initialize a Specific USART Peripheral & Return a Validated Handle For The Fast Path Functions
+ * @fn     : USART_InitHandle
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Initialize The USART Peripheral
+ * @param  : Handle => This Parameter is Used to Return a Read Only Handle of The Initialized Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Configuration is Checked Here Only , Functions Taking The Handle ( USART_PutByteFast , ... ) Trust it Without Any Check
+ */
+ERRORS_t USART_InitHandle(USART_Config_t *Config, const USART_Handle_t **Handle)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL == Config) || (NULL == Handle))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
     }
     else
+    {
+        Local_u8ErrorStatus = USART_Init(Config);
+
+        *Handle = (USART_OK == Local_u8ErrorStatus) ? &USART_Handle[Config->USART_Number] : NULL;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send One Data Item Using a Validated Handle While Software Flow Control is Enabled ( Blocking Mode )
+ * @fn     : USART_PutByteFlowControl
+ * @param  : Handle => This Parameter is Used to Pass The Handle Returned By USART_InitHandle
+ * @param  : Data   => This Parameter is Used to Pass The Data to Be Sent
+ * @return : void
+ * @note   : Called By USART_PutByteFast , Waits While The Peer Holds us With XOFF & For an XON / XOFF Still Owed to The Peer
+ */
+void USART_PutByteFlowControl(const USART_Handle_t *Handle, uint16_t Data)
+{
+    USART_Context_t *Local_Context = &USART_Context[Handle->Number];
+
+    uint32_t Local_u32PriMask = 0;
+    uint8_t Local_u8Written = 0;
+
+    while (!Local_u8Written)
+    {
+        /* The TXE Interrupt Writes XON / XOFF to DR , Check & Write Without it Getting in Between So Neither Overwrites The Other */
+        Local_u32PriMask = USART_EnterCritical();
+
+        if (!Local_Context->TxPaused && (0U == Local_Context->TxControlChar) &&
+            (Handle->Instance->SR & (1 << USART_TDATA_REG_EMPTY)))
+        {
+            Handle->Instance->DR = Data;
+            Local_u8Written = 1;
+        }
+
+        USART_ExitCritical(Local_u32PriMask);
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Calculate The BRR Value of a BaudRate From The Current Peripheral Clock
+ * @fn     : USART_CalculateBaudRate
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : BaudRate => This Parameter is Used to Pass The Required BaudRate in bps
+ * @param  : BaudInfo => This Parameter is Used to Return The BRR Value , The Achieved BaudRate & The Error in ppm
+ * @return : ERRORS_t => USART_NOK if The BaudRate is Out of Range For The Peripheral Clock ( BaudRate > PCLK / 16 or BRR > 0xFFFF )
+ * @note   : USART1 is Clocked From PCLK2 , USART2 & USART3 Are Clocked From PCLK1 , Both Are Read From RCC at Call Time
+ */
+ERRORS_t USART_CalculateBaudRate(USART_t USARTNum, uint32_t BaudRate, USART_BaudInfo_t *BaudInfo)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint32_t Local_u32PCLK = 0;
+    uint32_t Local_u32BRR = 0;
+    uint32_t Local_u32Achieved = 0;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3 || 0 == BaudRate)
     {
         Local_u8ErrorStatus = USART_NOK;
     }
+    else if (NULL == BaudInfo)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        Local_u32PCLK = (USART_PERIPH_1 == USARTNum) ? RCC_u32GetPCLK2Freq() : RCC_u32GetPCLK1Freq();
+
+        /* USARTDIV = PCLK / ( 16 * BaudRate ) , And BRR = USARTDIV * 16 , So BRR = PCLK / BaudRate Rounded to Nearest */
+        Local_u32BRR = (Local_u32PCLK + (BaudRate / 2U)) / BaudRate;
+
+        if (Local_u32BRR < USART_BRR_MIN || Local_u32BRR > USART_BRR_MAX)
+        {
+            Local_u8ErrorStatus = USART_NOK;
+        }
+        else
+        {
+            Local_u32Achieved = (Local_u32PCLK + (Local_u32BRR / 2U)) / Local_u32BRR;
+
+            BaudInfo->PCLK = Local_u32PCLK;
+            BaudInfo->BRR = (uint16_t)Local_u32BRR;
+            BaudInfo->AchievedBaudRate = Local_u32Achieved;
+            /* Taken From BRR , Not The Rounded Achieved BaudRate Which Hides Errors Below 0.5 bps ( 100 ppm at 4800 ) */
+            BaudInfo->ErrorPPM = (int32_t)(((int64_t)Local_u32PCLK - ((int64_t)Local_u32BRR * BaudRate)) * 1000000LL /
+                                           ((int64_t)Local_u32BRR * BaudRate));
+        }
+    }
     return Local_u8ErrorStatus;
 }
 
@@ -200,15 +362,8 @@ ERRORS_t USART_SendData(USART_Config_t *Config, uint16_t Data)
     {
         /* Configurations are OK */
 
-        /* Wait Until Transmission Data Register Empty Flag is Set */
-
-        while (USART_FLAG_SET != FlagStatus)
-        {
-            USART_ReadFlag(Config->USART_Number, USART_TDATA_REG_EMPTY, &FlagStatus);
-        }
-
-        /* Send Data */
-        USART[Config->USART_Number]->DR = Data;
+        /* Wait Until Transmission Data Register Empty Flag is Set & Send Data , Held While The Peer Sent XOFF */
+        USART_PutByteFast(&USART_Handle[Config->USART_Number], Data);
 
         /* Wait Untill Transmission Complete Flag is Set */
         FlagStatus = USART_FLAG_RESET;
@@ -248,7 +403,7 @@ ERRORS_t USART_SetCallBack(USART_t USARTNum, USART_IT_t ITNumber, void (*Pv_Call
     {
         if (NULL != Pv_CallBackFunc)
         {
-            USART_PTR_TO_FUNC[USARTNum][ITNumber] = Pv_CallBackFunc;
+            USART_Context[USARTNum].CallBack[ITNumber] = Pv_CallBackFunc;
         }
         else
         {
@@ -270,34 +425,40 @@ ERRORS_t USART_ReceiveData_IT(USART_Config_t *Config, uint16_t *ReceivedData, vo
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    if ((NULL != ReceivedData) && (NULL != pv_CallBackFunc))
+    if ((NULL == Config) || (NULL == ReceivedData) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+    {
+        /* Another Reception is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
     {
-        /* Setting IRQ Source */
-        IRQ_SRC[Config->USART_Number] = USART_RECEIVE_DATA;
+        /* Set Receive State */
+        USART_Context[Config->USART_Number].RxState = USART_RX_DATA;
 
         /* Setting Global Variable */
-        USART_ReceivedData[Config->USART_Number] = ReceivedData;
+        USART_Context[Config->USART_Number].RxData = ReceivedData;
 
         /* Setting Call Back Function */
-        USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_RXNE] = pv_CallBackFunc;
+        USART_Context[Config->USART_Number].CallBack[USART_IT_RXNE] = pv_CallBackFunc;
 
         /* Enable Read Data Register Not Empty Interrupt */
-        USART[Config->USART_Number]->CR1 |= (1 << RXNEIE);
-    }
-    else
-    {
-        Local_u8ErrorStatus = NULL_POINTER;
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << RXNEIE));
     }
     return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Send String Using a USART Peripheral ( Non-Blocking Mode )
+ * @brief  : This Function is Used to Send String Using a USART Peripheral ( Blocking Mode )
  * @fn     : USART_SendBuffer
  * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Send String Using it
  * @param  : Data   => This Parameter is Used to Pass The Buffer of Data to Be Sent Using The USART Peripheral
  * @param  : Size   => This Parameter is Used to Pass The Size of The Buffer to Be Sent Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Each Byte is Written as Soon as The Data Register is Empty & Transmission Complete is Waited Only Once After The Last Byte
  */
 ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t Size)
 {
@@ -305,12 +466,29 @@ ERRORS_t USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t
 
     uint8_t Local_u8Counter = 0;
 
+    USART_FlagStatus_t FlagStatus = USART_FLAG_RESET;
+
     if ((NULL != Configuration) && (NULL != Data))
     {
-        /* Send Buffer Elements One By One */
-        for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+        if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Configuration))
+        {
+            /* Configuration is Checked Once , Every Byte Then Only Polls The Status Register */
+            for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+            {
+                USART_PutByteFast(&USART_Handle[Configuration->USART_Number], Data[Local_u8Counter]);
+            }
+
+            /* Wait Untill Transmission Complete Flag is Set For The Last Byte */
+            FlagStatus = USART_FLAG_RESET;
+
+            while (USART_FLAG_SET != FlagStatus)
+            {
+                USART_ReadFlag(Configuration->USART_Number, USART_TRANSMISSION_COMP, &FlagStatus);
+            }
+        }
+        else
         {
-            USART_SendData(Configuration, (uint16_t)Data[Local_u8Counter]);
+            Local_u8ErrorStatus = USART_NOK;
         }
     }
     else
@@ -336,10 +514,17 @@ ERRORS_t USART_ReceiveBuffer(USART_Config_t *Config, uint8_t *ReceivedData, uint
 
     if ((NULL != Config) && (NULL != ReceivedData))
     {
-        /* Receive Buffer Elements One By One */
-        for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+        if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config))
+        {
+            /* Configuration is Checked Once , Every Byte Then Only Polls The Status Register */
+            for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+            {
+                ReceivedData[Local_u8Counter] = (uint8_t)USART_GetByteFast(&USART_Handle[Config->USART_Number]);
+            }
+        }
+        else
         {
-            USART_ReceiveData(Config, (uint16_t *)&ReceivedData[Local_u8Counter]);
+            Local_u8ErrorStatus = USART_NOK;
         }
     }
     else
@@ -457,25 +642,32 @@ ERRORS_t USART_SendData_IT(USART_Config_t *Configuration, uint16_t Data, void (*
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    if ((USART_WRONG_CONFIGURATION != USART_CheckConfig(Configuration)) && (NULL != pv_CallBack_Func))
+    if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Configuration)) || (NULL == pv_CallBack_Func))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_TX_IDLE != USART_Context[Configuration->USART_Number].TxState)
+    {
+        /* Another Transmission is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
     {
         /* Correct Cofiguration */
 
-        /* Setting IRQ_SRC */
-        IRQ_SRC[Configuration->USART_Number] = USART_SEND_DATA;
+        /* Set Transmit State */
+        USART_Context[Configuration->USART_Number].TxState = USART_TX_DATA;
 
         /* Setting Call Back Function */
-        USART_PTR_TO_FUNC[Configuration->USART_Number][USART_IT_TC] = pv_CallBack_Func;
+        USART_Context[Configuration->USART_Number].CallBack[USART_IT_TC] = pv_CallBack_Func;
 
-        /* Send Data */
-        USART[Configuration->USART_Number]->DR = Data;
+        /* Setting Data to Send , Loaded By The TXE Interrupt So an XOFF From The Peer or a Pending XON / XOFF Goes First */
+        USART_Context[Configuration->USART_Number].TxData = Data;
+        USART_Context[Configuration->USART_Number].TxCounter = 0;
+        USART_Context[Configuration->USART_Number].TxSize = 1;
 
-        /* Enable Transmission Complete Interrupt */
-        USART[Configuration->USART_Number]->CR1 |= (1 < TRANS_CIE);
-    }
-    else
-    {
-        Local_u8ErrorStatus = USART_NOK;
+        /* Enable Transmit Data Register Empty Interrupt */
+        USART_UpdateCR1(Configuration->USART_Number, 0U, (1 << TXEIE));
     }
     return Local_u8ErrorStatus;
 }
@@ -493,35 +685,32 @@ ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    USART_FlagStatus_t FlagState = USART_FLAG_RESET;
-
     if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config))
     {
-        if (DataBuffer != NULL && pv_CallBackFunc != NULL)
+        if (USART_TX_IDLE != USART_Context[Config->USART_Number].TxState)
         {
-            /* Setting IRQ Source */
-            IRQ_SRC[Config->USART_Number] = USART_SEND_BUFFER;
+            /* Another Transmission is Still Running on This Peripheral */
+            Local_u8ErrorStatus = USART_BUSY;
+        }
+        else if (DataBuffer != NULL && pv_CallBackFunc != NULL && BufferSize != 0)
+        {
+            /* Set Transmit State */
+            USART_Context[Config->USART_Number].TxState = USART_TX_BUFFER;
 
             /* Setting Buffer to Send Globaly */
-            USART_SentBuffer[Config->USART_Number] = DataBuffer;
+            USART_Context[Config->USART_Number].TxBuffer = DataBuffer;
 
             /* Setting Buffer Size Globaly */
-            USART_SentbufferSize[Config->USART_Number] = BufferSize;
-
-            /* Setting Call Back Function */
-            USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_TC] = pv_CallBackFunc;
+            USART_Context[Config->USART_Number].TxSize = BufferSize;
 
-            /* Send First Character */
-            while (USART_FLAG_SET != FlagState)
-            {
-                USART_ReadFlag(Config->USART_Number, USART_TDATA_REG_EMPTY, &FlagState);
-            }
+            /* Start From The First Element */
+            USART_Context[Config->USART_Number].TxCounter = 0;
 
-            /* Send First Element in the Buffer */
-            USART[Config->USART_Number]->DR = DataBuffer[0];
+            /* Setting Call Back Function */
+            USART_Context[Config->USART_Number].CallBack[USART_IT_TC] = pv_CallBackFunc;
 
-            /* Enable Transfer Complete Interrupt */
-            USART[Config->USART_Number]->CR1 |= (1 << TRANS_CIE);
+            /* Enable Transmit Data Register Empty Interrupt , The ISR Loads Every Element Then Waits For Transmission Complete Once */
+            USART_UpdateCR1(Config->USART_Number, 0U, (1 << TXEIE));
         }
         else
         {
@@ -543,28 +732,36 @@ ERRORS_t USART_SendBuffer_IT(USART_Config_t *Config, uint8_t *DataBuffer, uint8_
  * @param  : BufferSize => This Parameter is Used to Pass The Size of The Buffer to Be Received Using The USART Peripheral
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint8_t BufferSize, void(*pv_CallBackFunc))
+ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint8_t BufferSize, void (*pv_CallBackFunc)(void))
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
     if (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config))
     {
-        if (ReceiveBuffer != NULL && pv_CallBackFunc != NULL)
+        if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+        {
+            /* Another Reception is Still Running on This Peripheral */
+            Local_u8ErrorStatus = USART_BUSY;
+        }
+        else if (ReceiveBuffer != NULL && pv_CallBackFunc != NULL && BufferSize != 0)
         {
-            /* Set IRQ Source */
-            IRQ_SRC[Config->USART_Number] = USART_RECEIVE_BUFFER;
+            /* Set Receive State */
+            USART_Context[Config->USART_Number].RxState = USART_RX_BUFFER;
 
             /* Setting Buffer Size globally */
-            USART_ReceivebufferSize[Config->USART_Number] = BufferSize;
+            USART_Context[Config->USART_Number].RxSize = BufferSize;
+
+            /* Start From The First Element */
+            USART_Context[Config->USART_Number].RxCounter = 0;
 
             /* Setting Buffer to Receive globally */
-            USART_ReceivedBuffer[Config->USART_Number] = ReceiveBuffer;
+            USART_Context[Config->USART_Number].RxBuffer = ReceiveBuffer;
 
             /* Setting Call Back Function */
-            USART_PTR_TO_FUNC[Config->USART_Number][USART_IT_RXNE] = pv_CallBackFunc;
+            USART_Context[Config->USART_Number].CallBack[USART_IT_RXNE] = pv_CallBackFunc;
 
             /* Enable Receive Data Register Not Empty Interrupt */
-            USART[Config->USART_Number]->CR1 |= (1 << RXNEIE);
+            USART_UpdateCR1(Config->USART_Number, 0U, (1 << RXNEIE));
         }
         else
         {
@@ -579,191 +776,1757 @@ ERRORS_t USART_ReceiveBuffer_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer,
 }
 
 /**
- * @brief  : This Function is Used to Check The Configuration of USART Peripheral
- *
- * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Check it
+ * @brief  : This Function is Used to Start Continuous Reception on a USART Peripheral ( Non-Blocking Mode )
+ * @fn     : USART_StartContinuousReceive
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Every Received Byte is Pushed By The ISR Into a Driver Owned Ring Buffer ( USART_RX_RING_SIZE in USART_Config.h )
+ *           & The Receive Interrupt Stays Enabled Until USART_StopContinuousReceive is Called , So No Bytes Are Lost Between Reads
+ *           Use USART_Read to Drain The Ring Buffer
  */
-static ERRORS_t USART_CheckConfig(USART_Config_t *Config)
+ERRORS_t USART_StartContinuousReceive(USART_Config_t *Config)
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    if (Config->Mode < USART_Rx || Config->Mode > USART_Rx_Tx ||
-        Config->USART_Number < USART_PERIPH_1 || Config->USART_Number > USART_PERIPH_3 ||
-        Config->WordLength < USART_8_BITS_WIDTH || Config->WordLength > USART_9_BITS_WIDTH ||
-        Config->ParityMode < USART_PARITY_DIS || Config->ParityMode > USART_PARITY_EN_ODD ||
-        Config->IT_FlagEnable.ParityErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ParityErrorIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.TDataRegEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TDataRegEmptyIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.TransmissionCompleteIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TransmissionCompleteIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.RDataRegNEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.RDataRegNEmptyIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.IDLELineDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.IDLELineDetectedIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.CTSIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.CTSIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.ErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ErrorIT > USART_IT_FLAG_EN ||
-        Config->IT_FlagEnable.LINBreakDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.LINBreakDetectedIT > USART_IT_FLAG_EN ||
-        Config->StopBits < USART_ONE_SB || Config->StopBits > USART_ONE_AND_HALF_SB)
+    if ((NULL == Config) || (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)))
     {
-        Local_u8ErrorStatus = USART_WRONG_CONFIGURATION;
+        Local_u8ErrorStatus = USART_NOK;
     }
+    else if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+    {
+        /* Another Reception is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        /* Disable Receive Data Register Not Empty Interrupt While Resetting The Ring */
+        USART_UpdateCR1(Config->USART_Number, (1 << RXNEIE), 0U);
+
+        /* Reset The Ring Buffer */
+        USART_Context[Config->USART_Number].RxRing.Head = 0;
+        USART_Context[Config->USART_Number].RxRing.Tail = 0;
+        USART_Context[Config->USART_Number].RxRing.DroppedBytes = 0;
+
+        /* Strip The Parity Bit in 8 Bits Width , 9 Bits Width Keeps The Lower 8 Bits */
+        if ((USART_PARITY_DIS != Config->ParityMode) && (USART_8_BITS_WIDTH == Config->WordLength))
+        {
+            USART_Context[Config->USART_Number].RxRing.DataMask = USART_CLEAR_PARITY_8_MASK;
+        }
+        else
+        {
+            USART_Context[Config->USART_Number].RxRing.DataMask = USART_CLEAR_PARITY_9_MASK;
+        }
+
+        /* Set Receive State */
+        USART_Context[Config->USART_Number].RxState = USART_RX_CONTINUOUS;
 
+        /* Enable Receive Data Register Not Empty Interrupt */
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << RXNEIE));
+    }
     return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The BaudRate of USART Peripheral
- *
- * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Set The BaudRate
- * @return : void
+ * @brief  : This Function is Used to Stop Continuous Reception on a USART Peripheral
+ * @fn     : USART_StopContinuousReceive
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Stop Receiving on
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Bytes Already in The Ring Buffer Can Still Be Read Using USART_Read
  */
-static void USART_SetBaudRate(USART_Config_t *Config)
+ERRORS_t USART_StopContinuousReceive(USART_Config_t *Config)
 {
-    float USART_DIV = 0;
-
-    uint32_t DIV_Fraction = 0;
-
-    USART[Config->USART_Number]->BRR = 0;
-
-    /* BaudRate Equation */
-    USART_DIV = F_PCLK / (float)(16U * Config->BaudRate);
-    USART_DIV *= 1000UL;
-
-    /* Set the Mantissa Part */
-    USART[Config->USART_Number]->BRR |= ((uint32_t)USART_DIV / 1000UL) << DIV_MANTISSA;
-
-    /* Calculte the Fraction */
-    DIV_Fraction = (uint32_t)USART_DIV % 1000UL;
-
-    DIV_Fraction = (DIV_Fraction * 16U);
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    /* get Round */
-    DIV_Fraction += 500UL;
+    if ((NULL != Config) && (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config)))
+    {
+        if (USART_RX_CONTINUOUS == USART_Context[Config->USART_Number].RxState)
+        {
+            /* Disable Receive Data Register Not Empty Interrupt */
+            USART_UpdateCR1(Config->USART_Number, (1 << RXNEIE), 0U);
 
-    USART[Config->USART_Number]->BRR |= (uint32_t)(DIV_Fraction / 1000UL) << DIV_FRACTION;
+            /* Clear Receive State */
+            USART_Context[Config->USART_Number].RxState = USART_RX_IDLE;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The Parity Mode of USART Peripheral
- *
- * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
- * @param  : Parity   => This Parameter is Used to Select The Parity Mode to Be Used -> @USART_ParityMode_t
+ * @brief  : This Function is Used to Read The Received Bytes From The Continuous Receive Ring Buffer ( Non-Blocking Mode )
+ * @fn     : USART_Read
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Buffer   => This Parameter is Used to Pass The Buffer to Copy The Received Bytes inside it
+ * @param  : MaxSize  => This Parameter is Used to Pass The Maximum Number of Bytes to Be Copied
+ * @param  : ReadSize => This Parameter is Used to Return The Number of Bytes Actually Copied ( May Be Zero )
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : This Function Never Waits , it Returns Whatever is Available Up To MaxSize Bytes
  */
-static ERRORS_t USART_SetParity(USART_t UsartNum, USART_ParityMode_t Parity)
+ERRORS_t USART_Read(USART_t USARTNum, uint8_t *Buffer, uint16_t MaxSize, uint16_t *ReadSize)
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_3 ||
-        Parity < USART_PARITY_DIS || Parity > USART_PARITY_EN_ODD)
+    uint16_t Local_u16Head = 0;
+    uint16_t Local_u16Tail = 0;
+    uint16_t Local_u16Counter = 0;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
     {
         Local_u8ErrorStatus = USART_NOK;
     }
+    else if ((NULL == Buffer) || (NULL == ReadSize))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
     else
     {
-        switch (Parity)
+        /* Take a Snapshot of The Head Once , Bytes Arriving After That Are Left For The Next Read */
+        Local_u16Head = USART_Context[USARTNum].RxRing.Head;
+        Local_u16Tail = USART_Context[USARTNum].RxRing.Tail;
+
+        while ((Local_u16Tail != Local_u16Head) && (Local_u16Counter < MaxSize))
         {
-        case USART_PARITY_DIS:
-            USART[UsartNum]->CR1 &= (~(1 << PCE));
-            break;
-        case USART_PARITY_EN_EVEN:
-            USART[UsartNum]->CR1 |= (1 << PCE);
-            USART[UsartNum]->CR1 &= (~(1 << PS));
-            break;
-        case USART_PARITY_EN_ODD:
-            USART[UsartNum]->CR1 |= (1 << PCE);
-            USART[UsartNum]->CR1 |= (1 << PS);
-            break;
+            Buffer[Local_u16Counter++] = USART_Context[USARTNum].RxRing.Buffer[Local_u16Tail];
+            Local_u16Tail = (Local_u16Tail + 1U) & USART_RX_RING_MASK;
+        }
+
+        /* Publish The New Tail After Copying , So The ISR Never Overwrites Unread Bytes */
+        USART_Context[USARTNum].RxRing.Tail = Local_u16Tail;
+
+        /* Let The Peer Resume Once The Ring Has Drained Down to The Low Watermark */
+        if (USART_Context[USARTNum].SwFlowControl && USART_Context[USARTNum].XoffSent &&
+            (((USART_Context[USARTNum].RxRing.Head - Local_u16Tail) & USART_RX_RING_MASK) <= USART_XON_LOW_WATERMARK))
+        {
+            USART_Context[USARTNum].XoffSent = 0;
+
+            USART_SendControlChar(USARTNum, USART_XON_CHAR);
         }
+
+        *ReadSize = Local_u16Counter;
     }
     return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Set The Mode of USART Peripheral
- *
- * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
- * @param  : Mode     => This Parameter is Used to Select The Mode to Be Used -> @USART_Mode_t
+ * @brief  : This Function is Used to Get The Number of Bytes Waiting in The Continuous Receive Ring Buffer
+ * @fn     : USART_GetRxAvailable
+ * @param  : USARTNum  => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Available => This Parameter is Used to Return The Number of Bytes Waiting to Be Read
  * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-static ERRORS_t USART_SetMode(USART_t UsartNum, USART_Mode_t Mode)
+ERRORS_t USART_GetRxAvailable(USART_t USARTNum, uint16_t *Available)
 {
     ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_3 ||
-        Mode < USART_Rx || Mode > USART_Rx_Tx)
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
     {
         Local_u8ErrorStatus = USART_NOK;
     }
+    else if (NULL == Available)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
     else
     {
-        switch (Mode)
-        {
-        case USART_Rx:
-            USART[UsartNum]->CR1 &= (~(1 << TE));
-            USART[UsartNum]->CR1 |= (1 << RE);
-            break;
-        case USART_Tx:
-            USART[UsartNum]->CR1 &= (~(1 << RE));
-            USART[UsartNum]->CR1 |= (1 << TE);
-            break;
-        case USART_Rx_Tx:
-            USART[UsartNum]->CR1 |= (1 << TE);
-            USART[UsartNum]->CR1 |= (1 << RE);
-            break;
-        }
+        *Available = (USART_Context[USARTNum].RxRing.Head - USART_Context[USARTNum].RxRing.Tail) & USART_RX_RING_MASK;
     }
     return Local_u8ErrorStatus;
 }
 
 /**
- * @brief  : This Function is Used to Handle The Interrupts of USART Peripheral
- * @fn	   : USART_HANDLE_IT
- * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
- * @return : void
- * @note   : This Function is Used Inside All IRQ Handlers to Handle The Interrupts ( Private Function )
+ * @brief  : This Function is Used to Get The Number of Bytes Dropped Because The Continuous Receive Ring Buffer Was Full
+ * @fn     : USART_GetRxDroppedBytes
+ * @param  : USARTNum     => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : DroppedBytes => This Parameter is Used to Return The Number of Dropped Bytes Since Reception Was Started
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
  */
-static void USART_HANDLE_IT(USART_t USARTNum)
+ERRORS_t USART_GetRxDroppedBytes(USART_t USARTNum, uint32_t *DroppedBytes)
 {
-    USART_FlagStatus_t FlagState = USART_FLAG_RESET;
-
-    /* Read Data Register Not Empty Flag */
-    USART_ReadFlag(USARTNum, USART_RDATA_REG_NEMPTY, &FlagState);
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
 
-    if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_RECEIVE_DATA)
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
     {
-        /* Clearing IRQ Source */
-
-        IRQ_SRC[USARTNum] = USART_NO_SRC;
-
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (NULL == DroppedBytes)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        *DroppedBytes = USART_Context[USARTNum].RxRing.DroppedBytes;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Queue Data For Transmission on a USART Peripheral ( Non-Blocking Mode )
+ * @fn     : USART_Write
+ * @param  : Config  => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Send on
+ * @param  : Data    => This Parameter is Used to Pass The Buffer of Data to Be Queued
+ * @param  : Size    => This Parameter is Used to Pass The Number of Bytes to Be Queued
+ * @param  : Written => This Parameter is Used to Return The Number of Bytes Actually Queued ( Less Than Size if The Queue is Full )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Data is Copied Into a Driver Owned Queue ( USART_TX_QUEUE_SIZE in USART_Config.h ) & Drained By TXE Interrupts ,
+ *           So Bytes Go Out Back to Back , The USART_IT_TC CallBack ( USART_SetCallBack ) is Invoked Once The Queue is Fully Sent
+ *           Returns USART_BUSY While a USART_SendBuffer_IT / USART_SendData_IT / DMA Transmission is Running on The Same Peripheral
+ */
+ERRORS_t USART_Write(USART_Config_t *Config, const uint8_t *Data, uint16_t Size, uint16_t *Written)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint16_t Local_u16Head = 0;
+    uint16_t Local_u16NextHead = 0;
+    uint16_t Local_u16Counter = 0;
+
+    if ((NULL == Config) || (NULL == Data) || (NULL == Written))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if ((USART_TX_IDLE != USART_Context[Config->USART_Number].TxState) &&
+             (USART_TX_QUEUE != USART_Context[Config->USART_Number].TxState))
+    {
+        /* A Buffer or DMA Transmission is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        Local_u16Head = USART_Context[Config->USART_Number].TxQueue.Head;
+
+        /* Copy as Many Bytes as Fit , The ISR Only Moves The Tail So it Can Only Make More Room */
+        while (Local_u16Counter < Size)
+        {
+            Local_u16NextHead = (Local_u16Head + 1U) & USART_TX_QUEUE_MASK;
+
+            if (Local_u16NextHead == USART_Context[Config->USART_Number].TxQueue.Tail)
+            {
+                /* Queue is Full */
+                break;
+            }
+
+            USART_Context[Config->USART_Number].TxQueue.Buffer[Local_u16Head] = Data[Local_u16Counter++];
+            Local_u16Head = Local_u16NextHead;
+        }
+
+        if (0 != Local_u16Counter)
+        {
+            /* Publish The New Head After Copying */
+            USART_Context[Config->USART_Number].TxQueue.Head = Local_u16Head;
+
+            /* The ISR Only Moves The State From Queue to Idle When The Queue is Empty , Which it No Longer is */
+            USART_Context[Config->USART_Number].TxState = USART_TX_QUEUE;
+
+            /* Enable Transmit Data Register Empty Interrupt */
+            USART_UpdateCR1(Config->USART_Number, 0U, (1 << TXEIE));
+        }
+
+        *Written = Local_u16Counter;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Number of Bytes Still Waiting in The Transmit Queue
+ * @fn     : USART_GetTxPending
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Pending  => This Parameter is Used to Return The Number of Bytes Not Yet Written to The Data Register
+ * @param  : TxBusy   => This Parameter is Used to Return USART_FLAG_SET While The Queue is Still Being Sent on The Line
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_GetTxPending(USART_t USARTNum, uint16_t *Pending, USART_FlagStatus_t *TxBusy)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if ((NULL == Pending) || (NULL == TxBusy))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        *Pending = (USART_Context[USARTNum].TxQueue.Head - USART_Context[USARTNum].TxQueue.Tail) & USART_TX_QUEUE_MASK;
+        *TxBusy = (USART_TX_QUEUE == USART_Context[USARTNum].TxState) ? USART_FLAG_SET : USART_FLAG_RESET;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Take a Snapshot of The Line Error Counters of a USART Peripheral
+ * @fn     : USART_GetErrorStats
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Stats    => This Parameter is Used to Return The Error Counters -> @USART_ErrorStats_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Each Counter is Read Atomically , But The Interrupt May Update One Counter Between Two Reads
+ */
+ERRORS_t USART_GetErrorStats(USART_t USARTNum, USART_ErrorStats_t *Stats)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (NULL == Stats)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        Stats->ParityErrors = USART_Context[USARTNum].ErrorStats.ParityErrors;
+        Stats->FramingErrors = USART_Context[USARTNum].ErrorStats.FramingErrors;
+        Stats->NoiseErrors = USART_Context[USARTNum].ErrorStats.NoiseErrors;
+        Stats->OverrunErrors = USART_Context[USARTNum].ErrorStats.OverrunErrors;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Reset The Line Error Counters of a USART Peripheral
+ * @fn     : USART_ClearErrorStats
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_ClearErrorStats(USART_t USARTNum)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        USART_Context[USARTNum].ErrorStats.ParityErrors = 0;
+        USART_Context[USARTNum].ErrorStats.FramingErrors = 0;
+        USART_Context[USARTNum].ErrorStats.NoiseErrors = 0;
+        USART_Context[USARTNum].ErrorStats.OverrunErrors = 0;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Enable Address Mark Wake Up ( Multiprocessor Mode ) on a Multi-Drop Bus Node
+ * @fn     : USART_EnableAddressMarkMode
+ * @param  : Config      => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : NodeAddress => This Parameter is Used to Pass The Address of This Node ( 0 to 15 )
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Receiver is Muted at Once , The Hardware Un-Mutes it When an Address Mark Matching NodeAddress is Received
+ *           & Mutes it Again When an Address Mark of Another Node is Received , No RXNE is Raised While Muted
+ */
+ERRORS_t USART_EnableAddressMarkMode(USART_Config_t *Config, uint8_t NodeAddress)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) ||
+             NodeAddress > USART_NODE_ADDRESS_MAX || USART_PARITY_DIS != Config->ParityMode)
+    {
+        /* With Parity The MSB is The Parity Bit & Can Not Carry The Address Mark */
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        /* Node Address Compared With The 4 LSBs of Every Address Mark */
+        USART[Config->USART_Number]->CR2 &= (USART_ADD_MASK);
+        USART[Config->USART_Number]->CR2 |= (NodeAddress << ADD);
+
+        /* Wake Up on Address Mark Instead of Idle Line */
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << WAKE));
+
+        /* Mute Until Addressed */
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << RWU));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Disable Address Mark Wake Up & Un-Mute The Receiver
+ * @fn     : USART_DisableAddressMarkMode
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_DisableAddressMarkMode(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        USART_UpdateCR1(Config->USART_Number, (1 << RWU) | (1 << WAKE), 0U);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Mute The Receiver Until The Next Address Mark of This Node
+ * @fn     : USART_EnterMute
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => USART_NOK if Address Mark Mode is Not Enabled
+ */
+ERRORS_t USART_EnterMute(USART_t USARTNum)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3 ||
+        0 == (USART[USARTNum]->CR1 & (1 << WAKE)))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        USART_UpdateCR1(USARTNum, 0U, (1 << RWU));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send an Address Mark to Select a Node on a Multi-Drop Bus ( Blocking Mode )
+ * @fn     : USART_SendAddress
+ * @param  : Config  => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : Address => This Parameter is Used to Pass The Address of The Node to Be Selected ( 0 to 15 )
+ * @return : ERRORS_t => USART_BUSY if a Non-Blocking Transmission is Running on The Same Peripheral
+ * @note   : The Address is Sent With Its MSB Set , Data Bytes That Follow Must Keep Their MSB Cleared
+ */
+ERRORS_t USART_SendAddress(USART_Config_t *Config, uint8_t Address)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint16_t Local_u16Mark = 0;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) ||
+             Address > USART_NODE_ADDRESS_MAX || USART_PARITY_DIS != Config->ParityMode)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_TX_IDLE != USART_Context[Config->USART_Number].TxState)
+    {
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        Local_u16Mark = (USART_8_BITS_WIDTH == Config->WordLength) ? USART_ADDRESS_MARK_8_BITS : USART_ADDRESS_MARK_9_BITS;
+
+        Local_u8ErrorStatus = USART_SendData(Config, (uint16_t)(Local_u16Mark | Address));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Abort a Running USART_ReceiveData_IT or USART_ReceiveBuffer_IT Reception
+ * @fn     : USART_AbortReceive_IT
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The CallBack is Not Invoked , Other Receive Modes Are Left Untouched
+ */
+ERRORS_t USART_AbortReceive_IT(USART_t USARTNum)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_RX_DATA == USART_Context[USARTNum].RxState || USART_RX_BUFFER == USART_Context[USARTNum].RxState)
+    {
+        USART_UpdateCR1(USARTNum, (1 << RXNEIE), 0U);
+
+        USART_Context[USARTNum].RxState = USART_RX_IDLE;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Enable LIN Mode on a USART Peripheral
+ * @fn     : USART_EnableLINMode
+ * @param  : Config      => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @param  : BreakLength => This Parameter is Used to Select The Break Detection Length -> @USART_LINBreakLength_t
+ * @return : ERRORS_t => USART_NOK if The Frame Format is Not 8 Data Bits , No Parity , 1 Stop Bit
+ * @note   : Clock Output , Smartcard , Half Duplex & IrDA Are Disabled as Required By LIN Mode , & The LIN Break Interrupt is Enabled
+ */
+ERRORS_t USART_EnableLINMode(USART_Config_t *Config, USART_LINBreakLength_t BreakLength)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config) ||
+             BreakLength < USART_LIN_BREAK_10_BITS || BreakLength > USART_LIN_BREAK_11_BITS ||
+             USART_8_BITS_WIDTH != Config->WordLength || USART_PARITY_DIS != Config->ParityMode || USART_ONE_SB != Config->StopBits)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        USART[Config->USART_Number]->CR2 &= (~USART_LIN_CR2_CLEAR_MASK);
+        USART[Config->USART_Number]->CR3 &= (~USART_LIN_CR3_CLEAR_MASK);
+
+        /* Break Detection Length */
+        USART[Config->USART_Number]->CR2 &= (~(1 << LBDL));
+        USART[Config->USART_Number]->CR2 |= (BreakLength << LBDL);
+
+        USART[Config->USART_Number]->CR2 |= (1 << LINEN) | (1 << LBDIE);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Disable LIN Mode on a USART Peripheral
+ * @fn     : USART_DisableLINMode
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_DisableLINMode(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        USART[Config->USART_Number]->CR2 &= (~((1 << LINEN) | (1 << LBDIE)));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send a Break Character
+ * @fn     : USART_SendBreak
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : The Break Follows Any Character Being Sent , Data Written After it is Sent Once The Break is Over
+ */
+ERRORS_t USART_SendBreak(USART_t USARTNum)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        /* Cleared By Hardware During The Stop Bit of The Break */
+        USART_UpdateCR1(USARTNum, 0U, (1 << SBK));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Exchange a Buffer With a Slave in Synchronous Mode ( Blocking Mode )
+ * @fn     : USART_TransceiveBuffer
+ * @param  : Config   => This Parameter is Used to Pass The Configuration Struct of a USART Peripheral in Synchronous Mode
+ * @param  : TxBuffer => This Parameter is Used to Pass The Bytes to Send , NULL Sends 0xFF to Only Clock The Slave Out
+ * @param  : RxBuffer => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored inside it , NULL Discards Them
+ * @param  : Size     => This Parameter is Used to Pass The Number of Bytes to Exchange
+ * @return : ERRORS_t => USART_NOK if The Peripheral is Not in Synchronous Mode With Both Receiver & Transmitter Enabled
+ *                       USART_OVERRUN_ERROR if a Received Byte Was Lost , The Exchange Stops & RxBuffer is Only Partly Filled
+ * @note   : The Next Byte is Written as Soon as The Data Register is Empty , So The Clock Runs Without Gaps Between Bytes
+ */
+ERRORS_t USART_TransceiveBuffer(USART_Config_t *Config, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint16_t Local_u16TxCounter = 0;
+    uint16_t Local_u16RxCounter = 0;
+    uint16_t Local_u16SR = 0;
+    uint8_t Local_u8Data = 0;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) ||
+             (USART_SYNC_MODE != Config->ClockMode) || (USART_Rx_Tx != Config->Mode))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if ((USART_TX_IDLE != USART_Context[Config->USART_Number].TxState) ||
+             (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState))
+    {
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        while ((USART_OK == Local_u8ErrorStatus) && (Local_u16RxCounter < Size))
+        {
+            Local_u16SR = USART[Config->USART_Number]->SR;
+
+            if (Local_u16SR & (1U << USART_OVERRNUN_ERROR))
+            {
+                /* The Loop Was Held Off For Longer Than a Byte Time ( By Interrupts ) , a Received Byte is Lost */
+                Local_u8ErrorStatus = USART_OVERRUN_ERROR;
+            }
+            else
+            {
+                /* At Most Two Bytes in Flight , One Shifting & One Waiting in DR , So a Received Byte is Never Overwritten */
+                if ((Local_u16TxCounter < Size) && ((uint16_t)(Local_u16TxCounter - Local_u16RxCounter) < USART_SYNC_MAX_IN_FLIGHT) &&
+                    (Local_u16SR & (1U << USART_TDATA_REG_EMPTY)))
+                {
+                    USART[Config->USART_Number]->DR = (NULL != TxBuffer) ? TxBuffer[Local_u16TxCounter] : USART_SYNC_DUMMY_BYTE;
+                    Local_u16TxCounter++;
+                }
+
+                if (Local_u16SR & (1U << USART_RDATA_REG_NEMPTY))
+                {
+                    Local_u8Data = (uint8_t)USART[Config->USART_Number]->DR;
+
+                    if (NULL != RxBuffer)
+                    {
+                        RxBuffer[Local_u16RxCounter] = Local_u8Data;
+                    }
+                    Local_u16RxCounter++;
+                }
+            }
+        }
+
+        if (USART_OVERRUN_ERROR == Local_u8ErrorStatus)
+        {
+            USART_Context[Config->USART_Number].ErrorStats.OverrunErrors++;
+
+            /* Let The Bytes in Flight Finish Clocking , Then Clear ORE & RXNE ( Read SR Then DR ) So The Next Exchange Starts Clean */
+            while (0U == (USART[Config->USART_Number]->SR & (1U << USART_TRANSMISSION_COMP)))
+            {
+            }
+            (void)USART[Config->USART_Number]->SR;
+            (void)USART[Config->USART_Number]->DR;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Exchange a Buffer With a Slave in Synchronous Mode ( Non-Blocking Mode )
+ * @fn     : USART_TransceiveBuffer_IT
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of a USART Peripheral in Synchronous Mode
+ * @param  : TxBuffer        => This Parameter is Used to Pass The Bytes to Send
+ * @param  : RxBuffer        => This Parameter is Used to Pass The Buffer The Received Bytes Are Stored inside it
+ * @param  : Size            => This Parameter is Used to Pass The Number of Bytes to Exchange
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked Once The Last Byte is Received or The Exchange is Aborted
+ * @return : ERRORS_t => USART_BUSY if a Reception or Transmission is Still Running on The Peripheral
+ * @note   : Runs The Buffer Transmit & Buffer Receive Interrupt Paths Together , Each Received Byte Releases The Next One to Send ,
+ *           So at Most USART_SYNC_MAX_IN_FLIGHT Bytes Are Clocked Ahead of The Receiver , The CallBack Marks The End of The Exchange
+ *           An Overrun Ends The Exchange Early , The CallBack Reads The Result Through USART_GetTransceiveStatus
+ *           Replaces The USART_IT_RXNE CallBack , The USART_IT_TC CallBack is Left as it is & Not Invoked
+ */
+ERRORS_t USART_TransceiveBuffer_IT(USART_Config_t *Config, uint8_t *TxBuffer, uint8_t *RxBuffer, uint8_t Size, void (*pv_CallBackFunc)(void))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL == Config) || (NULL == TxBuffer) || (NULL == RxBuffer) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) || (0 == Size) ||
+             (USART_SYNC_MODE != Config->ClockMode) || (USART_Rx_Tx != Config->Mode))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if ((USART_TX_IDLE != USART_Context[Config->USART_Number].TxState) ||
+             (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState))
+    {
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        /* Let Bytes Still Clocking After an Aborted Exchange Finish , Then Drop Them ( Read SR Then DR Also Clears ORE ) */
+        while (0U == (USART[Config->USART_Number]->SR & (1U << USART_TRANSMISSION_COMP)))
+        {
+        }
+        (void)USART[Config->USART_Number]->SR;
+        (void)USART[Config->USART_Number]->DR;
+
+        USART_Context[Config->USART_Number].SyncExchange = 1;
+        USART_Context[Config->USART_Number].SyncStatus = USART_OK;
+
+        /* Arm The Receiver First So The Byte Clocked in With The First Transmitted One is Caught */
+        USART_Context[Config->USART_Number].RxBuffer = RxBuffer;
+        USART_Context[Config->USART_Number].RxSize = Size;
+        USART_Context[Config->USART_Number].RxCounter = 0;
+        USART_Context[Config->USART_Number].CallBack[USART_IT_RXNE] = pv_CallBackFunc;
+        USART_Context[Config->USART_Number].RxState = USART_RX_BUFFER;
+
+        USART_Context[Config->USART_Number].TxBuffer = TxBuffer;
+        USART_Context[Config->USART_Number].TxSize = Size;
+        USART_Context[Config->USART_Number].TxCounter = 0;
+        USART_Context[Config->USART_Number].TxState = USART_TX_BUFFER;
+
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << RXNEIE) | (1 << TXEIE));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Result of The Last USART_TransceiveBuffer_IT Exchange
+ * @fn     : USART_GetTransceiveStatus
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Status   => This Parameter is Used to Return USART_OK , or USART_OVERRUN_ERROR if a Received Byte Was Lost & The Exchange Was Ended Early
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Meant to Be Called From The Completion Call Back
+ */
+ERRORS_t USART_GetTransceiveStatus(USART_t USARTNum, ERRORS_t *Status)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (NULL == Status)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        *Status = USART_Context[USARTNum].SyncStatus;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Detect The BaudRate of The Host From a 0x55 Sync Byte & Program BRR ( Non-Blocking Mode )
+ * @fn     : USART_StartAutoBaud
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of an Initialized USART Peripheral , Its BaudRate is Updated
+ * @param  : Timeout         => This Parameter is Used to Pass The Time in Milliseconds to Wait For a Valid Sync Byte ( Non Zero )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With The Detected BaudRate , or 0 on Timeout ( May Be NULL )
+ * @return : ERRORS_t => USART_BUSY if a Detection or a Reception is Already Running
+ * @note   : The RX Pin Edges Are Time Stamped Through EXTI Using SysTick as a Free Running Counter , SysTick is Used EXCLUSIVELY Until
+ *           Detection Ends , Times Out or is Stopped : The SysTick Interrupt Only Counts The Timeout Meanwhile , So No SysTick Delay or
+ *           Time Base May Be Used , Its Settings & The Count Left in Its Current Period Are Restored at The End , Its Ticks Resume Late
+ *           By The Detection Time , The Timeout is Counted in SysTick Wraps ( 2^24 HCLK Cycles , 233 ms at 72 MHz ) & Rounded up to One
+ *           Rates Above USART_AUTOBAUD_MAX_BAUDRATE Are Rejected ( EXTI Can Not Time Faster Edges ) , SysTick Must Not Preempt The EXTI IRQ
+ *           AFIO Clock Must Be Enabled & The EXTI IRQ Enabled in NVIC ( USART1 => PA10 EXTI15_10 , USART2 => PA3 EXTI3 , USART3 => PB11 EXTI15_10 )
+ *           The Receiver is Off Until Detection Ends , So The Sync Byte is Consumed , Default ( Not Remapped ) Pins Only
+ */
+ERRORS_t USART_StartAutoBaud(USART_Config_t *Config, uint32_t Timeout, void (*pv_CallBackFunc)(uint32_t BaudRate))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    USART_t Local_USARTNum = USART_PERIPH_1;
+    uint8_t Local_u8Line = 0;
+    uint32_t Local_u32PriMask = 0;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) || (USART_Tx == Config->Mode) ||
+             (USART_SYNC_MODE == Config->ClockMode) || (0U == Timeout))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if ((NULL != USART_AutoBaud.Config) || (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState))
+    {
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        Local_USARTNum = Config->USART_Number;
+        Local_u8Line = (uint8_t)USART_RX_EXTI_LINE[Local_USARTNum];
+
+        USART_AutoBaud.Config = Config;
+        USART_AutoBaud.CallBack = pv_CallBackFunc;
+        USART_AutoBaud.EdgeCount = 0;
+        USART_AutoBaud.Wraps = 0;
+
+        /* Milliseconds to Whole SysTick Wraps , Rounded up */
+        USART_AutoBaud.TimeoutWraps = (uint32_t)((((uint64_t)Timeout * RCC_u32GetHCLKFreq()) + ((1000ULL << USART_SYSTICK_WRAP_SHIFT) - 1U)) /
+                                                 (1000ULL << USART_SYSTICK_WRAP_SHIFT));
+
+        /* Keep The Sync Byte Out of The Receiver , it Would Only Raise Framing Errors at The Old BaudRate */
+        USART_UpdateCR1(Local_USARTNum, (1 << RE), 0U);
+
+        /* Borrow SysTick as a Free Running 24 Bits Down Counter at HCLK , Its Owner's Count is Frozen Together With The Settings */
+        Local_u32PriMask = USART_EnterCritical();
+
+        USART_AutoBaud.SavedCVR = SYSTICK->SYST_CVR;
+        USART_AutoBaud.SavedRVR = SYSTICK->SYST_RVR;
+        USART_AutoBaud.SavedCSR = SYSTICK->SYST_CSR;
+
+        SYSTICK->SYST_CSR = 0;
+        SYSTICK->SYST_RVR = USART_SYSTICK_MAX_RELOAD;
+        SYSTICK->SYST_CVR = 0;
+
+        /* Its Interrupt Only Counts Wraps For The Timeout , The Owner's Interval Waits */
+        SYSTICK_vSetOverride(USART_AutoBaudTick);
+
+        SYSTICK->SYST_CSR = (1UL << CSR_CLKSOURCE) | (1UL << CSR_TICKINT) | (1UL << CSR_ENABLE);
+
+        USART_ExitCritical(Local_u32PriMask);
+
+        /* Route The RX Pin to Its EXTI Line */
+        AFIO->EXTICR[Local_u8Line / 4U] = (AFIO->EXTICR[Local_u8Line / 4U] & (~(0x0FUL << ((Local_u8Line % 4U) * 4U)))) |
+                                          ((uint32_t)USART_RX_AFIO_PORT[Local_USARTNum] << ((Local_u8Line % 4U) * 4U));
+
+        MEXTI_SetCallBack(USART_RX_EXTI_LINE[Local_USARTNum], USART_AutoBaudEdge);
+        MEXTI_eEnableEXTILine(USART_RX_EXTI_LINE[Local_USARTNum], EXTI_TRIGGER_ON_CHANGE);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Abort a Running Auto BaudRate Detection
+ * @fn     : USART_StopAutoBaud
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : BRR is Left Unchanged , The Receiver is Enabled Again & SysTick is Restored , The CallBack is Not Invoked
+ */
+ERRORS_t USART_StopAutoBaud(void)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (NULL == USART_AutoBaud.Config)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        USART_AutoBaudRelease();
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Send a Buffer Using a USART Peripheral Through DMA ( Non-Blocking Mode )
+ * @fn     : USART_SendBuffer_DMA
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Send on
+ * @param  : DataBuffer      => This Parameter is Used to Pass The Buffer of Data to Be Sent , Must Stay Valid Until The CallBack
+ * @param  : BufferSize      => This Parameter is Used to Pass The Number of Bytes to Be Sent
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Function Invoked When DMA Has Loaded The Last Byte ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The USART TX DMA Channel is Used By Another Driver
+ * @note   : DMA1 Clock Must Be Enabled & The Channel IRQ Enabled in NVIC ( USART1 => CH4 , USART2 => CH7 , USART3 => CH2 )
+ *           The Last Byte May Still Be Shifting Out When The CallBack is Invoked , Wait For Transmission Complete Before Disabling The Peripheral
+ *           Transfer Errors Are Reported Through The USART_IT_ERR CallBack , an XOFF From The Peer Holds The DMA Requests Until XON
+ */
+ERRORS_t USART_SendBuffer_DMA(USART_Config_t *Config, const uint8_t *DataBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(void))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    DMA_Channel_t Local_Channel = DMA_CHANNEL_1;
+
+    uint32_t Local_u32PriMask = 0;
+
+    DMA_Config_t Local_DMAConfig = {
+        .Direction = DMA_MEM_TO_PERIPH,
+        .Mode = DMA_NORMAL_MODE,
+        .PeriphSize = DMA_SIZE_8_BITS,
+        .MemSize = DMA_SIZE_8_BITS,
+        .PeriphIncrement = DMA_INC_DIS,
+        .MemIncrement = DMA_INC_EN,
+        .Priority = DMA_PRIORITY_MEDIUM,
+    };
+
+    if ((NULL == Config) || (NULL == DataBuffer))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) || (0 == BufferSize))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_TX_IDLE != USART_Context[Config->USART_Number].TxState)
+    {
+        /* Another Transmission is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        Local_Channel = USART_DMA_TX_CHANNEL[Config->USART_Number];
+
+        /* Reserve The Channel , it is Released Again When The Transfer Ends */
+        Local_u8ErrorStatus = DMA_ClaimChannel(Local_Channel);
+
+        if (DMA_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = USART_OK;
+
+            Local_DMAConfig.Channel = Local_Channel;
+            DMA_Init(&Local_DMAConfig);
+
+            DMA_SetCallBack(Local_Channel, DMA_IT_TC, USART_DMA_TxComplete);
+            DMA_SetCallBack(Local_Channel, DMA_IT_TE, USART_DMA_TxError);
+
+            /* Setting Call Back Function */
+            USART_Context[Config->USART_Number].TxDMACallBack = pv_CallBackFunc;
+
+            /* Set Transmit State */
+            USART_Context[Config->USART_Number].TxState = USART_TX_DMA;
+
+            /* Clear Transmission Complete Flag So it Reflects This Transfer Only ( rc_w0 , Other Flags Are Left Untouched By Writing 1 ) */
+            USART[Config->USART_Number]->SR = (uint16_t)(~(1 << USART_TRANSMISSION_COMP));
+
+            /* Enable DMA Transmitter , Unless The Peer Sent XOFF , Then XON Enables it ( CR3 is Also Written By The ISR ) */
+            Local_u32PriMask = USART_EnterCritical();
+
+            if (!USART_Context[Config->USART_Number].TxPaused)
+            {
+                USART[Config->USART_Number]->CR3 |= (1 << DMAT);
+            }
+
+            USART_ExitCritical(Local_u32PriMask);
+
+            DMA_StartTransfer(Local_Channel, (uint32_t)&USART[Config->USART_Number]->DR, (uint32_t)DataBuffer, BufferSize);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Receive Continuously Into a Circular Buffer Using a USART Peripheral Through DMA ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveCircular_DMA
+ * @param  : Config             => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : ReceiveBuffer      => This Parameter is Used to Pass The Circular Buffer Filled By DMA
+ * @param  : BufferSize         => This Parameter is Used to Pass The Size of The Circular Buffer in Bytes
+ * @param  : pv_HalfCallBackFunc => This Parameter is Used to Pass The CallBack Invoked When The First Half is Filled ( May Be NULL )
+ * @param  : pv_FullCallBackFunc => This Parameter is Used to Pass The CallBack Invoked When The Second Half is Filled ( May Be NULL )
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The USART RX DMA Channel is Used By Another Driver
+ * @note   : DMA1 Clock Must Be Enabled & The Channel IRQ Enabled in NVIC ( USART1 => CH5 , USART2 => CH6 , USART3 => CH3 )
+ *           Reception Runs Until USART_StopReceive_DMA is Called , The CPU is Not Involved Per Byte
+ */
+ERRORS_t USART_ReceiveCircular_DMA(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize,
+                                   void (*pv_HalfCallBackFunc)(void), void (*pv_FullCallBackFunc)(void))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    DMA_Channel_t Local_Channel = DMA_CHANNEL_1;
+
+    DMA_Config_t Local_DMAConfig = {
+        .Direction = DMA_PERIPH_TO_MEM,
+        .Mode = DMA_CIRCULAR_MODE,
+        .PeriphSize = DMA_SIZE_8_BITS,
+        .MemSize = DMA_SIZE_8_BITS,
+        .PeriphIncrement = DMA_INC_DIS,
+        .MemIncrement = DMA_INC_EN,
+        .Priority = DMA_PRIORITY_HIGH,
+    };
+
+    if ((NULL == Config) || (NULL == ReceiveBuffer))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) || (BufferSize < 2))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+    {
+        /* Another Reception is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        Local_Channel = USART_DMA_RX_CHANNEL[Config->USART_Number];
+
+        Local_u8ErrorStatus = DMA_ClaimChannel(Local_Channel);
+
+        if (DMA_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = USART_OK;
+
+            Local_DMAConfig.Channel = Local_Channel;
+            DMA_Init(&Local_DMAConfig);
+
+            /* Setting Call Back Functions */
+            USART_Context[Config->USART_Number].RxHalfCallBack = pv_HalfCallBackFunc;
+            USART_Context[Config->USART_Number].RxFullCallBack = pv_FullCallBackFunc;
+            USART_Context[Config->USART_Number].RxSize = BufferSize;
+
+            DMA_SetCallBack(Local_Channel, DMA_IT_HT, (NULL != pv_HalfCallBackFunc) ? USART_DMA_RxHalfComplete : NULL);
+            DMA_SetCallBack(Local_Channel, DMA_IT_TC, (NULL != pv_FullCallBackFunc) ? USART_DMA_RxComplete : NULL);
+            DMA_SetCallBack(Local_Channel, DMA_IT_TE, USART_DMA_RxError);
+
+            /* Set Receive State */
+            USART_Context[Config->USART_Number].RxState = USART_RX_CIRCULAR_DMA;
+
+            /* Enable DMA Receiver */
+            USART[Config->USART_Number]->CR3 |= (1 << DMAR);
+
+            DMA_StartTransfer(Local_Channel, (uint32_t)&USART[Config->USART_Number]->DR, (uint32_t)ReceiveBuffer, BufferSize);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop DMA Reception on a USART Peripheral & Release its DMA Channel
+ * @fn     : USART_StopReceive_DMA
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceive_DMA(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL != Config) && (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config)))
+    {
+        if (USART_RX_CIRCULAR_DMA == USART_Context[Config->USART_Number].RxState)
+        {
+            /* Disable DMA Receiver */
+            USART[Config->USART_Number]->CR3 &= (~(1 << DMAR));
+
+            DMA_ReleaseChannel(USART_DMA_RX_CHANNEL[Config->USART_Number]);
+
+            /* Clear Receive State */
+            USART_Context[Config->USART_Number].RxState = USART_RX_IDLE;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Get The Index in The Circular Buffer Where DMA Will Write The Next Received Byte
+ * @fn     : USART_GetReceivePosition_DMA
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Position => This Parameter is Used to Return The Write Index ( 0 to BufferSize - 1 )
+ * @return : ERRORS_t => USART_NOK if No Circular DMA Reception is Running on The Peripheral
+ */
+ERRORS_t USART_GetReceivePosition_DMA(USART_t USARTNum, uint16_t *Position)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint16_t Local_u16Remaining = 0;
+
+    if (USARTNum < USART_PERIPH_1 || USARTNum > USART_PERIPH_3)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (NULL == Position)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_RX_CIRCULAR_DMA != USART_Context[USARTNum].RxState)
+    {
+        /* No Circular Reception Running , RxSize May Still Be 0 */
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        DMA_GetRemaining(USART_DMA_RX_CHANNEL[USARTNum], &Local_u16Remaining);
+
+        /* CNDTR Counts Down From BufferSize & Reloads in Circular Mode */
+        *Position = (uint16_t)((USART_Context[USARTNum].RxSize - Local_u16Remaining) % USART_Context[USARTNum].RxSize);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Receive Variable Length Frames Separated By an Idle Line Using a USART Peripheral ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveToIdle_IT
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : ReceiveBuffer   => This Parameter is Used to Pass The Buffer Each Frame is Received inside it
+ * @param  : BufferSize      => This Parameter is Used to Pass The Size of The Buffer ( Maximum Frame Length )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With The Frame Length Once The Line Goes Idle
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Every Frame Starts at The Beginning of The Buffer , So The CallBack Must Consume The Frame Before Returning
+ *           A Frame Longer Than The Buffer is Delivered in BufferSize Chunks , Reception Stays Armed Until USART_StopReceiveToIdle
+ */
+ERRORS_t USART_ReceiveToIdle_IT(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(uint16_t Length))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL == Config) || (NULL == ReceiveBuffer) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) || (0 == BufferSize))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+    {
+        /* Another Reception is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        /* Disable Receive Interrupts While Setting Up */
+        USART_UpdateCR1(Config->USART_Number, (1 << RXNEIE) | (1 << IDLEIE), 0U);
+
+        /* Setting Frame Buffer Globally */
+        USART_Context[Config->USART_Number].RxBuffer = ReceiveBuffer;
+        USART_Context[Config->USART_Number].RxSize = BufferSize;
+        USART_Context[Config->USART_Number].RxCounter = 0;
+
+        /* Setting Call Back Function */
+        USART_Context[Config->USART_Number].RxIdleCallBack = pv_CallBackFunc;
+
+        /* Set Receive State */
+        USART_Context[Config->USART_Number].RxState = USART_RX_TO_IDLE;
+
+        /* Clear Any Stale IDLE Flag ( Read SR Then DR ) */
+        (void)USART[Config->USART_Number]->SR;
+        (void)USART[Config->USART_Number]->DR;
+
+        /* Enable Receive Data Register Not Empty & IDLE Line Interrupts */
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << RXNEIE) | (1 << IDLEIE));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Receive Variable Length Frames Separated By an Idle Line Using a USART Peripheral Through DMA ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveToIdle_DMA
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : ReceiveBuffer   => This Parameter is Used to Pass The Buffer Each Frame is Received inside it
+ * @param  : BufferSize      => This Parameter is Used to Pass The Size of The Buffer ( Maximum Frame Length )
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With The Frame Length Once The Line Goes Idle
+ * @return : ERRORS_t => DMA_CHANNEL_BUSY if The USART RX DMA Channel is Used By Another Driver
+ * @note   : Only One Interrupt is Raised Per Frame , DMA is Re-Armed at The Beginning of The Buffer For Every Frame
+ *           DMA1 Clock Must Be Enabled & The Channel IRQ Enabled in NVIC ( USART1 => CH5 , USART2 => CH6 , USART3 => CH3 )
+ */
+ERRORS_t USART_ReceiveToIdle_DMA(USART_Config_t *Config, uint8_t *ReceiveBuffer, uint16_t BufferSize, void (*pv_CallBackFunc)(uint16_t Length))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    DMA_Channel_t Local_Channel = DMA_CHANNEL_1;
+
+    DMA_Config_t Local_DMAConfig = {
+        .Direction = DMA_PERIPH_TO_MEM,
+        .Mode = DMA_NORMAL_MODE,
+        .PeriphSize = DMA_SIZE_8_BITS,
+        .MemSize = DMA_SIZE_8_BITS,
+        .PeriphIncrement = DMA_INC_DIS,
+        .MemIncrement = DMA_INC_EN,
+        .Priority = DMA_PRIORITY_HIGH,
+    };
+
+    if ((NULL == Config) || (NULL == ReceiveBuffer) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((USART_WRONG_CONFIGURATION == USART_CheckConfig(Config)) || (0 == BufferSize))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+    {
+        /* Another Reception is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        Local_Channel = USART_DMA_RX_CHANNEL[Config->USART_Number];
+
+        Local_u8ErrorStatus = DMA_ClaimChannel(Local_Channel);
+
+        if (DMA_OK == Local_u8ErrorStatus)
+        {
+            Local_u8ErrorStatus = USART_OK;
+
+            Local_DMAConfig.Channel = Local_Channel;
+            DMA_Init(&Local_DMAConfig);
+
+            /* Buffer Full Before The Line Went Idle is Delivered as a Frame Too */
+            DMA_SetCallBack(Local_Channel, DMA_IT_TC, USART_DMA_RxComplete);
+            DMA_SetCallBack(Local_Channel, DMA_IT_TE, USART_DMA_RxError);
+
+            /* Setting Frame Buffer Globally */
+            USART_Context[Config->USART_Number].RxBuffer = ReceiveBuffer;
+            USART_Context[Config->USART_Number].RxSize = BufferSize;
+
+            /* Setting Call Back Function */
+            USART_Context[Config->USART_Number].RxIdleCallBack = pv_CallBackFunc;
+
+            /* Set Receive State */
+            USART_Context[Config->USART_Number].RxState = USART_RX_TO_IDLE_DMA;
+
+            /* Clear Any Stale IDLE Flag ( Read SR Then DR ) */
+            (void)USART[Config->USART_Number]->SR;
+            (void)USART[Config->USART_Number]->DR;
+
+            /* Enable DMA Receiver */
+            USART[Config->USART_Number]->CR3 |= (1 << DMAR);
+
+            DMA_StartTransfer(Local_Channel, (uint32_t)&USART[Config->USART_Number]->DR, (uint32_t)ReceiveBuffer, BufferSize);
+
+            /* Only IDLE Line Interrupt is Needed , Bytes Are Moved By DMA */
+            USART_UpdateCR1(Config->USART_Number, 0U, (1 << IDLEIE));
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop Receive To Idle Reception ( Interrupt or DMA ) on a USART Peripheral
+ * @fn     : USART_StopReceiveToIdle
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceiveToIdle(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL != Config) && (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config)))
+    {
+        if (USART_RX_TO_IDLE == USART_Context[Config->USART_Number].RxState)
+        {
+            USART_UpdateCR1(Config->USART_Number, (1 << RXNEIE) | (1 << IDLEIE), 0U);
+
+            USART_Context[Config->USART_Number].RxState = USART_RX_IDLE;
+        }
+        else if (USART_RX_TO_IDLE_DMA == USART_Context[Config->USART_Number].RxState)
+        {
+            USART_UpdateCR1(Config->USART_Number, (1 << IDLEIE), 0U);
+            USART[Config->USART_Number]->CR3 &= (~(1 << DMAR));
+
+            DMA_ReleaseChannel(USART_DMA_RX_CHANNEL[Config->USART_Number]);
+
+            USART_Context[Config->USART_Number].RxState = USART_RX_IDLE;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Start Stream Reception , Every Received Byte is Handed to a CallBack From The ISR ( Non-Blocking Mode )
+ * @fn     : USART_ReceiveStream_IT
+ * @param  : Config          => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral to Receive on
+ * @param  : pv_CallBackFunc => This Parameter is Used to Pass The CallBack Invoked With Each Received Byte
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : Meant For Protocol Layers ( e.g. COBS ) That Parse The Stream on The Fly , The CallBack Runs in Interrupt Context So Keep it Short
+ *           Reception Stays Armed Until USART_StopReceiveStream is Called
+ */
+ERRORS_t USART_ReceiveStream_IT(USART_Config_t *Config, void (*pv_CallBackFunc)(uint8_t Data))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL == Config) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (USART_WRONG_CONFIGURATION == USART_CheckConfig(Config))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (USART_RX_IDLE != USART_Context[Config->USART_Number].RxState)
+    {
+        /* Another Reception is Still Running on This Peripheral */
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        /* Disable Receive Data Register Not Empty Interrupt While Setting Up */
+        USART_UpdateCR1(Config->USART_Number, (1 << RXNEIE), 0U);
+
+        /* Strip The Parity Bit The Same Way Continuous Reception Does */
+        if ((USART_PARITY_DIS != Config->ParityMode) && (USART_8_BITS_WIDTH == Config->WordLength))
+        {
+            USART_Context[Config->USART_Number].RxRing.DataMask = USART_CLEAR_PARITY_8_MASK;
+        }
+        else
+        {
+            USART_Context[Config->USART_Number].RxRing.DataMask = USART_CLEAR_PARITY_9_MASK;
+        }
+
+        /* Setting Call Back Function */
+        USART_Context[Config->USART_Number].RxByteCallBack = pv_CallBackFunc;
+
+        /* Set Receive State */
+        USART_Context[Config->USART_Number].RxState = USART_RX_STREAM;
+
+        /* Enable Receive Data Register Not Empty Interrupt */
+        USART_UpdateCR1(Config->USART_Number, 0U, (1 << RXNEIE));
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Stop Stream Reception on a USART Peripheral
+ * @fn     : USART_StopReceiveStream
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct of The USART Peripheral
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+ERRORS_t USART_StopReceiveStream(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL != Config) && (USART_WRONG_CONFIGURATION != USART_CheckConfig(Config)))
+    {
+        if (USART_RX_STREAM == USART_Context[Config->USART_Number].RxState)
+        {
+            /* Disable Receive Data Register Not Empty Interrupt */
+            USART_UpdateCR1(Config->USART_Number, (1 << RXNEIE), 0U);
+
+            /* Clear Receive State */
+            USART_Context[Config->USART_Number].RxState = USART_RX_IDLE;
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Check The Configuration of USART Peripheral
+ *
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Check it
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t USART_CheckConfig(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (Config->Mode < USART_Rx || Config->Mode > USART_Rx_Tx ||
+        Config->USART_Number < USART_PERIPH_1 || Config->USART_Number > USART_PERIPH_3 ||
+        Config->WordLength < USART_8_BITS_WIDTH || Config->WordLength > USART_9_BITS_WIDTH ||
+        Config->ParityMode < USART_PARITY_DIS || Config->ParityMode > USART_PARITY_EN_ODD ||
+        Config->IT_FlagEnable.ParityErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ParityErrorIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.TDataRegEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TDataRegEmptyIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.TransmissionCompleteIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TransmissionCompleteIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.RDataRegNEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.RDataRegNEmptyIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.IDLELineDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.IDLELineDetectedIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.CTSIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.CTSIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.ErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ErrorIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.LINBreakDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.LINBreakDetectedIT > USART_IT_FLAG_EN ||
+        Config->StopBits < USART_ONE_SB || Config->StopBits > USART_ONE_AND_HALF_SB ||
+        Config->HW_FlowControlMode < USART_HW_FLOW_CTRL_DIS || Config->HW_FlowControlMode > USART_SW_FLOW_CTRL_XON_XOFF ||
+        Config->ClockMode < USART_ASYNC_MODE || Config->ClockMode > USART_SYNC_MODE ||
+        Config->ClockPolarity < USART_CLK_IDLE_LOW || Config->ClockPolarity > USART_CLK_IDLE_HIGH ||
+        Config->ClockPhase < USART_CAPTURE_LEADING || Config->ClockPhase > USART_CAPTURE_TRAILING ||
+        Config->LastBitClock < USART_LAST_BIT_CLK_DIS || Config->LastBitClock > USART_LAST_BIT_CLK_EN ||
+        (USART_SYNC_MODE == Config->ClockMode && USART_Rx == Config->Mode) ||
+        (USART_SYNC_MODE == Config->ClockMode && USART_SW_FLOW_CTRL_XON_XOFF == Config->HW_FlowControlMode))
+    {
+        Local_u8ErrorStatus = USART_WRONG_CONFIGURATION;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The BaudRate of USART Peripheral
+ *
+ * @param  : Config => This Parameter is Used to Pass The Configuration Struct to Set The BaudRate
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ * @note   : BRR is Left Unchanged if The BaudRate Can Not Be Generated From The Current Peripheral Clock
+ */
+static ERRORS_t USART_SetBaudRate(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    USART_BaudInfo_t Local_BaudInfo;
+
+    Local_u8ErrorStatus = USART_CalculateBaudRate(Config->USART_Number, Config->BaudRate, &Local_BaudInfo);
+
+    if (USART_OK == Local_u8ErrorStatus)
+    {
+        /* BRR Holds USARTDIV in 1/16 Units , So Mantissa & Fraction Are Written at Once */
+        USART[Config->USART_Number]->BRR = Local_BaudInfo.BRR;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The Parity Mode of USART Peripheral
+ *
+ * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Parity   => This Parameter is Used to Select The Parity Mode to Be Used -> @USART_ParityMode_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t USART_SetParity(USART_t UsartNum, USART_ParityMode_t Parity)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_3 ||
+        Parity < USART_PARITY_DIS || Parity > USART_PARITY_EN_ODD)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        switch (Parity)
+        {
+        case USART_PARITY_DIS:
+            USART[UsartNum]->CR1 &= (~(1 << PCE));
+            break;
+        case USART_PARITY_EN_EVEN:
+            USART[UsartNum]->CR1 |= (1 << PCE);
+            USART[UsartNum]->CR1 &= (~(1 << PS));
+            break;
+        case USART_PARITY_EN_ODD:
+            USART[UsartNum]->CR1 |= (1 << PCE);
+            USART[UsartNum]->CR1 |= (1 << PS);
+            break;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Set The Mode of USART Peripheral
+ *
+ * @param  : UsartNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @param  : Mode     => This Parameter is Used to Select The Mode to Be Used -> @USART_Mode_t
+ * @return : ERRORS_t => This Return Parameter is Used to Indicate The Function Execution If Executed Correctly or NOT
+ */
+static ERRORS_t USART_SetMode(USART_t UsartNum, USART_Mode_t Mode)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (UsartNum < USART_PERIPH_1 || UsartNum > USART_PERIPH_3 ||
+        Mode < USART_Rx || Mode > USART_Rx_Tx)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        switch (Mode)
+        {
+        case USART_Rx:
+            USART[UsartNum]->CR1 &= (~(1 << TE));
+            USART[UsartNum]->CR1 |= (1 << RE);
+            break;
+        case USART_Tx:
+            USART[UsartNum]->CR1 &= (~(1 << RE));
+            USART[UsartNum]->CR1 |= (1 << TE);
+            break;
+        case USART_Rx_Tx:
+            USART[UsartNum]->CR1 |= (1 << TE);
+            USART[UsartNum]->CR1 |= (1 << RE);
+            break;
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+/**
+ * @brief  : This Function is Used to Handle The Interrupts of USART Peripheral
+ * @fn	   : USART_HANDLE_IT
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number to Be Used -> @USART_t
+ * @return : void
+ * @note   : This Function is Used Inside All IRQ Handlers to Handle The Interrupts ( Private Function )
+ */
+static void USART_HANDLE_IT(USART_t USARTNum)
+{
+    USART_FlagStatus_t FlagState = USART_FLAG_RESET;
+
+    /* Line Errors Are Latched in SR Until DR is Read , So Sample Them Before Any Branch Below Reads DR */
+    uint16_t Local_u16SR = USART[USARTNum]->SR;
+    uint16_t Local_u16Errors = Local_u16SR & USART_SR_ERROR_MASK;
+
+    uint16_t Local_u16Data = 0;
+    uint8_t Local_u8DRRead = 0;
+
+    if (Local_u16SR & (1U << USART_LIN_BREAK_DETECT))
+    {
+        /* The Break Character Itself is Received as 0x00 With a Framing Error , it is Not a Line Error */
+        Local_u16Errors &= (~(1U << USART_FRAME_ERROR));
+    }
+
+    if (0U != Local_u16Errors)
+    {
+        if (Local_u16Errors & (1U << USART_PARITY_ERROR))
+        {
+            USART_Context[USARTNum].ErrorStats.ParityErrors++;
+        }
+        if (Local_u16Errors & (1U << USART_FRAME_ERROR))
+        {
+            USART_Context[USARTNum].ErrorStats.FramingErrors++;
+        }
+        if (Local_u16Errors & (1U << USART_NOISE_FLAG))
+        {
+            USART_Context[USARTNum].ErrorStats.NoiseErrors++;
+        }
+        if (Local_u16Errors & (1U << USART_OVERRNUN_ERROR))
+        {
+            USART_Context[USARTNum].ErrorStats.OverrunErrors++;
+        }
+
+        if ((Local_u16Errors & (1U << USART_OVERRNUN_ERROR)) && USART_Context[USARTNum].SyncExchange)
+        {
+            /* A Received Byte of The Exchange is Lost , The Rest Would Land Shifted , End it Here */
+            USART_SyncExchangeEnd(USARTNum, USART_OVERRUN_ERROR);
+        }
+
+        if (USART_Context[USARTNum].RxState == USART_RX_IDLE)
+        {
+            /* No Reception Will Read DR , Read it Here to Finish The SR / DR Clear Sequence
+             * Otherwise ORE Stays Set & The Interrupt Keeps Firing Without Ever Receiving Again */
+            (void)USART[USARTNum]->DR;
+        }
+
+        /* Invoke the Call Back Functions */
+        if ((Local_u16Errors & (1U << USART_PARITY_ERROR)) && USART_Context[USARTNum].CallBack[USART_IT_PE] != NULL)
+        {
+            USART_Context[USARTNum].CallBack[USART_IT_PE]();
+        }
+        if ((Local_u16Errors & (~(1U << USART_PARITY_ERROR))) && USART_Context[USARTNum].CallBack[USART_IT_ERR] != NULL)
+        {
+            USART_Context[USARTNum].CallBack[USART_IT_ERR]();
+        }
+    }
+
+    /* LIN Break Detected , Served Before RXNE So a Reception Started By The CallBack Does Not Get The Break Character */
+    if ((Local_u16SR & (1U << USART_LIN_BREAK_DETECT)) && (USART[USARTNum]->CR2 & (1 << LBDIE)))
+    {
+        /* LBD is rc_w0 , Write Zero to it Only */
+        USART[USARTNum]->SR = (uint16_t)(~(1U << USART_LIN_BREAK_DETECT));
+
+        if (USART[USARTNum]->SR & (1U << USART_RDATA_REG_NEMPTY))
+        {
+            /* Drop The 0x00 Break Character */
+            (void)USART[USARTNum]->DR;
+        }
+
+        /* Invoke the Call Back Function */
+        if (USART_Context[USARTNum].CallBack[USART_IT_LBD] != NULL)
+        {
+            USART_Context[USARTNum].CallBack[USART_IT_LBD]();
+        }
+    }
+
+    /* Read Data Register Not Empty Flag */
+    USART_ReadFlag(USARTNum, USART_RDATA_REG_NEMPTY, &FlagState);
+
+    if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].RxState != USART_RX_IDLE &&
+        USART_Context[USARTNum].RxState != USART_RX_TO_IDLE_DMA && USART_Context[USARTNum].RxState != USART_RX_CIRCULAR_DMA)
+    {
+        /* Every Interrupt Reception Takes its Byte From Here , The DR Read Also Clears IDLE Sampled at The Top */
+        Local_u16Data = USART[USARTNum]->DR;
+        Local_u8DRRead = 1;
+
+        /* XON / XOFF Never Reach The Reception , Whichever is Running ( The Handle Mask is Set By USART_Init For Every Reception ) */
+        if (USART_Context[USARTNum].SwFlowControl &&
+            USART_ReceiveControlChar(USARTNum, (uint8_t)(Local_u16Data & USART_Handle[USARTNum].DataMask)))
+        {
+            FlagState = USART_FLAG_RESET;
+        }
+    }
+    else
+    {
+        /* RXNE Not Set , or Served By DMA */
+        FlagState = USART_FLAG_RESET;
+    }
+
+    if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].RxState == USART_RX_DATA)
+    {
+        /* Clear Receive State */
+
+        USART_Context[USARTNum].RxState = USART_RX_IDLE;
+
         /* Setting Received Data */
-        *USART_ReceivedData[USARTNum] = USART[USARTNum]->DR;
+        *USART_Context[USARTNum].RxData = Local_u16Data;
 
         /* Disable Receive Data Register Not Empty Intterupt */
-        USART[USARTNum]->CR1 &= (~(1 << RXNEIE));
+        USART_UpdateCR1(USARTNum, (1 << RXNEIE), 0U);
+
+        /* Invoke the Call Back Function */
+        if (USART_Context[USARTNum].CallBack[USART_IT_RXNE] != NULL)
+        {
+            USART_Context[USARTNum].CallBack[USART_IT_RXNE]();
+        }
+    }
+    else if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].RxState == USART_RX_BUFFER)
+    {
+        /* Setting Received Data */
+        USART_Context[USARTNum].RxBuffer[USART_Context[USARTNum].RxCounter++] = (uint8_t)Local_u16Data;
+
+        if (USART_Context[USARTNum].SyncExchange && (USART_Context[USARTNum].RxCounter == USART_Context[USARTNum].RxSize))
+        {
+            USART_SyncExchangeEnd(USARTNum, USART_OK);
+        }
+        else if (USART_Context[USARTNum].SyncExchange)
+        {
+            /* A Byte Left The Pipeline , Let The TXE Interrupt Clock The Next One */
+            if (USART_Context[USARTNum].TxCounter < USART_Context[USARTNum].TxSize)
+            {
+                USART_UpdateCR1(USARTNum, 0U, (1 << TXEIE));
+            }
+        }
+        else if (USART_Context[USARTNum].RxCounter == USART_Context[USARTNum].RxSize)
+        {
+            /* Clear Receive State */
+            USART_Context[USARTNum].RxState = USART_RX_IDLE;
+
+            /* Disable Receive Data Register Not Empty Intterupt */
+            USART_UpdateCR1(USARTNum, (1 << RXNEIE), 0U);
+
+            /* Invoke the Call Back Function */
+            if (USART_Context[USARTNum].CallBack[USART_IT_RXNE] != NULL)
+            {
+                USART_Context[USARTNum].CallBack[USART_IT_RXNE]();
+            }
+        }
+    }
+    else if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].RxState == USART_RX_CONTINUOUS)
+    {
+        /* Reading DR Above Clears The Flag Even if The Byte is Dropped */
+        uint8_t Local_u8Data = (uint8_t)(Local_u16Data & USART_Context[USARTNum].RxRing.DataMask);
+
+        uint16_t Local_u16Head = USART_Context[USARTNum].RxRing.Head;
+        uint16_t Local_u16NextHead = (Local_u16Head + 1U) & USART_RX_RING_MASK;
+
+        if (Local_u16NextHead != USART_Context[USARTNum].RxRing.Tail)
+        {
+            /* Store The Byte First Then Publish The New Head */
+            USART_Context[USARTNum].RxRing.Buffer[Local_u16Head] = Local_u8Data;
+            USART_Context[USARTNum].RxRing.Head = Local_u16NextHead;
+
+            /* Throttle The Peer Before The Ring Overflows */
+            if (USART_Context[USARTNum].SwFlowControl && !USART_Context[USARTNum].XoffSent &&
+                (((Local_u16NextHead - USART_Context[USARTNum].RxRing.Tail) & USART_RX_RING_MASK) >= USART_XOFF_HIGH_WATERMARK))
+            {
+                USART_Context[USARTNum].XoffSent = 1;
+
+                USART_SendControlChar(USARTNum, USART_XOFF_CHAR);
+            }
+        }
+        else
+        {
+            /* Ring is Full , Keep The Unread Bytes & Count The Dropped One */
+            USART_Context[USARTNum].RxRing.DroppedBytes++;
+        }
+    }
+    else if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].RxState == USART_RX_TO_IDLE)
+    {
+        USART_Context[USARTNum].RxBuffer[USART_Context[USARTNum].RxCounter++] = (uint8_t)Local_u16Data;
+
+        if (USART_Context[USARTNum].RxCounter == USART_Context[USARTNum].RxSize)
+        {
+            /* Buffer Full Before The Line Went Idle */
+            USART_IdleFrameReceived(USARTNum, USART_Context[USARTNum].RxCounter);
+        }
+    }
+    else if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].RxState == USART_RX_STREAM)
+    {
+        /* Hand The Byte Straight to The Protocol Layer , No Intermediate Buffer */
+        USART_Context[USARTNum].RxByteCallBack((uint8_t)(Local_u16Data & USART_Context[USARTNum].RxRing.DataMask));
+    }
+
+    FlagState = USART_FLAG_RESET;
+
+    /* IDLE Line Detected Flag , Served After RXNE So The Last Byte of The Frame is Already Stored
+     * Taken From The SR Sampled at The Top , a DR Read Above Has Already Cleared it in The Register */
+    if ((Local_u16SR & (1U << USART_IDLE_LINE_DETECT)) && (USART[USARTNum]->CR1 & (1 << IDLEIE)) &&
+        (USART_Context[USARTNum].RxState == USART_RX_TO_IDLE || USART_Context[USARTNum].RxState == USART_RX_TO_IDLE_DMA))
+    {
+        uint16_t Local_u16Remaining = 0;
+
+        if (!Local_u8DRRead)
+        {
+            /* Clear IDLE Flag By Reading DR After The SR Read at The Top , No Byte is Pending Here as The Line is Idle */
+            (void)USART[USARTNum]->DR;
+        }
+
+        if (USART_Context[USARTNum].RxState == USART_RX_TO_IDLE_DMA)
+        {
+            DMA_GetRemaining(USART_DMA_RX_CHANNEL[USARTNum], &Local_u16Remaining);
 
-        /* Invoke the Call Back Function */
-        if (USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE] != NULL)
+            USART_IdleFrameReceived(USARTNum, USART_Context[USARTNum].RxSize - Local_u16Remaining);
+        }
+        else
         {
-            USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE]();
+            USART_IdleFrameReceived(USARTNum, USART_Context[USARTNum].RxCounter);
         }
     }
-    else if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_RECEIVE_BUFFER)
+
+    FlagState = USART_FLAG_RESET;
+
+    /* Transmit Data Register Empty Flag , Only Served While its Interrupt is Enabled As TXE Stays Set When The Line is Idle */
+    USART_ReadFlag(USARTNum, USART_TDATA_REG_EMPTY, &FlagState);
+
+    if (FlagState == USART_FLAG_SET && (USART[USARTNum]->CR1 & (1 << TXEIE)))
     {
-        static uint8_t Local_u8Counter = 0;
+        if (0U != USART_Context[USARTNum].TxControlChar && USART_Context[USARTNum].TxState != USART_TX_DMA)
+        {
+            /* XON / XOFF Jumps Ahead of The Data , TXEIE Stays Enabled So The Next TXE Resumes The Data */
+            USART[USARTNum]->DR = USART_Context[USARTNum].TxControlChar;
+            USART_Context[USARTNum].TxControlChar = 0;
+        }
+        else if (USART_Context[USARTNum].TxState == USART_TX_DATA && !USART_Context[USARTNum].TxPaused &&
+                 USART_Context[USARTNum].TxCounter < USART_Context[USARTNum].TxSize)
+        {
+            /* Send The Single Item , Then Wait For it to Leave The Shift Register */
+            USART[USARTNum]->DR = USART_Context[USARTNum].TxData;
+            USART_Context[USARTNum].TxCounter++;
 
-        /* Setting Received Data */
-        USART_ReceivedBuffer[USARTNum][Local_u8Counter++] = USART[USARTNum]->DR;
+            USART_UpdateCR1(USARTNum, (1 << TXEIE), (1 << TRANS_CIE));
+        }
+        else if (USART_Context[USARTNum].TxState == USART_TX_BUFFER && !USART_Context[USARTNum].TxPaused &&
+                 USART_Context[USARTNum].TxCounter < USART_Context[USARTNum].TxSize &&
+                 (!USART_Context[USARTNum].SyncExchange ||
+                  ((uint16_t)(USART_Context[USARTNum].TxCounter - USART_Context[USARTNum].RxCounter) < USART_SYNC_MAX_IN_FLIGHT)))
+        {
+            /* Send Next Data */
+            USART[USARTNum]->DR = USART_Context[USARTNum].TxBuffer[USART_Context[USARTNum].TxCounter++];
 
-        if (Local_u8Counter == USART_ReceivebufferSize[USARTNum])
+            if (USART_Context[USARTNum].SyncExchange)
+            {
+                /* The Receive Side Ends The Exchange , it Re-Enables TXEIE Once The Pipeline Has Room */
+                if (USART_Context[USARTNum].TxCounter == USART_Context[USARTNum].TxSize)
+                {
+                    USART_UpdateCR1(USARTNum, (1 << TXEIE), 0U);
+                }
+            }
+            else if (USART_Context[USARTNum].TxCounter == USART_Context[USARTNum].TxSize)
+            {
+                /* Last Element is Loaded , Wait For it to Leave The Shift Register */
+                USART_UpdateCR1(USARTNum, (1 << TXEIE), (1 << TRANS_CIE));
+            }
+        }
+        else if (USART_Context[USARTNum].TxState == USART_TX_QUEUE && !USART_Context[USARTNum].TxPaused &&
+                 USART_Context[USARTNum].TxQueue.Tail != USART_Context[USARTNum].TxQueue.Head)
         {
-            /* clear IRQ Source */
-            IRQ_SRC[USARTNum] = USART_NO_SRC;
+            uint16_t Local_u16Tail = USART_Context[USARTNum].TxQueue.Tail;
 
-            /* Disable Receive Data Register Not Empty Intterupt */
-            USART[USARTNum]->CR1 &= (~(1 << RXNEIE));
+            /* Send Next Queued Byte */
+            USART[USARTNum]->DR = USART_Context[USARTNum].TxQueue.Buffer[Local_u16Tail];
+            USART_Context[USARTNum].TxQueue.Tail = (Local_u16Tail + 1U) & USART_TX_QUEUE_MASK;
 
-            /* Invoke the Call Back Function */
-            if (USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE] != NULL)
+            if (USART_Context[USARTNum].TxQueue.Tail == USART_Context[USARTNum].TxQueue.Head)
+            {
+                /* Queue Drained , Switch to Transmission Complete For The Final Byte */
+                USART_UpdateCR1(USARTNum, (1 << TXEIE), (1 << TRANS_CIE));
+            }
+        }
+        else
+        {
+            /* Nothing Left to Send , Paused By XOFF Until XON Re-Enables TXEIE , or The Exchange Waits For a Received Byte */
+            USART_UpdateCR1(USARTNum, (1 << TXEIE), 0U);
+
+            if (USART_Context[USARTNum].TxState == USART_TX_QUEUE && !USART_Context[USARTNum].TxPaused)
             {
-                USART_PTR_TO_FUNC[USARTNum][USART_IT_RXNE]();
+                USART_UpdateCR1(USARTNum, 0U, (1 << TRANS_CIE));
             }
         }
     }
@@ -773,42 +2536,490 @@ static void USART_HANDLE_IT(USART_t USARTNum)
     /* Transmission Complete Flag */
     USART_ReadFlag(USARTNum, USART_TRANSMISSION_COMP, &FlagState);
 
-    if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_SEND_BUFFER)
+    if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].TxState == USART_TX_BUFFER && (USART[USARTNum]->CR1 & (1 << TRANS_CIE)))
+    {
+        /* Clear Transmit State */
+        USART_Context[USARTNum].TxState = USART_TX_IDLE;
+
+        /* Disable Transmission Complete Interrupt */
+        USART_UpdateCR1(USARTNum, (1 << TRANS_CIE), 0U);
+
+        /* Invoke Call Back Function */
+        if (USART_Context[USARTNum].CallBack[USART_IT_TC] != NULL)
+        {
+            USART_Context[USARTNum].CallBack[USART_IT_TC]();
+        }
+    }
+    else if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].TxState == USART_TX_DATA && (USART[USARTNum]->CR1 & (1 << TRANS_CIE)))
     {
-        static uint8_t Local_u8counter = 1;
+        /* Clear Transmit State */
+        USART_Context[USARTNum].TxState = USART_TX_IDLE;
 
-        /* Send Next Data */
-        USART[USARTNum]->DR = USART_SentBuffer[USARTNum][Local_u8counter++];
+        /* Disable Transmission Complete Interrupt */
+        USART_UpdateCR1(USARTNum, (1 << TRANS_CIE), 0U);
 
-        if (Local_u8counter == USART_SentbufferSize[USARTNum])
+        /* Invoke Call Back Function */
+        if (USART_Context[USARTNum].CallBack[USART_IT_TC] != NULL)
         {
-            /* Clear IRQ Source */
-            IRQ_SRC[USARTNum] = USART_NO_SRC;
+            USART_Context[USARTNum].CallBack[USART_IT_TC]();
+        }
+    }
+    else if (FlagState == USART_FLAG_SET && USART_Context[USARTNum].TxState == USART_TX_QUEUE && (USART[USARTNum]->CR1 & (1 << TRANS_CIE)))
+    {
+        /* Disable Transmission Complete Interrupt */
+        USART_UpdateCR1(USARTNum, (1 << TRANS_CIE), 0U);
 
-            /* Disable Transmission Complete Interrupt */
-            USART[USARTNum]->CR1 &= (~(1 << TRANS_CIE));
+        if (USART_Context[USARTNum].TxQueue.Tail == USART_Context[USARTNum].TxQueue.Head)
+        {
+            /* Last Queued Byte Has Left The Line */
+            USART_Context[USARTNum].TxState = USART_TX_IDLE;
 
             /* Invoke Call Back Function */
-            if (USART_PTR_TO_FUNC[USARTNum][USART_IT_TC] != NULL)
+            if (USART_Context[USARTNum].CallBack[USART_IT_TC] != NULL)
             {
-                USART_PTR_TO_FUNC[USARTNum][USART_IT_TC]();
+                USART_Context[USARTNum].CallBack[USART_IT_TC]();
             }
         }
+        else if (!USART_Context[USARTNum].TxPaused)
+        {
+            /* USART_Write Queued More Data Meanwhile , Go Back to Streaming */
+            USART_UpdateCR1(USARTNum, 0U, (1 << TXEIE));
+        }
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Find The USART Peripheral Served By a DMA Channel
+ * @fn     : USART_DMA_FindPeriph
+ * @param  : Channel    => This Parameter is Used to Pass The DMA Channel That Raised The Interrupt
+ * @param  : ChannelMap => This Parameter is Used to Pass The TX or RX Channel Table
+ * @return : USART_t => USART_MAX_NUMBER if No USART Uses This Channel
+ */
+static USART_t USART_DMA_FindPeriph(DMA_Channel_t Channel, const DMA_Channel_t *ChannelMap)
+{
+    USART_t Local_USARTNum = USART_PERIPH_1;
+
+    while ((Local_USARTNum < USART_MAX_NUMBER) && (ChannelMap[Local_USARTNum] != Channel))
+    {
+        Local_USARTNum++;
     }
-    else if (FlagState == USART_FLAG_SET && IRQ_SRC[USARTNum] == USART_SEND_DATA)
+    return Local_USARTNum;
+}
+
+/* DMA Has Loaded The Last Byte of USART_SendBuffer_DMA */
+static void USART_DMA_TxComplete(DMA_Channel_t Channel)
+{
+    USART_t Local_USARTNum = USART_DMA_FindPeriph(Channel, USART_DMA_TX_CHANNEL);
+
+    if (Local_USARTNum < USART_MAX_NUMBER)
     {
-        /* Clear IRQ Source */
-        IRQ_SRC[USARTNum] = USART_NO_SRC;
+        /* Disable DMA Transmitter & Give The Channel Back */
+        USART[Local_USARTNum]->CR3 &= (~(1 << DMAT));
+        DMA_ReleaseChannel(Channel);
 
-        /* Disable Transmission Complete Interrupt */
-        USART[USARTNum]->CR1 &= (~(1 << TRANS_CIE));
+        /* Clear Transmit State */
+        USART_Context[Local_USARTNum].TxState = USART_TX_IDLE;
+
+        /* An XON / XOFF Requested During The DMA Transfer Can Go Now */
+        if (0U != USART_Context[Local_USARTNum].TxControlChar)
+        {
+            USART_UpdateCR1(Local_USARTNum, 0U, (1 << TXEIE));
+        }
 
         /* Invoke Call Back Function */
-        if (USART_PTR_TO_FUNC[USARTNum][USART_IT_TC] != NULL)
+        if (USART_Context[Local_USARTNum].TxDMACallBack != NULL)
+        {
+            USART_Context[Local_USARTNum].TxDMACallBack();
+        }
+    }
+}
+
+/* Bus Error During USART_SendBuffer_DMA */
+static void USART_DMA_TxError(DMA_Channel_t Channel)
+{
+    USART_t Local_USARTNum = USART_DMA_FindPeriph(Channel, USART_DMA_TX_CHANNEL);
+
+    if (Local_USARTNum < USART_MAX_NUMBER)
+    {
+        USART[Local_USARTNum]->CR3 &= (~(1 << DMAT));
+        DMA_ReleaseChannel(Channel);
+
+        USART_Context[Local_USARTNum].TxState = USART_TX_IDLE;
+
+        if (0U != USART_Context[Local_USARTNum].TxControlChar)
+        {
+            USART_UpdateCR1(Local_USARTNum, 0U, (1 << TXEIE));
+        }
+
+        if (USART_Context[Local_USARTNum].CallBack[USART_IT_ERR] != NULL)
+        {
+            USART_Context[Local_USARTNum].CallBack[USART_IT_ERR]();
+        }
+    }
+}
+
+/* First Half of The Circular Buffer is Filled */
+static void USART_DMA_RxHalfComplete(DMA_Channel_t Channel)
+{
+    USART_t Local_USARTNum = USART_DMA_FindPeriph(Channel, USART_DMA_RX_CHANNEL);
+
+    if ((Local_USARTNum < USART_MAX_NUMBER) && (USART_Context[Local_USARTNum].RxHalfCallBack != NULL))
+    {
+        USART_Context[Local_USARTNum].RxHalfCallBack();
+    }
+}
+
+/* Second Half of The Circular Buffer is Filled , DMA Wraps to The Start */
+static void USART_DMA_RxComplete(DMA_Channel_t Channel)
+{
+    USART_t Local_USARTNum = USART_DMA_FindPeriph(Channel, USART_DMA_RX_CHANNEL);
+
+    if (Local_USARTNum < USART_MAX_NUMBER)
+    {
+        if (USART_Context[Local_USARTNum].RxState == USART_RX_TO_IDLE_DMA)
+        {
+            /* Frame Filled The Whole Buffer Before The Line Went Idle */
+            USART_IdleFrameReceived(Local_USARTNum, USART_Context[Local_USARTNum].RxSize);
+        }
+        else if (USART_Context[Local_USARTNum].RxFullCallBack != NULL)
+        {
+            USART_Context[Local_USARTNum].RxFullCallBack();
+        }
+    }
+}
+
+/* Bus Error During Circular Reception , Hardware Has Stopped The Channel */
+static void USART_DMA_RxError(DMA_Channel_t Channel)
+{
+    USART_t Local_USARTNum = USART_DMA_FindPeriph(Channel, USART_DMA_RX_CHANNEL);
+
+    if (Local_USARTNum < USART_MAX_NUMBER)
+    {
+        USART[Local_USARTNum]->CR3 &= (~(1 << DMAR));
+        DMA_ReleaseChannel(Channel);
+
+        /* Stop Waiting For IDLE Line if it Was a Receive To Idle Transfer */
+        USART_UpdateCR1(Local_USARTNum, (1 << IDLEIE), 0U);
+
+        USART_Context[Local_USARTNum].RxState = USART_RX_IDLE;
+
+        if (USART_Context[Local_USARTNum].CallBack[USART_IT_ERR] != NULL)
+        {
+            USART_Context[Local_USARTNum].CallBack[USART_IT_ERR]();
+        }
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Clear & Set Bits of CR1 as One Uninterrupted Read Modify Write
+ * @fn     : USART_UpdateCR1
+ * @param  : USARTNum  => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : ClearBits => This Parameter is Used to Pass The CR1 Bits to Be Cleared
+ * @param  : SetBits   => This Parameter is Used to Pass The CR1 Bits to Be Set
+ * @return : void
+ * @note   : The ISR Clears RXNEIE , TXEIE & TCIE in The Same Register , an Interrupt Landing Between The Read & The Write
+ *           Would Have Its Change Overwritten , e.g. RXNEIE Left Set With Nobody Reading DR
+ */
+static void USART_UpdateCR1(USART_t USARTNum, uint16_t ClearBits, uint16_t SetBits)
+{
+    uint32_t Local_u32PriMask = USART_EnterCritical();
+
+    USART[USARTNum]->CR1 = (uint16_t)((USART[USARTNum]->CR1 & (~ClearBits)) | SetBits);
+
+    USART_ExitCritical(Local_u32PriMask);
+}
+
+/**
+ * @brief  : This Function is Used to Deliver a Received Frame & Re-Arm The Receive To Idle Reception
+ * @fn     : USART_IdleFrameReceived
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : Length   => This Parameter is Used to Pass The Number of Bytes in The Received Frame
+ * @return : void
+ */
+static void USART_IdleFrameReceived(USART_t USARTNum, uint16_t Length)
+{
+    if (USART_Context[USARTNum].RxState == USART_RX_TO_IDLE_DMA)
+    {
+        /* Restart DMA at The Beginning of The Buffer , a Byte Arriving Meanwhile Waits in DR Until The Channel is Enabled */
+        DMA_StartTransfer(USART_DMA_RX_CHANNEL[USARTNum], (uint32_t)&USART[USARTNum]->DR,
+                          (uint32_t)USART_Context[USARTNum].RxBuffer, USART_Context[USARTNum].RxSize);
+    }
+    else
+    {
+        USART_Context[USARTNum].RxCounter = 0;
+    }
+
+    /* Invoke Call Back Function */
+    if ((0 != Length) && (USART_Context[USARTNum].RxIdleCallBack != NULL))
+    {
+        USART_Context[USARTNum].RxIdleCallBack(Length);
+    }
+}
+
+/**
+ * @brief  : This Function is Used to End a USART_TransceiveBuffer_IT Exchange & Invoke Its CallBack
+ * @fn     : USART_SyncExchangeEnd
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : Status   => This Parameter is Used to Pass The Result Returned By USART_GetTransceiveStatus
+ * @return : void
+ */
+static void USART_SyncExchangeEnd(USART_t USARTNum, ERRORS_t Status)
+{
+    /* TCIE is Never Enabled By The Exchange , The Bytes Still Clocking Are Waited For By The Next One */
+    USART_UpdateCR1(USARTNum, (1 << RXNEIE) | (1 << TXEIE), 0U);
+
+    /* Clear Transmit & Receive States */
+    USART_Context[USARTNum].TxState = USART_TX_IDLE;
+    USART_Context[USARTNum].RxState = USART_RX_IDLE;
+
+    USART_Context[USARTNum].SyncExchange = 0;
+    USART_Context[USARTNum].SyncStatus = Status;
+
+    /* Invoke the Call Back Function */
+    if (USART_Context[USARTNum].CallBack[USART_IT_RXNE] != NULL)
+    {
+        USART_Context[USARTNum].CallBack[USART_IT_RXNE]();
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Queue an XON / XOFF Character Ahead of Any Pending Data
+ * @fn     : USART_SendControlChar
+ * @param  : USARTNum    => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : ControlChar => This Parameter is Used to Pass USART_XON_CHAR or USART_XOFF_CHAR
+ * @return : void
+ * @note   : The Character is Written By The TXE Interrupt , a Newer Request Replaces One Not Yet Sent
+ */
+static void USART_SendControlChar(USART_t USARTNum, uint8_t ControlChar)
+{
+    USART_Context[USARTNum].TxControlChar = ControlChar;
+
+    /* A Running DMA Transfer Owns DR , Its Completion Enables TXEIE Instead */
+    if (USART_Context[USARTNum].TxState != USART_TX_DMA)
+    {
+        USART_UpdateCR1(USARTNum, 0U, (1 << TXEIE));
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Act on an XON / XOFF Character Received By Any Interrupt Reception
+ * @fn     : USART_ReceiveControlChar
+ * @param  : USARTNum => This Parameter is Used to Select The USART Peripheral Number -> @USART_t
+ * @param  : Data     => This Parameter is Used to Pass The Received Byte , Parity Bit Stripped
+ * @return : uint8_t => 1 if The Byte Was XON or XOFF & is Consumed , 0 if it is Data
+ */
+static uint8_t USART_ReceiveControlChar(USART_t USARTNum, uint8_t Data)
+{
+    uint8_t Local_u8Consumed = 1;
+
+    if (USART_XOFF_CHAR == Data)
+    {
+        /* Peer Asks Us to Stop , Every Transmit Path is Held Starting From The Next Item */
+        USART_Context[USARTNum].TxPaused = 1;
+
+        if (USART_Context[USARTNum].TxState == USART_TX_DMA)
+        {
+            /* The Channel Stays Armed , it Just Gets no More Requests */
+            USART[USARTNum]->CR3 &= (~(1 << DMAT));
+        }
+    }
+    else if (USART_XON_CHAR == Data)
+    {
+        USART_Context[USARTNum].TxPaused = 0;
+
+        if (USART_Context[USARTNum].TxState == USART_TX_DMA)
+        {
+            USART[USARTNum]->CR3 |= (1 << DMAT);
+        }
+        else if (USART_Context[USARTNum].TxState != USART_TX_IDLE)
+        {
+            /* Resume The Interrupt Transmission Where it Stopped */
+            USART_UpdateCR1(USARTNum, 0U, (1 << TXEIE));
+        }
+        else
+        {
+            /* Blocking Transmit Paths Poll TxPaused Themselves */
+        }
+    }
+    else
+    {
+        Local_u8Consumed = 0;
+    }
+    return Local_u8Consumed;
+}
+
+/**
+ * @brief  : This Function is Used to Time Stamp an Edge on The RX Pin During Auto BaudRate Detection
+ * @fn     : USART_AutoBaudEdge
+ * @return : void
+ */
+static void USART_AutoBaudEdge(void)
+{
+    uint32_t Local_u32Now = SYSTICK->SYST_CVR;
+
+    USART_t Local_USARTNum = USART_AutoBaud.Config->USART_Number;
+
+    if ((0U == USART_AutoBaud.EdgeCount) &&
+        (USART_RX_PORT[Local_USARTNum]->IDR & (1UL << USART_RX_EXTI_LINE[Local_USARTNum])))
+    {
+        /* Line Went Back High , Not a Start Bit */
+    }
+    else
+    {
+        USART_AutoBaud.EdgeTime[USART_AutoBaud.EdgeCount++] = Local_u32Now;
+
+        if (USART_AUTOBAUD_EDGES == USART_AutoBaud.EdgeCount)
+        {
+            USART_AutoBaudEvaluate();
+        }
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Check The Captured Edges , Program BRR & Finish Auto BaudRate Detection
+ * @fn     : USART_AutoBaudEvaluate
+ * @return : void
+ */
+static void USART_AutoBaudEvaluate(void)
+{
+    uint32_t Local_u32Total = (USART_AutoBaud.EdgeTime[0] - USART_AutoBaud.EdgeTime[USART_AUTOBAUD_EDGES - 1U]) & USART_SYSTICK_MAX_RELOAD;
+    uint32_t Local_u32Interval = 0;
+    uint32_t Local_u32Deviation = 0;
+    uint32_t Local_u32BaudRate = 0;
+    int64_t Local_s64ErrorPPM = 0;
+    uint8_t Local_u8Valid = (0U != Local_u32Total);
+    uint8_t Local_u8Counter = 0;
+
+    void (*Local_pvCallBack)(uint32_t) = USART_AutoBaud.CallBack;
+
+    /* Every Bit Must Be Close to The Average , Otherwise it Was Not a 0x55 Byte or an Edge Was Missed */
+    for (Local_u8Counter = 0; (Local_u8Counter < (USART_AUTOBAUD_EDGES - 1U)) && Local_u8Valid; Local_u8Counter++)
+    {
+        Local_u32Interval = (USART_AutoBaud.EdgeTime[Local_u8Counter] - USART_AutoBaud.EdgeTime[Local_u8Counter + 1U]) & USART_SYSTICK_MAX_RELOAD;
+
+        Local_u32Deviation = (Local_u32Interval * USART_AUTOBAUD_SYNC_BITS > Local_u32Total) ? (Local_u32Interval * USART_AUTOBAUD_SYNC_BITS - Local_u32Total)
+                                                                                               : (Local_u32Total - Local_u32Interval * USART_AUTOBAUD_SYNC_BITS);
+
+        Local_u8Valid = ((uint64_t)Local_u32Deviation * 100U <= (uint64_t)Local_u32Total * USART_AUTOBAUD_BIT_TOLERANCE_PCT);
+    }
+
+    if (Local_u8Valid)
+    {
+        /* Both End Edges Carry The Same Interrupt Latency , So it Cancels Out of The Difference */
+        Local_u32BaudRate = (uint32_t)((((uint64_t)RCC_u32GetHCLKFreq() * USART_AUTOBAUD_SYNC_BITS) + (Local_u32Total / 2U)) / Local_u32Total);
+
+        for (Local_u8Counter = 0; Local_u8Counter < (sizeof(USART_STANDARD_BAUDRATES) / sizeof(USART_STANDARD_BAUDRATES[0])); Local_u8Counter++)
+        {
+            Local_s64ErrorPPM = (((int64_t)Local_u32BaudRate - (int64_t)USART_STANDARD_BAUDRATES[Local_u8Counter]) * 1000000LL) /
+                                (int64_t)USART_STANDARD_BAUDRATES[Local_u8Counter];
+
+            if ((Local_s64ErrorPPM <= USART_AUTOBAUD_SNAP_TOLERANCE_PPM) && (Local_s64ErrorPPM >= -USART_AUTOBAUD_SNAP_TOLERANCE_PPM))
+            {
+                Local_u32BaudRate = USART_STANDARD_BAUDRATES[Local_u8Counter];
+                break;
+            }
+        }
+
+        /* Faster Edges Than EXTI Can Time Are Missed , Such a Measurement Can Not Be Trusted */
+        Local_u8Valid = (Local_u32BaudRate <= USART_AUTOBAUD_MAX_BAUDRATE);
+    }
+
+    if (Local_u8Valid)
+    {
+        USART_AutoBaud.Config->BaudRate = Local_u32BaudRate;
+
+        /* A Rate The Peripheral Clock Can Not Generate is Treated as a Bad Measurement */
+        Local_u8Valid = (USART_OK == USART_SetBaudRate(USART_AutoBaud.Config));
+    }
+
+    if (Local_u8Valid)
+    {
+        USART_AutoBaudRelease();
+
+        if (NULL != Local_pvCallBack)
+        {
+            Local_pvCallBack(Local_u32BaudRate);
+        }
+    }
+    else
+    {
+        /* Wait For The Next Start Bit */
+        USART_AutoBaud.EdgeCount = 0;
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Release The EXTI Line & SysTick Borrowed By Auto BaudRate Detection
+ * @fn     : USART_AutoBaudRelease
+ * @return : void
+ */
+static void USART_AutoBaudRelease(void)
+{
+    USART_t Local_USARTNum = USART_AutoBaud.Config->USART_Number;
+
+    uint32_t Local_u32PriMask = 0;
+
+    MEXTI_eDisableEXTILine(USART_RX_EXTI_LINE[Local_USARTNum]);
+
+    Local_u32PriMask = USART_EnterCritical();
+
+    SYSTICK->SYST_CSR = 0;
+    SYSTICK->SYST_CVR = 0;
+
+    if ((0U != (USART_AutoBaud.SavedCSR & (1UL << CSR_ENABLE))) && (0U != USART_AutoBaud.SavedCVR))
+    {
+        /* CVR Can Only Be Cleared , So The Count Left in The Interrupted Period is Loaded Through RVR ,
+           The Owner's Reload Value is Put Back as Soon as The Counter Has Taken it */
+        SYSTICK->SYST_RVR = USART_AutoBaud.SavedCVR;
+        SYSTICK->SYST_CSR = USART_AutoBaud.SavedCSR;
+
+        while (0U == SYSTICK->SYST_CVR)
+        {
+        }
+    }
+
+    SYSTICK->SYST_RVR = USART_AutoBaud.SavedRVR;
+    SYSTICK->SYST_CSR = USART_AutoBaud.SavedCSR;
+
+    SYSTICK_vSetOverride(NULL);
+
+    USART_ExitCritical(Local_u32PriMask);
+
+    /* Drop Anything Latched Before The Receiver Was Switched Off ( Read SR Then DR ) */
+    (void)USART[Local_USARTNum]->SR;
+    (void)USART[Local_USARTNum]->DR;
+
+    USART_UpdateCR1(Local_USARTNum, 0U, (1 << RE));
+
+    USART_AutoBaud.Config = NULL;
+}
+
+/**
+ * @brief  : This Function is Used to Count SysTick Wraps During Auto BaudRate Detection & End it Once The Timeout Elapsed
+ * @fn     : USART_AutoBaudTick
+ * @return : void
+ */
+static void USART_AutoBaudTick(void)
+{
+    void (*Local_pvCallBack)(uint32_t) = USART_AutoBaud.CallBack;
+
+    if (NULL == USART_AutoBaud.Config)
+    {
+        /* Detection Already Ended */
+    }
+    else if (++USART_AutoBaud.Wraps >= USART_AutoBaud.TimeoutWraps)
+    {
+        USART_AutoBaudRelease();
+
+        if (NULL != Local_pvCallBack)
         {
-            USART_PTR_TO_FUNC[USARTNum][USART_IT_TC]();
+            Local_pvCallBack(0U);
         }
     }
+    else
+    {
+        /* Keep Waiting For The Sync Byte */
+    }
 }
 
 /*==============================================================================================================================================
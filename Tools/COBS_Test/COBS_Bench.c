@@ -0,0 +1,156 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_Bench.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Throughput Benchmark For HAL/COBS
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o cobs_bench COBS_Bench.c COBS_UsartStub.c ../../HAL/COBS/Src/COBS_Program.c
+ * Use   : ./cobs_bench [Frames]        ( Default 200000 Frames Per Payload Size )
+ *
+ * Times COBS_EncodeFrame & The Byte By Byte Decoder ( Fed as The USART ISR Would ) For Small , Medium & Full Block Payloads
+ * The Host Figures Are For Comparing Changes to The Codec , Not Target Numbers ; Scale By The Clock Ratio For a Rough Idea
+ ******************************************************************************
+ */
+
+/* clock_gettime & CLOCK_MONOTONIC Are POSIX , Not Part of -std=c99 */
+#define _POSIX_C_SOURCE 199309L
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../../HAL/COBS/Inc/COBS_Interface.h"
+
+#include "COBS_UsartStub.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+#define BENCH_DEFAULT_FRAMES 200000UL
+
+/* Distinct Payloads Cycled Through So The Data is Not Always The Same */
+#define BENCH_PAYLOADS 64U
+
+static USART_Config_t BENCH_UsartConfig = {0};
+
+static uint8_t BENCH_PacketBuffer[COBS_MAX_PAYLOAD + COBS_CRC_SIZE];
+
+static volatile uint32_t BENCH_Packets = 0;
+
+static uint8_t BENCH_Payloads[BENCH_PAYLOADS][COBS_MAX_PAYLOAD];
+static uint8_t BENCH_Frames[BENCH_PAYLOADS][COBS_FRAME_SIZE(COBS_MAX_PAYLOAD)];
+static uint16_t BENCH_FrameSizes[BENCH_PAYLOADS];
+
+static void BENCH_CallBack(uint8_t *Packet, uint16_t Size)
+{
+    (void)Packet;
+    (void)Size;
+
+    BENCH_Packets++;
+}
+
+static double BENCH_Now(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+
+    return ((double)Local_Time.tv_sec * 1e9) + (double)Local_Time.tv_nsec;
+}
+
+static void BENCH_Run(uint16_t PayloadSize, uint32_t Frames)
+{
+    uint8_t Local_au8Frame[COBS_FRAME_SIZE(COBS_MAX_PAYLOAD)];
+    uint16_t Local_u16FrameSize = 0;
+    uint32_t Local_u32Counter = 0;
+    uint32_t Local_u32Index = 0;
+    uint64_t Local_u64FrameBytes = 0;
+    double Local_Start = 0;
+    double Local_EncodeNs = 0;
+    double Local_DecodeNs = 0;
+
+    /* Random Data With About One Zero in 256 Bytes , Encoded Once For The Decode Run */
+    for (Local_u32Index = 0; Local_u32Index < BENCH_PAYLOADS; Local_u32Index++)
+    {
+        for (Local_u32Counter = 0; Local_u32Counter < PayloadSize; Local_u32Counter++)
+        {
+            BENCH_Payloads[Local_u32Index][Local_u32Counter] = (uint8_t)rand();
+        }
+
+        memcpy(&BENCH_Frames[Local_u32Index][COBS_PAYLOAD_OFFSET], BENCH_Payloads[Local_u32Index], PayloadSize);
+        COBS_EncodeFrame(BENCH_Frames[Local_u32Index], PayloadSize, &BENCH_FrameSizes[Local_u32Index]);
+    }
+
+    Local_Start = BENCH_Now();
+
+    for (Local_u32Counter = 0; Local_u32Counter < Frames; Local_u32Counter++)
+    {
+        /* The Payload Copy Stands in For The Application Filling The Frame Buffer */
+        memcpy(&Local_au8Frame[COBS_PAYLOAD_OFFSET], BENCH_Payloads[Local_u32Counter % BENCH_PAYLOADS], PayloadSize);
+        COBS_EncodeFrame(Local_au8Frame, PayloadSize, &Local_u16FrameSize);
+    }
+
+    Local_EncodeNs = BENCH_Now() - Local_Start;
+
+    BENCH_Packets = 0;
+    Local_Start = BENCH_Now();
+
+    for (Local_u32Counter = 0; Local_u32Counter < Frames; Local_u32Counter++)
+    {
+        Local_u32Index = Local_u32Counter % BENCH_PAYLOADS;
+
+        STUB_Receive(BENCH_Frames[Local_u32Index], BENCH_FrameSizes[Local_u32Index]);
+
+        Local_u64FrameBytes += BENCH_FrameSizes[Local_u32Index];
+    }
+
+    Local_DecodeNs = BENCH_Now() - Local_Start;
+
+    printf("%7u | %10.2f %9.1f | %10.2f %9.1f | %s\n", PayloadSize,
+           Local_EncodeNs / ((double)Frames * PayloadSize), ((double)Frames * PayloadSize * 1e3) / Local_EncodeNs,
+           Local_DecodeNs / (double)Local_u64FrameBytes, ((double)Local_u64FrameBytes * 1e3) / Local_DecodeNs,
+           (BENCH_Packets == Frames) ? "OK" : "LOST PACKETS");
+}
+
+int main(int argc, char *argv[])
+{
+    static const uint16_t Local_au16Sizes[] = {8U, 32U, 128U, COBS_MAX_PAYLOAD};
+
+    uint32_t Local_u32Frames = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_FRAMES;
+    uint32_t Local_u32Counter = 0;
+    static const uint8_t Local_au8Delimiter[1] = {0x00U};
+
+    srand(1);
+
+    COBS_StartReceive(&BENCH_UsartConfig, BENCH_PacketBuffer, sizeof(BENCH_PacketBuffer), BENCH_CallBack);
+    STUB_Receive(Local_au8Delimiter, 1U);
+
+    printf("COBS_CRC_ENABLE = %u , %u Frames Per Size\n", (unsigned)COBS_CRC_ENABLE, Local_u32Frames);
+    printf("Payload |     Encode ns/B    MB/s |     Decode ns/B    MB/s |\n");
+
+    for (Local_u32Counter = 0; Local_u32Counter < (sizeof(Local_au16Sizes) / sizeof(Local_au16Sizes[0])); Local_u32Counter++)
+    {
+        BENCH_Run(Local_au16Sizes[Local_u32Counter], Local_u32Frames);
+    }
+
+    return 0;
+}
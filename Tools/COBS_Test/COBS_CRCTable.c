@@ -0,0 +1,86 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_CRCTable.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Generator of The CRC-16/CCITT-FALSE Nibble Table in HAL/COBS
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o cobs_crctable COBS_CRCTable.c
+ * Use   : ./cobs_crctable        ( Prints COBS_CRCNibbleTable , Paste it Into COBS_Program.c )
+ *
+ * Entry N is The CRC Register After Shifting The Nibble N Through it From The Top , Bit By Bit With Poly 0x1021
+ * The Table is Then Checked Against a Bitwise CRC on The Standard Check Input "123456789" ( 0x29B1 )
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/* Must Match COBS_Private.h */
+#define CRC_POLY  0x1021U
+#define CRC_INIT  0xFFFFU
+#define CRC_CHECK 0x29B1U
+
+static uint16_t CRC_Table[16];
+
+static uint16_t CRC_Nibble(uint16_t Crc, uint8_t Nibble)
+{
+    return (uint16_t)((Crc << 4) ^ CRC_Table[(Crc >> 12) ^ (Nibble & 0x0FU)]);
+}
+
+int main(void)
+{
+    static const uint8_t Local_au8Check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    uint16_t Local_u16Crc = 0;
+    uint8_t Local_u8Nibble = 0;
+    uint8_t Local_u8Bit = 0;
+    uint8_t Local_u8Counter = 0;
+
+    for (Local_u8Nibble = 0; Local_u8Nibble < 16U; Local_u8Nibble++)
+    {
+        Local_u16Crc = (uint16_t)(Local_u8Nibble << 12);
+
+        for (Local_u8Bit = 0; Local_u8Bit < 4U; Local_u8Bit++)
+        {
+            Local_u16Crc = (Local_u16Crc & 0x8000U) ? (uint16_t)((Local_u16Crc << 1) ^ CRC_POLY) : (uint16_t)(Local_u16Crc << 1);
+        }
+
+        CRC_Table[Local_u8Nibble] = Local_u16Crc;
+    }
+
+    Local_u16Crc = CRC_INIT;
+
+    for (Local_u8Counter = 0; Local_u8Counter < sizeof(Local_au8Check); Local_u8Counter++)
+    {
+        Local_u16Crc = CRC_Nibble(Local_u16Crc, Local_au8Check[Local_u8Counter] >> 4);
+        Local_u16Crc = CRC_Nibble(Local_u16Crc, Local_au8Check[Local_u8Counter]);
+    }
+
+    printf("static const uint16_t COBS_CRCNibbleTable[16] = {\n");
+
+    for (Local_u8Nibble = 0; Local_u8Nibble < 16U; Local_u8Nibble++)
+    {
+        printf("%s0x%04XU%s", (0U == (Local_u8Nibble % 8U)) ? "    " : " ", CRC_Table[Local_u8Nibble],
+               (15U == Local_u8Nibble) ? "};\n" : ((7U == (Local_u8Nibble % 8U)) ? ",\n" : ","));
+    }
+
+    fprintf(stderr, "Check \"123456789\" => 0x%04X ( Expected 0x%04X ) %s\n", Local_u16Crc, CRC_CHECK,
+            (CRC_CHECK == Local_u16Crc) ? "OK" : "MISMATCH");
+
+    return (CRC_CHECK == Local_u16Crc) ? 0 : 1;
+}
@@ -0,0 +1,483 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_Test.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Test Vectors For HAL/COBS
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o cobs_test COBS_Test.c COBS_UsartStub.c ../../HAL/COBS/Src/COBS_Program.c
+ * Use   : ./cobs_test        ( Exit Status 0 When Every Vector Passes )
+ *
+ * Checked :
+ *   - Fixed Encoder Vectors , Including The CRC-16/CCITT-FALSE Check Value of "123456789" ( 0x29B1 )
+ *   - COBS_EncodeFrame Against a Reference Encoder For Every Payload Length & Several Zero Patterns
+ *   - Decoding of Every Encoded Frame Back to The Same Payload
+ *   - Frames From Other Senders Spanning Several Blocks , Around The 254 / 255 Byte Block Boundary
+ *   - Corrupted CRC , Truncated , Too Short & Oversized Frames , Resync & Delimiter Padding
+ *
+ * The Reference Encoder & CRC Below Are Plain Bitwise Versions , Independent of The Code Under Test
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "../../HAL/COBS/Inc/COBS_Interface.h"
+
+#include "COBS_UsartStub.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/* Longest Frame From Another Sender Used in The Multi Block Vectors */
+#define TEST_MAX_PACKET 600U
+
+#define TEST_CHECK(COND, ...)          \
+    do                                 \
+    {                                  \
+        TEST_Checks++;                 \
+        if (!(COND))                   \
+        {                              \
+            TEST_Failures++;           \
+            printf("FAIL : ");         \
+            printf(__VA_ARGS__);       \
+            printf("\n");              \
+        }                              \
+    } while (0)
+
+static uint32_t TEST_Checks = 0;
+static uint32_t TEST_Failures = 0;
+
+static USART_Config_t TEST_UsartConfig = {0};
+
+static uint8_t TEST_PacketBuffer[TEST_MAX_PACKET + COBS_CRC_SIZE];
+
+/* Last Packet Handed to The CallBack */
+static uint8_t TEST_Received[TEST_MAX_PACKET];
+static uint16_t TEST_ReceivedSize = 0;
+static uint32_t TEST_ReceivedCount = 0;
+
+/*==============================================================================================================================================
+ * REFERENCE IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+#if (COBS_CRC_ENABLE == 1U)
+static uint16_t REF_Crc(const uint8_t *Data, uint32_t Size)
+{
+    uint16_t Local_u16Crc = 0xFFFFU;
+    uint32_t Local_u32Counter = 0;
+    uint8_t Local_u8Bit = 0;
+
+    for (Local_u32Counter = 0; Local_u32Counter < Size; Local_u32Counter++)
+    {
+        Local_u16Crc ^= (uint16_t)(Data[Local_u32Counter] << 8);
+
+        for (Local_u8Bit = 0; Local_u8Bit < 8U; Local_u8Bit++)
+        {
+            Local_u16Crc = (Local_u16Crc & 0x8000U) ? (uint16_t)((Local_u16Crc << 1) ^ 0x1021U) : (uint16_t)(Local_u16Crc << 1);
+        }
+    }
+    return Local_u16Crc;
+}
+#endif
+
+/**
+ * @brief  : Encodes Payload + CRC ( When Enabled ) Into Frame , Any Length , Returns The Frame Size Delimiter Included
+ * @note   : TrailingBlock => 1 Emits The Optional Empty Block Some Senders Add After a Full 254 Byte Block at The End
+ */
+static uint32_t REF_Encode(const uint8_t *Payload, uint32_t Size, uint16_t CrcXor, uint8_t TrailingBlock, uint8_t *Frame)
+{
+    uint8_t Local_au8Data[TEST_MAX_PACKET + 2U];
+    uint32_t Local_u32DataSize = Size;
+    uint32_t Local_u32Counter = 0;
+    uint32_t Local_u32Out = 1;
+    uint32_t Local_u32CodeIndex = 0;
+    uint8_t Local_u8Code = 1;
+
+    memcpy(Local_au8Data, Payload, Size);
+
+#if (COBS_CRC_ENABLE == 1U)
+    {
+        uint16_t Local_u16Crc = REF_Crc(Payload, Size) ^ CrcXor;
+
+        Local_au8Data[Local_u32DataSize++] = (uint8_t)(Local_u16Crc >> 8);
+        Local_au8Data[Local_u32DataSize++] = (uint8_t)Local_u16Crc;
+    }
+#else
+    (void)CrcXor;
+#endif
+
+    for (Local_u32Counter = 0; Local_u32Counter < Local_u32DataSize; Local_u32Counter++)
+    {
+        if (0U == Local_au8Data[Local_u32Counter])
+        {
+            Frame[Local_u32CodeIndex] = Local_u8Code;
+            Local_u32CodeIndex = Local_u32Out++;
+            Local_u8Code = 1;
+        }
+        else
+        {
+            Frame[Local_u32Out++] = Local_au8Data[Local_u32Counter];
+            Local_u8Code++;
+
+            if ((0xFFU == Local_u8Code) && (TrailingBlock || (Local_u32Counter + 1U < Local_u32DataSize)))
+            {
+                Frame[Local_u32CodeIndex] = Local_u8Code;
+                Local_u32CodeIndex = Local_u32Out++;
+                Local_u8Code = 1;
+            }
+        }
+    }
+
+    Frame[Local_u32CodeIndex] = Local_u8Code;
+    Frame[Local_u32Out++] = 0x00U;
+
+    return Local_u32Out;
+}
+
+/*==============================================================================================================================================
+ * HELPERS
+ *==============================================================================================================================================*/
+
+static void TEST_CallBack(uint8_t *Packet, uint16_t Size)
+{
+    memcpy(TEST_Received, Packet, Size);
+    TEST_ReceivedSize = Size;
+    TEST_ReceivedCount++;
+}
+
+static void TEST_Start(uint16_t BufferSize)
+{
+    static const uint8_t Local_au8Delimiter[1] = {0x00U};
+
+    COBS_StopReceive();
+    COBS_StartReceive(&TEST_UsartConfig, TEST_PacketBuffer, BufferSize, TEST_CallBack);
+
+    /* The Receiver Starts Out of Sync */
+    STUB_Receive(Local_au8Delimiter, 1U);
+}
+
+/* Payload Patterns Covering No Zeros , All Zeros & Zeros at Block Edges */
+static void TEST_Fill(uint8_t *Payload, uint32_t Size, uint32_t Pattern)
+{
+    uint32_t Local_u32Counter = 0;
+    uint32_t Local_u32Seed = 0x12345678UL + Pattern;
+
+    for (Local_u32Counter = 0; Local_u32Counter < Size; Local_u32Counter++)
+    {
+        switch (Pattern)
+        {
+        case 0:
+            Payload[Local_u32Counter] = (uint8_t)((Local_u32Counter % 255U) + 1U);
+            break;
+        case 1:
+            Payload[Local_u32Counter] = 0x00U;
+            break;
+        case 2:
+            Payload[Local_u32Counter] = (0U == (Local_u32Counter % 7U)) ? 0x00U : 0xA5U;
+            break;
+        default:
+            Local_u32Seed = (Local_u32Seed * 1103515245UL) + 12345UL;
+            Payload[Local_u32Counter] = (uint8_t)(Local_u32Seed >> 16);
+            break;
+        }
+    }
+}
+
+/*==============================================================================================================================================
+ * TEST CASES
+ *==============================================================================================================================================*/
+
+static void TEST_FixedVectors(void)
+{
+    static const struct
+    {
+        uint8_t Payload[16];
+        uint16_t PayloadSize;
+        uint8_t Frame[24];
+        uint16_t FrameSize;
+    } Local_Vectors[] = {
+#if (COBS_CRC_ENABLE == 1U)
+        {{0x11, 0x22, 0x00, 0x33}, 4, {0x03, 0x11, 0x22, 0x04, 0x33, 0x07, 0x45, 0x00}, 8},
+        {{0x00}, 1, {0x01, 0x03, 0xE1, 0xF0, 0x00}, 5},
+        {{0x00, 0x00}, 2, {0x01, 0x01, 0x03, 0x1D, 0x0F, 0x00}, 6},
+        {{'1', '2', '3', '4', '5', '6', '7', '8', '9'}, 9, {0x0C, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x29, 0xB1, 0x00}, 13},
+#else
+        {{0x11, 0x22, 0x00, 0x33}, 4, {0x03, 0x11, 0x22, 0x02, 0x33, 0x00}, 6},
+        {{0x00}, 1, {0x01, 0x01, 0x00}, 3},
+        {{0x00, 0x00}, 2, {0x01, 0x01, 0x01, 0x00}, 4},
+        {{'1', '2', '3', '4', '5', '6', '7', '8', '9'}, 9, {0x0A, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x00}, 11},
+#endif
+    };
+
+    uint8_t Local_au8Frame[COBS_FRAME_SIZE(16U)];
+    uint16_t Local_u16FrameSize = 0;
+    uint32_t Local_u32Counter = 0;
+
+    for (Local_u32Counter = 0; Local_u32Counter < (sizeof(Local_Vectors) / sizeof(Local_Vectors[0])); Local_u32Counter++)
+    {
+        memcpy(&Local_au8Frame[COBS_PAYLOAD_OFFSET], Local_Vectors[Local_u32Counter].Payload, Local_Vectors[Local_u32Counter].PayloadSize);
+
+        TEST_CHECK(COBS_OK == COBS_EncodeFrame(Local_au8Frame, Local_Vectors[Local_u32Counter].PayloadSize, &Local_u16FrameSize),
+                   "Fixed Vector %u Not Encoded", Local_u32Counter);
+        TEST_CHECK((Local_u16FrameSize == Local_Vectors[Local_u32Counter].FrameSize) &&
+                       (0 == memcmp(Local_au8Frame, Local_Vectors[Local_u32Counter].Frame, Local_u16FrameSize)),
+                   "Fixed Vector %u Encoded Wrong", Local_u32Counter);
+    }
+}
+
+static void TEST_EncoderLimits(void)
+{
+    uint8_t Local_au8Frame[COBS_FRAME_SIZE(COBS_MAX_PAYLOAD + 1U)] = {0};
+    uint16_t Local_u16FrameSize = 0;
+
+    TEST_CHECK(NULL_POINTER == COBS_EncodeFrame(NULL, 1U, &Local_u16FrameSize), "NULL Frame Accepted");
+    TEST_CHECK(NULL_POINTER == COBS_EncodeFrame(Local_au8Frame, 1U, NULL), "NULL FrameSize Accepted");
+    TEST_CHECK(COBS_NOK == COBS_EncodeFrame(Local_au8Frame, 0U, &Local_u16FrameSize), "Empty Payload Accepted");
+    TEST_CHECK(COBS_NOK == COBS_EncodeFrame(Local_au8Frame, COBS_MAX_PAYLOAD + 1U, &Local_u16FrameSize), "Payload Past One Block Accepted");
+}
+
+/* Every Payload Length & Pattern : Encoder Matches The Reference , Decoder Returns The Payload */
+static void TEST_RoundTrip(void)
+{
+    uint8_t Local_au8Payload[COBS_MAX_PAYLOAD];
+    uint8_t Local_au8Frame[COBS_FRAME_SIZE(COBS_MAX_PAYLOAD)];
+    uint8_t Local_au8Reference[COBS_FRAME_SIZE(COBS_MAX_PAYLOAD) + 2U];
+    uint16_t Local_u16FrameSize = 0;
+    uint32_t Local_u32ReferenceSize = 0;
+    uint32_t Local_u32Size = 0;
+    uint32_t Local_u32Pattern = 0;
+    uint32_t Local_u32Count = 0;
+
+    TEST_Start(sizeof(TEST_PacketBuffer));
+
+    for (Local_u32Pattern = 0; Local_u32Pattern < 4U; Local_u32Pattern++)
+    {
+        for (Local_u32Size = 1; Local_u32Size <= COBS_MAX_PAYLOAD; Local_u32Size++)
+        {
+            TEST_Fill(Local_au8Payload, Local_u32Size, Local_u32Pattern);
+
+            memcpy(&Local_au8Frame[COBS_PAYLOAD_OFFSET], Local_au8Payload, Local_u32Size);
+            COBS_EncodeFrame(Local_au8Frame, (uint16_t)Local_u32Size, &Local_u16FrameSize);
+
+            Local_u32ReferenceSize = REF_Encode(Local_au8Payload, Local_u32Size, 0U, 0U, Local_au8Reference);
+
+            TEST_CHECK((Local_u16FrameSize == Local_u32ReferenceSize) && (0 == memcmp(Local_au8Frame, Local_au8Reference, Local_u32ReferenceSize)),
+                       "Pattern %u Size %u : Encoder Differs From Reference", Local_u32Pattern, Local_u32Size);
+
+            Local_u32Count = TEST_ReceivedCount;
+            STUB_Receive(Local_au8Frame, Local_u16FrameSize);
+
+            TEST_CHECK((TEST_ReceivedCount == Local_u32Count + 1U) && (TEST_ReceivedSize == Local_u32Size) &&
+                           (0 == memcmp(TEST_Received, Local_au8Payload, Local_u32Size)),
+                       "Pattern %u Size %u : Not Decoded Back", Local_u32Pattern, Local_u32Size);
+        }
+    }
+}
+
+/* Frames From Other Senders Are Not Limited to One Block , Walk The Data Length Across The 254 / 255 Boundaries */
+static void TEST_BlockBoundaries(void)
+{
+    static const uint32_t Local_au32DataSizes[] = {253U, 254U, 255U, 256U, 508U, 509U, 510U};
+
+    uint8_t Local_au8Payload[TEST_MAX_PACKET];
+    uint8_t Local_au8Frame[TEST_MAX_PACKET + 8U];
+    uint32_t Local_u32FrameSize = 0;
+    uint32_t Local_u32Size = 0;
+    uint32_t Local_u32Counter = 0;
+    uint32_t Local_u32Pattern = 0;
+    uint8_t Local_u8Trailing = 0;
+
+    TEST_Start(sizeof(TEST_PacketBuffer));
+
+    for (Local_u32Counter = 0; Local_u32Counter < (sizeof(Local_au32DataSizes) / sizeof(Local_au32DataSizes[0])); Local_u32Counter++)
+    {
+        Local_u32Size = Local_au32DataSizes[Local_u32Counter] - COBS_CRC_SIZE;
+
+        for (Local_u32Pattern = 0; Local_u32Pattern < 4U; Local_u32Pattern++)
+        {
+            for (Local_u8Trailing = 0; Local_u8Trailing < 2U; Local_u8Trailing++)
+            {
+                TEST_Fill(Local_au8Payload, Local_u32Size, Local_u32Pattern);
+
+                /* A Zero Right After a Full Block */
+                if ((3U == Local_u32Pattern) && (Local_u32Size > 254U))
+                {
+                    memset(Local_au8Payload, 0x5A, 254U);
+                    Local_au8Payload[254] = 0x00U;
+                }
+
+                Local_u32FrameSize = REF_Encode(Local_au8Payload, Local_u32Size, 0U, Local_u8Trailing, Local_au8Frame);
+
+                TEST_ReceivedSize = 0;
+                STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+
+                TEST_CHECK((TEST_ReceivedSize == Local_u32Size) && (0 == memcmp(TEST_Received, Local_au8Payload, Local_u32Size)),
+                           "Data Size %u Pattern %u Trailing %u : Not Decoded", Local_au32DataSizes[Local_u32Counter], Local_u32Pattern, Local_u8Trailing);
+            }
+        }
+    }
+}
+
+#if (COBS_CRC_ENABLE == 1U)
+static void TEST_CorruptedCrc(void)
+{
+    static const uint16_t Local_au16CrcXor[] = {0x0001U, 0x8000U, 0x0100U, 0xFFFFU};
+    static const uint32_t Local_au32Sizes[] = {1U, 9U, 252U, 253U, 300U};
+
+    uint8_t Local_au8Payload[TEST_MAX_PACKET];
+    uint8_t Local_au8Frame[TEST_MAX_PACKET + 8U];
+    uint32_t Local_u32FrameSize = 0;
+    uint32_t Local_u32Size = 0;
+    uint32_t Local_u32Counter = 0;
+    uint32_t Local_u32Xor = 0;
+    uint32_t Local_u32Count = 0;
+    COBS_Stats_t Local_Before;
+    COBS_Stats_t Local_After;
+
+    TEST_Start(sizeof(TEST_PacketBuffer));
+
+    for (Local_u32Counter = 0; Local_u32Counter < (sizeof(Local_au32Sizes) / sizeof(Local_au32Sizes[0])); Local_u32Counter++)
+    {
+        Local_u32Size = Local_au32Sizes[Local_u32Counter];
+        TEST_Fill(Local_au8Payload, Local_u32Size, 3U);
+
+        /* Wrong CRC Sent */
+        for (Local_u32Xor = 0; Local_u32Xor < (sizeof(Local_au16CrcXor) / sizeof(Local_au16CrcXor[0])); Local_u32Xor++)
+        {
+            Local_u32FrameSize = REF_Encode(Local_au8Payload, Local_u32Size, Local_au16CrcXor[Local_u32Xor], 0U, Local_au8Frame);
+
+            COBS_GetStats(&Local_Before);
+            Local_u32Count = TEST_ReceivedCount;
+            STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+            COBS_GetStats(&Local_After);
+
+            TEST_CHECK((TEST_ReceivedCount == Local_u32Count) && (Local_After.CrcErrors == Local_Before.CrcErrors + 1U),
+                       "Size %u CRC ^ 0x%04X : Not Rejected", Local_u32Size, Local_au16CrcXor[Local_u32Xor]);
+        }
+
+        /* Right CRC , One Payload Bit Flipped on The Line ( a Byte That Stays Non Zero So The Framing Holds ) */
+        Local_u32FrameSize = REF_Encode(Local_au8Payload, Local_u32Size, 0U, 0U, Local_au8Frame);
+        Local_au8Frame[Local_u32FrameSize - 4U] ^= (0x01U == Local_au8Frame[Local_u32FrameSize - 4U]) ? 0x02U : 0x01U;
+
+        COBS_GetStats(&Local_Before);
+        Local_u32Count = TEST_ReceivedCount;
+        STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+        COBS_GetStats(&Local_After);
+
+        TEST_CHECK((TEST_ReceivedCount == Local_u32Count) && (Local_After.CrcErrors + Local_After.FormatErrors == Local_Before.CrcErrors + Local_Before.FormatErrors + 1U),
+                   "Size %u Bit Flip : Not Rejected", Local_u32Size);
+    }
+}
+#endif
+
+static void TEST_BadFrames(void)
+{
+    /* Second Block Claims 5 Bytes , Only 2 Arrive */
+    static const uint8_t Local_au8Truncated[] = {0x03, 0x11, 0x22, 0x05, 0x33, 0x44, 0x00};
+#if (COBS_CRC_ENABLE == 1U)
+    /* Decodes to COBS_CRC_SIZE Bytes or Less , No Room For a Payload */
+    static const uint8_t Local_au8Short[] = {0x02, 0x11, 0x00};
+#endif
+    static const uint8_t Local_au8Padding[] = {0x00, 0x00, 0x00};
+    static const uint8_t Local_au8Garbage[] = {0x17, 0x42, 0x99, 0x03};
+
+    uint8_t Local_au8Payload[64];
+    uint8_t Local_au8Frame[80];
+    uint32_t Local_u32FrameSize = 0;
+    uint32_t Local_u32Count = 0;
+    COBS_Stats_t Local_Before;
+    COBS_Stats_t Local_After;
+
+    TEST_Start(sizeof(TEST_PacketBuffer));
+
+    COBS_GetStats(&Local_Before);
+    STUB_Receive(Local_au8Truncated, sizeof(Local_au8Truncated));
+    COBS_GetStats(&Local_After);
+    TEST_CHECK(Local_After.FormatErrors == Local_Before.FormatErrors + 1U, "Truncated Frame Not Counted");
+
+#if (COBS_CRC_ENABLE == 1U)
+    COBS_GetStats(&Local_Before);
+    STUB_Receive(Local_au8Short, sizeof(Local_au8Short));
+    COBS_GetStats(&Local_After);
+    TEST_CHECK(Local_After.FormatErrors == Local_Before.FormatErrors + 1U, "Frame Shorter Than The CRC Not Counted");
+#endif
+
+    /* Padding Delimiters Are Neither Packets Nor Errors */
+    COBS_GetStats(&Local_Before);
+    Local_u32Count = TEST_ReceivedCount;
+    STUB_Receive(Local_au8Padding, sizeof(Local_au8Padding));
+    COBS_GetStats(&Local_After);
+    TEST_CHECK((TEST_ReceivedCount == Local_u32Count) && (0 == memcmp(&Local_Before, &Local_After, sizeof(Local_After))), "Padding Delimiters Not Ignored");
+
+    /* Joining Mid Frame : Everything Before The First Delimiter is Dropped , The Next Frame is Received */
+    TEST_Fill(Local_au8Payload, 40U, 3U);
+    Local_u32FrameSize = REF_Encode(Local_au8Payload, 40U, 0U, 0U, Local_au8Frame);
+
+    COBS_StopReceive();
+    COBS_StartReceive(&TEST_UsartConfig, TEST_PacketBuffer, sizeof(TEST_PacketBuffer), TEST_CallBack);
+
+    COBS_GetStats(&Local_Before);
+    Local_u32Count = TEST_ReceivedCount;
+    STUB_Receive(Local_au8Garbage, sizeof(Local_au8Garbage));
+    STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+    STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+    COBS_GetStats(&Local_After);
+    TEST_CHECK((TEST_ReceivedCount == Local_u32Count + 1U) && (Local_After.Packets == Local_Before.Packets + 1U), "No Resync on The First Delimiter");
+
+    /* Oversized Frame Dropped , The Next One Fits */
+    TEST_Start(40U + COBS_CRC_SIZE - 1U);
+
+    COBS_GetStats(&Local_Before);
+    Local_u32Count = TEST_ReceivedCount;
+    STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+    COBS_GetStats(&Local_After);
+    TEST_CHECK((TEST_ReceivedCount == Local_u32Count) && (Local_After.OverflowErrors == Local_Before.OverflowErrors + 1U), "Oversized Frame Not Dropped");
+
+    Local_u32FrameSize = REF_Encode(Local_au8Payload, 39U, 0U, 0U, Local_au8Frame);
+    STUB_Receive(Local_au8Frame, Local_u32FrameSize);
+    TEST_CHECK((TEST_ReceivedCount == Local_u32Count + 1U) && (TEST_ReceivedSize == 39U), "No Recovery After Overflow");
+}
+
+/*==============================================================================================================================================
+ * MAIN
+ *==============================================================================================================================================*/
+
+int main(void)
+{
+    COBS_Stats_t Local_Stats;
+
+    TEST_FixedVectors();
+    TEST_EncoderLimits();
+    TEST_RoundTrip();
+    TEST_BlockBoundaries();
+#if (COBS_CRC_ENABLE == 1U)
+    TEST_CorruptedCrc();
+#endif
+    TEST_BadFrames();
+
+    COBS_GetStats(&Local_Stats);
+
+    printf("%u / %u Checks Passed ( Packets %u , CRC %u , Overflow %u , Format %u )\n",
+           TEST_Checks - TEST_Failures, TEST_Checks, Local_Stats.Packets, Local_Stats.CrcErrors,
+           Local_Stats.OverflowErrors, Local_Stats.FormatErrors);
+
+    return (0U == TEST_Failures) ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_UsartStub.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Stand in For The USART Stream Reception Used By HAL/COBS
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * USART_ReceiveStream_IT & USART_StopReceiveStream Are Implemented Here , So HAL/COBS is Built Unchanged
+ * & Fed From The Host Through STUB_Receive . Linked By COBS_Test.c & COBS_Bench.c
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/USART/Inc/USART_Interface.h"
+
+#include "COBS_UsartStub.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+static void (*STUB_CallBack)(uint8_t Data) = NULL;
+
+/*==============================================================================================================================================
+ * USART FUNCTIONS
+ *==============================================================================================================================================*/
+
+ERRORS_t USART_ReceiveStream_IT(USART_Config_t *Config, void (*pv_CallBackFunc)(uint8_t Data))
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if ((NULL == Config) || (NULL == pv_CallBackFunc))
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else if (NULL != STUB_CallBack)
+    {
+        Local_u8ErrorStatus = USART_BUSY;
+    }
+    else
+    {
+        STUB_CallBack = pv_CallBackFunc;
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t USART_StopReceiveStream(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (NULL == Config)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        STUB_CallBack = NULL;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * HOST SIDE
+ *==============================================================================================================================================*/
+
+void STUB_Receive(const uint8_t *Data, uint32_t Size)
+{
+    uint32_t Local_u32Counter = 0;
+
+    for (Local_u32Counter = 0; (Local_u32Counter < Size) && (NULL != STUB_CallBack); Local_u32Counter++)
+    {
+        STUB_CallBack(Data[Local_u32Counter]);
+    }
+}
@@ -0,0 +1,28 @@
+/*
+ ******************************************************************************
+ * @file           : COBS_UsartStub.h
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Stand in For The USART Stream Reception Used By HAL/COBS
+ * @Date           : Sep 16, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ */
+#ifndef COBS_USARTSTUB_H_
+#define COBS_USARTSTUB_H_
+
+#include <stdint.h>
+
+/**
+ * @brief  : This Function is Used to Hand Bytes to The Stream CallBack as if The USART ISR Received Them
+ * @param  : Data => This Parameter is Used to Pass The Received Bytes
+ * @param  : Size => This Parameter is Used to Pass The Number of Bytes
+ * @note   : Bytes Are Dropped While No Stream Reception is Running , Like on The Target
+ */
+void STUB_Receive(const uint8_t *Data, uint32_t Size);
+
+#endif /* COBS_USARTSTUB_H_ */
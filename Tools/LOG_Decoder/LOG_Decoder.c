@@ -0,0 +1,216 @@
+/*
+ ******************************************************************************
+ * @file           : LOG_Decoder.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Decoder For The Binary Stream of HAL/LOG
+ * @Date           : Sep 12, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o log_decoder LOG_Decoder.c
+ * Use   : stty -F /dev/ttyUSB0 115200 raw -echo && ./log_decoder /dev/ttyUSB0
+ *         ./log_decoder capture.bin        ( or from stdin : ./log_decoder < capture.bin )
+ *
+ * The Message Formats Come From The Same LOG_Catalog.h The Target is Built With ,
+ * So Rebuild The Decoder Whenever a Message is Added
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../../HAL/LOG/Inc/LOG_Catalog.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/* Must Match LOG_Interface.h & LOG_Private.h */
+#define LOG_MAX_ARGS 4U
+#define LOG_SYNC_BYTE 0xA5U
+
+#define LOG_CATALOG_FORMAT(ID, FORMAT) FORMAT,
+
+static const char *LOG_Formats[LOG_ID_NUM] = {LOG_CATALOG(LOG_CATALOG_FORMAT)};
+
+#define LOG_CATALOG_NAME(ID, FORMAT) #ID,
+
+static const char *LOG_Names[LOG_ID_NUM] = {LOG_CATALOG(LOG_CATALOG_NAME)};
+
+/* Header Bytes Handed Back to The Sync Hunt After a Rejected Header , The Stream May Be a Serial Port So No Seeking */
+static uint8_t LOG_Pending[3];
+static uint32_t LOG_PendingIndex = 0;
+static uint32_t LOG_PendingCount = 0;
+
+/**
+ * @brief  : This Function is Used to Read One Byte , The Handed Back Header Bytes Come First
+ * @return : int => The Byte , or EOF at End of Stream
+ */
+static int LOG_ReadByte(FILE *Stream)
+{
+    int Local_Byte = 0;
+
+    if (LOG_PendingIndex < LOG_PendingCount)
+    {
+        Local_Byte = LOG_Pending[LOG_PendingIndex];
+        LOG_PendingIndex++;
+    }
+    else
+    {
+        Local_Byte = fgetc(Stream);
+    }
+    return Local_Byte;
+}
+
+/**
+ * @brief  : This Function is Used to Hand The Three Bytes After a Rejected Sync Byte Back , So The Hunt Resumes at Header Start + 1
+ */
+static void LOG_UnreadHeader(uint32_t Header)
+{
+    LOG_Pending[0] = (uint8_t)(Header >> 8);
+    LOG_Pending[1] = (uint8_t)(Header >> 16);
+    LOG_Pending[2] = (uint8_t)(Header >> 24);
+
+    LOG_PendingIndex = 0;
+    LOG_PendingCount = 3;
+}
+
+/**
+ * @brief  : This Function is Used to Read a Little Endian 32 Bits Word From The Stream
+ * @return : int => 0 on Success , -1 at End of Stream
+ */
+static int LOG_ReadWord(FILE *Stream, uint32_t *Word)
+{
+    int Local_Byte = 0;
+    uint32_t Local_u32Counter = 0;
+
+    *Word = 0;
+
+    for (Local_u32Counter = 0; Local_u32Counter < 4U; Local_u32Counter++)
+    {
+        Local_Byte = LOG_ReadByte(Stream);
+
+        if (EOF == Local_Byte)
+        {
+            return -1;
+        }
+        *Word |= ((uint32_t)Local_Byte << (8U * Local_u32Counter));
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *Local_Stream = stdin;
+
+    uint32_t Local_u32Header = 0;
+    uint32_t Local_u32Args[LOG_MAX_ARGS] = {0};
+    uint32_t Local_u32Id = 0;
+    uint32_t Local_u32ArgCount = 0;
+    uint32_t Local_u32Counter = 0;
+
+    uint8_t Local_u8Sequence = 0;
+    uint8_t Local_u8Expected = 0;
+    int Local_Synced = 0;
+    int Local_Byte = 0;
+
+    if (argc > 1)
+    {
+        Local_Stream = fopen(argv[1], "rb");
+
+        if (NULL == Local_Stream)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    for (;;)
+    {
+        /* Hunt For The Sync Byte , it is The First Byte of Every Record */
+        do
+        {
+            Local_Byte = LOG_ReadByte(Local_Stream);
+        } while ((EOF != Local_Byte) && (LOG_SYNC_BYTE != Local_Byte));
+
+        if (EOF == Local_Byte)
+        {
+            break;
+        }
+
+        /* Rest of The Header */
+        Local_u32Header = LOG_SYNC_BYTE;
+
+        for (Local_u32Counter = 1; Local_u32Counter < 4U; Local_u32Counter++)
+        {
+            Local_Byte = LOG_ReadByte(Local_Stream);
+
+            if (EOF == Local_Byte)
+            {
+                break;
+            }
+            Local_u32Header |= ((uint32_t)Local_Byte << (8U * Local_u32Counter));
+        }
+
+        if (EOF == Local_Byte)
+        {
+            break;
+        }
+
+        Local_u8Sequence = (uint8_t)(Local_u32Header >> 8);
+        Local_u32Id = (Local_u32Header >> 16) & 0x0FFFU;
+        Local_u32ArgCount = Local_u32Header >> 28;
+
+        if ((Local_u32Id >= (uint32_t)LOG_ID_NUM) || (Local_u32ArgCount > LOG_MAX_ARGS))
+        {
+            /* 0xA5 Inside an Argument , Keep Hunting From The Byte After it , Not After The Rejected Header
+               The Sequence Expected From The Last Good Record Still Holds , So Records Lost Meanwhile Are Reported */
+            LOG_UnreadHeader(Local_u32Header);
+            continue;
+        }
+
+        for (Local_u32Counter = 0; Local_u32Counter < LOG_MAX_ARGS; Local_u32Counter++)
+        {
+            Local_u32Args[Local_u32Counter] = 0;
+        }
+
+        for (Local_u32Counter = 0; Local_u32Counter < Local_u32ArgCount; Local_u32Counter++)
+        {
+            if (0 != LOG_ReadWord(Local_Stream, &Local_u32Args[Local_u32Counter]))
+            {
+                break;
+            }
+        }
+
+        if (Local_u32Counter != Local_u32ArgCount)
+        {
+            break;
+        }
+
+        if (Local_Synced && (Local_u8Sequence != Local_u8Expected))
+        {
+            printf("---- %u Record(s) Lost ----\n", (unsigned)(uint8_t)(Local_u8Sequence - Local_u8Expected));
+        }
+        Local_Synced = 1;
+        Local_u8Expected = (uint8_t)(Local_u8Sequence + 1U);
+
+        printf("[%3u] %-28s ", (unsigned)Local_u8Sequence, LOG_Names[Local_u32Id]);
+        printf(LOG_Formats[Local_u32Id], Local_u32Args[0], Local_u32Args[1], Local_u32Args[2], Local_u32Args[3]);
+        printf("\n");
+        fflush(stdout);
+    }
+
+    if (stdin != Local_Stream)
+    {
+        fclose(Local_Stream);
+    }
+    return 0;
+}
@@ -0,0 +1,482 @@
+/*
+ ******************************************************************************
+ * @file           : SDCARD_Emulator.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) RAM Backed SDHC Card in SPI Mode Standing in For HAL/SPIBUS
+ * @Date           : Sep 25, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o sdcard_roundtrip SDCARD_RoundTrip.c SDCARD_Emulator.c ../../HAL/SDCARD/Src/SDCARD_Program.c
+ * Use   : ./sdcard_roundtrip        ( Or Link Your Own Application in Place of SDCARD_RoundTrip.c )
+ *
+ * The SPIBUS Functions ( & GPIO_u8SetPinValue ) Are Implemented Here Over a 16 MB RAM Image , So HAL/SDCARD is Built
+ * Unchanged & Exercised on The Host . Every Device Handed to SPIBUS is Answered By The Same Emulated Card
+ *
+ * Modelled Behavior :
+ *   - CMD0 , CMD8 Echo , CMD55 + ACMD41 ( Idle For The First Attempt ) , CMD58 With CCS Set , CSD Version 2.0
+ *   - CMD17 & CMD18 Streams With a Gap Byte Before Each Token , CMD12 With Its Stuff Byte & Busy
+ *   - CMD24 & CMD25 With Start , Multiple Block & Stop Tokens , Data Response Then Busy Bytes After Each Block
+ *   - Out of Range Addresses Answer R1 Address Error , Unknown Commands R1 Illegal Command
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../../HAL/SPIBUS/Inc/SPIBUS_Interface.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+#define EMU_BLOCK_SIZE  512UL
+#define EMU_BLOCK_COUNT 32768UL /* 16 MB , CSD C_SIZE = 31 */
+
+#define EMU_BUSY_BYTES 4U
+
+#define EMU_R1_IDLE            0x01U
+#define EMU_R1_ILLEGAL_COMMAND 0x04U
+#define EMU_R1_ADDRESS_ERROR   0x20U
+
+typedef enum
+{
+    EMU_COMMAND = 0,   /* Waiting For a Command Frame */
+    EMU_READ_MULTI,    /* CMD18 Stream Running */
+    EMU_WRITE_SINGLE,  /* CMD24 , Waiting For The Block */
+    EMU_WRITE_MULTI,   /* CMD25 , Waiting For Blocks or The Stop Token */
+
+} EMU_State_t;
+
+static uint8_t EMU_Image[EMU_BLOCK_COUNT * EMU_BLOCK_SIZE];
+
+/* Bytes Queued on MISO , 0xFF When Empty */
+static uint8_t EMU_Out[EMU_BLOCK_SIZE + 64U];
+static uint32_t EMU_OutHead = 0;
+static uint32_t EMU_OutTail = 0;
+
+static EMU_State_t EMU_State = EMU_COMMAND;
+static uint8_t EMU_Idle = 1;
+static uint8_t EMU_AppCommand = 0;
+static uint8_t EMU_Acmd41Count = 0;
+
+static uint8_t EMU_Frame[6];
+static uint8_t EMU_FrameIndex = 0;
+
+static uint32_t EMU_Block = 0;
+static uint8_t EMU_Receiving = 0;      /* Token Seen , Block Bytes Follow */
+static uint32_t EMU_ReceiveIndex = 0;  /* Block + CRC Bytes Received */
+static uint8_t EMU_ReceiveBuffer[EMU_BLOCK_SIZE];
+
+static const SPIBUS_Device_t *EMU_Owner = NULL;
+
+/* Commands Executed , App Commands Counted at Command + 64 */
+static uint32_t EMU_CommandCounts[128];
+
+static void EMU_Push(uint8_t Byte)
+{
+    EMU_Out[EMU_OutHead] = Byte;
+    EMU_OutHead = (EMU_OutHead + 1U) % sizeof(EMU_Out);
+}
+
+static void EMU_PushBusy(void)
+{
+    uint8_t Local_u8Counter = 0;
+
+    for (Local_u8Counter = 0; Local_u8Counter < EMU_BUSY_BYTES; Local_u8Counter++)
+    {
+        EMU_Push(0x00);
+    }
+}
+
+static void EMU_PushBlock(const uint8_t *Data, uint32_t Size)
+{
+    uint32_t Local_u32Counter = 0;
+
+    /* One Gap Byte , The Token , The Data & a Dummy CRC */
+    EMU_Push(0xFF);
+    EMU_Push(0xFE);
+
+    for (Local_u32Counter = 0; Local_u32Counter < Size; Local_u32Counter++)
+    {
+        EMU_Push(Data[Local_u32Counter]);
+    }
+
+    EMU_Push(0x00);
+    EMU_Push(0x00);
+}
+
+/**
+ * @brief  : This Function is Used to Run a Complete Command Frame & Queue Its Response
+ */
+static void EMU_Execute(void)
+{
+    const uint8_t Local_u8Csd[16] = {0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0x80, 0x0A, 0x40, 0x00, 0x01};
+
+    uint8_t Local_u8Command = EMU_Frame[0] & 0x3FU;
+    uint32_t Local_u32Argument = ((uint32_t)EMU_Frame[1] << 24) | ((uint32_t)EMU_Frame[2] << 16) | ((uint32_t)EMU_Frame[3] << 8) | EMU_Frame[4];
+    uint8_t Local_u8R1 = EMU_Idle ? EMU_R1_IDLE : 0x00U;
+    uint8_t Local_u8AppCommand = EMU_AppCommand;
+
+    EMU_AppCommand = 0;
+
+    EMU_CommandCounts[Local_u8AppCommand ? (Local_u8Command + 64U) : Local_u8Command]++;
+
+    if (12U == Local_u8Command)
+    {
+        /* Drop The Rest of The Stream , Stuff Byte , R1 , Busy */
+        EMU_OutTail = EMU_OutHead;
+        EMU_State = EMU_COMMAND;
+
+        EMU_Push(0xFF);
+        EMU_Push(Local_u8R1);
+        EMU_PushBusy();
+        return;
+    }
+
+    /* NCR Gap */
+    EMU_Push(0xFF);
+
+    if (0U == Local_u8Command)
+    {
+        EMU_Idle = 1;
+        EMU_Acmd41Count = 0;
+        EMU_State = EMU_COMMAND;
+
+        EMU_Push(EMU_R1_IDLE);
+    }
+    else if (Local_u8AppCommand && (41U == Local_u8Command))
+    {
+        /* Stays Idle For The First Attempt Like a Real Card Powering Up */
+        if (++EMU_Acmd41Count > 1U)
+        {
+            EMU_Idle = 0;
+        }
+
+        EMU_Push(EMU_Idle ? EMU_R1_IDLE : 0x00U);
+    }
+    else if (8U == Local_u8Command)
+    {
+        EMU_Push(Local_u8R1);
+        EMU_Push(0x00);
+        EMU_Push(0x00);
+        EMU_Push((uint8_t)((Local_u32Argument >> 8) & 0x0FU));
+        EMU_Push((uint8_t)Local_u32Argument);
+    }
+    else if (55U == Local_u8Command)
+    {
+        EMU_AppCommand = 1;
+
+        EMU_Push(Local_u8R1);
+    }
+    else if (58U == Local_u8Command)
+    {
+        EMU_Push(Local_u8R1);
+        EMU_Push(EMU_Idle ? 0x00U : 0xC0U);
+        EMU_Push(0xFF);
+        EMU_Push(0x80);
+        EMU_Push(0x00);
+    }
+    else if (EMU_Idle)
+    {
+        /* Only The Initialization Commands Are Accepted in Idle State */
+        EMU_Push(EMU_R1_IDLE | EMU_R1_ILLEGAL_COMMAND);
+    }
+    else if (9U == Local_u8Command)
+    {
+        EMU_Push(Local_u8R1);
+        EMU_PushBlock(Local_u8Csd, sizeof(Local_u8Csd));
+    }
+    else if (16U == Local_u8Command)
+    {
+        EMU_Push(Local_u8R1);
+    }
+    else if ((17U == Local_u8Command) || (18U == Local_u8Command) || (24U == Local_u8Command) || (25U == Local_u8Command))
+    {
+        if (Local_u32Argument >= EMU_BLOCK_COUNT)
+        {
+            EMU_Push(EMU_R1_ADDRESS_ERROR);
+        }
+        else
+        {
+            EMU_Block = Local_u32Argument;
+
+            EMU_Push(Local_u8R1);
+
+            if (17U == Local_u8Command)
+            {
+                EMU_PushBlock(&EMU_Image[EMU_Block * EMU_BLOCK_SIZE], EMU_BLOCK_SIZE);
+            }
+            else if (18U == Local_u8Command)
+            {
+                EMU_State = EMU_READ_MULTI;
+            }
+            else
+            {
+                EMU_State = (24U == Local_u8Command) ? EMU_WRITE_SINGLE : EMU_WRITE_MULTI;
+                EMU_Receiving = 0;
+            }
+        }
+    }
+    else
+    {
+        EMU_Push(Local_u8R1 | EMU_R1_ILLEGAL_COMMAND);
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Take One Byte of a Written Data Block
+ */
+static void EMU_WriteByte(uint8_t Mosi)
+{
+    if (0U == EMU_Receiving)
+    {
+        if ((EMU_WRITE_MULTI == EMU_State) && (0xFDU == Mosi))
+        {
+            EMU_State = EMU_COMMAND;
+
+            /* One Byte Before Busy Starts */
+            EMU_Push(0xFF);
+            EMU_PushBusy();
+        }
+        else if (((EMU_WRITE_SINGLE == EMU_State) && (0xFEU == Mosi)) || ((EMU_WRITE_MULTI == EMU_State) && (0xFCU == Mosi)))
+        {
+            EMU_Receiving = 1;
+            EMU_ReceiveIndex = 0;
+        }
+    }
+    else
+    {
+        if (EMU_ReceiveIndex < EMU_BLOCK_SIZE)
+        {
+            EMU_ReceiveBuffer[EMU_ReceiveIndex] = Mosi;
+        }
+
+        EMU_ReceiveIndex++;
+
+        /* Block & CRC Received */
+        if ((EMU_BLOCK_SIZE + 2U) == EMU_ReceiveIndex)
+        {
+            EMU_Receiving = 0;
+
+            if (EMU_Block < EMU_BLOCK_COUNT)
+            {
+                memcpy(&EMU_Image[EMU_Block * EMU_BLOCK_SIZE], EMU_ReceiveBuffer, EMU_BLOCK_SIZE);
+
+                EMU_Block++;
+
+                EMU_Push(0xE5); /* Data Accepted */
+            }
+            else
+            {
+                EMU_Push(0xED); /* Write Error */
+            }
+
+            EMU_PushBusy();
+
+            if (EMU_WRITE_SINGLE == EMU_State)
+            {
+                EMU_State = EMU_COMMAND;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  : This Function is Used to Clock One Byte Into The Emulated Card & Return The Byte it Drives Back
+ */
+static uint8_t EMU_Clock(uint8_t Mosi)
+{
+    uint8_t Local_u8Miso = 0xFF;
+
+    /* Keep The Read Stream Going While The Host Reads */
+    if ((EMU_READ_MULTI == EMU_State) && (EMU_OutTail == EMU_OutHead))
+    {
+        if (EMU_Block < EMU_BLOCK_COUNT)
+        {
+            EMU_PushBlock(&EMU_Image[EMU_Block * EMU_BLOCK_SIZE], EMU_BLOCK_SIZE);
+
+            EMU_Block++;
+        }
+        else
+        {
+            EMU_Push(0x08); /* Out of Range Error Token */
+        }
+    }
+
+    if (EMU_OutTail != EMU_OutHead)
+    {
+        Local_u8Miso = EMU_Out[EMU_OutTail];
+        EMU_OutTail = (EMU_OutTail + 1U) % sizeof(EMU_Out);
+    }
+
+    if ((EMU_WRITE_SINGLE == EMU_State) || (EMU_WRITE_MULTI == EMU_State))
+    {
+        EMU_WriteByte(Mosi);
+    }
+    else if ((0U != EMU_FrameIndex) || (0x40U == (Mosi & 0xC0U)))
+    {
+        EMU_Frame[EMU_FrameIndex] = Mosi;
+        EMU_FrameIndex++;
+
+        if (sizeof(EMU_Frame) == EMU_FrameIndex)
+        {
+            EMU_FrameIndex = 0;
+
+            EMU_Execute();
+        }
+    }
+
+    return Local_u8Miso;
+}
+
+/**
+ * @brief  : This Function is Used to Return How Many Times a Command Was Executed , Pass Command + 64 For an App Command
+ */
+uint32_t EMU_GetCommandCount(uint8_t Command)
+{
+    return (Command < 128U) ? EMU_CommandCounts[Command] : 0U;
+}
+
+/*==============================================================================================================================================
+ * SPIBUS & GPIO FUNCTIONS
+ *==============================================================================================================================================*/
+
+/* Chip Select is Not Modelled , The Card Acts as Always Selected */
+uint8_t GPIO_u8SetPinValue(Port_t Port, Pin_t PinNum, PinValue_t PinValue)
+{
+    (void)Port;
+    (void)PinNum;
+    (void)PinValue;
+
+    return OK;
+}
+
+ERRORS_t SPIBUS_Init(const SPI_Config_t *BusConfig)
+{
+    (void)BusConfig;
+
+    return SPIBUS_OK;
+}
+
+ERRORS_t SPIBUS_InitDevice(const SPIBUS_Device_t *Device)
+{
+    return (NULL == Device) ? NULL_POINTER : SPIBUS_OK;
+}
+
+ERRORS_t SPIBUS_Begin(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (NULL != EMU_Owner)
+    {
+        Local_u8ErrorStatus = SPIBUS_BUSY;
+    }
+    else
+    {
+        EMU_Owner = Device;
+        EMU_FrameIndex = 0;
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_Exchange(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    uint16_t Local_u16Counter = 0;
+    uint8_t Local_u8Miso = 0;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Device != EMU_Owner) || (0U == Size))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        for (Local_u16Counter = 0; Local_u16Counter < Size; Local_u16Counter++)
+        {
+            Local_u8Miso = EMU_Clock((NULL != TxBuffer) ? TxBuffer[Local_u16Counter] : 0xFF);
+
+            if (NULL != RxBuffer)
+            {
+                RxBuffer[Local_u16Counter] = Local_u8Miso;
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_End(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (Device != EMU_Owner)
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        EMU_Owner = NULL;
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_Transfer(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_Begin(Device);
+
+    if (SPIBUS_OK == Local_u8ErrorStatus)
+    {
+        Local_u8ErrorStatus = SPIBUS_Exchange(Device, TxBuffer, RxBuffer, Size);
+
+        SPIBUS_End(Device);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/* Runs to Completion Before Returning , The CallBack is Invoked From The Caller Context */
+ERRORS_t SPIBUS_Submit(SPIBUS_Transaction_t *Transaction)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if ((NULL == Transaction) || (NULL == Transaction->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SPIBUS_Transfer(Transaction->Device, Transaction->TxBuffer, Transaction->RxBuffer, Transaction->Size);
+
+        if (NULL != Transaction->CallBack)
+        {
+            Transaction->CallBack(Local_u8ErrorStatus);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
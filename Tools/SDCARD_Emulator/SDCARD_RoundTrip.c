@@ -0,0 +1,185 @@
+/*
+ ******************************************************************************
+ * @file           : SDCARD_RoundTrip.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Round Trip of HAL/SDCARD Against The Emulated SDHC Card
+ * @Date           : Sep 25, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o sdcard_roundtrip SDCARD_RoundTrip.c SDCARD_Emulator.c ../../HAL/SDCARD/Src/SDCARD_Program.c
+ * Use   : ./sdcard_roundtrip        ( Exit Status 0 When Every Check Passes )
+ *
+ * Checked :
+ *   - Initialization Through CMD0 , CMD8 , CMD55 + ACMD41 Retried Until Ready , CMD58 ( SDHC ) & CMD9 ( Size )
+ *   - Single Block CMD24 / CMD17 & Multiple Block CMD25 / CMD18 + CMD12 Round Trips , Untouched Neighbours
+ *   - Reads Issued While The Card is Still Busy With The Last Write , SDCARD_Sync
+ *   - The Last Blocks of The Card & Range Checks Past it
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../../HAL/SPIBUS/Inc/SPIBUS_Interface.h"
+
+#include "../../HAL/SDCARD/Inc/SDCARD_Interface.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/* Must Match The Emulated Card */
+#define TEST_BLOCK_COUNT 32768UL
+
+#define TEST_APP_COMMAND 64U
+
+#define TEST_MAX_BLOCKS 16U
+
+#define TEST_CHECK(COND, ...)          \
+    do                                 \
+    {                                  \
+        TEST_Checks++;                 \
+        if (!(COND))                   \
+        {                              \
+            TEST_Failures++;           \
+            printf("FAIL : ");         \
+            printf(__VA_ARGS__);       \
+            printf("\n");              \
+        }                              \
+    } while (0)
+
+/* Provided By SDCARD_Emulator.c */
+uint32_t EMU_GetCommandCount(uint8_t Command);
+
+static uint32_t TEST_Checks = 0;
+static uint32_t TEST_Failures = 0;
+
+/* The Emulator Answers Any Device , Bus Settings Are Not Used on The Host */
+static const SPIBUS_Device_t TEST_Device = {0};
+
+static SDCARD_Handle_t TEST_Card = {.Device = &TEST_Device};
+
+static uint8_t TEST_Pattern[TEST_MAX_BLOCKS * SDCARD_BLOCK_SIZE];
+static uint8_t TEST_ReadBack[TEST_MAX_BLOCKS * SDCARD_BLOCK_SIZE];
+
+/**
+ * @brief  : Returns 1 if Count Blocks Read From Block All Equal Value
+ */
+static uint8_t TEST_IsFilled(uint32_t Block, uint32_t Count, uint8_t Value)
+{
+    uint32_t Local_u32Counter = 0;
+    uint8_t Local_u8Filled = 1;
+
+    if (SDCARD_OK != SDCARD_ReadBlocks(&TEST_Card, Block, TEST_ReadBack, Count))
+    {
+        Local_u8Filled = 0;
+    }
+
+    for (Local_u32Counter = 0; (Local_u32Counter < (Count * SDCARD_BLOCK_SIZE)) && Local_u8Filled; Local_u32Counter++)
+    {
+        Local_u8Filled = (Value == TEST_ReadBack[Local_u32Counter]);
+    }
+    return Local_u8Filled;
+}
+
+/**
+ * @brief  : Writes Count Pattern Blocks at Block & Checks They Read Back , Without a Sync in Between
+ */
+static void TEST_WriteRead(uint32_t Block, uint32_t Count, const char *Name)
+{
+    TEST_CHECK(SDCARD_OK == SDCARD_WriteBlocks(&TEST_Card, Block, TEST_Pattern, Count), "%s : Write", Name);
+
+    memset(TEST_ReadBack, 0, Count * SDCARD_BLOCK_SIZE);
+
+    TEST_CHECK(SDCARD_OK == SDCARD_ReadBlocks(&TEST_Card, Block, TEST_ReadBack, Count), "%s : Read", Name);
+    TEST_CHECK(0 == memcmp(TEST_Pattern, TEST_ReadBack, Count * SDCARD_BLOCK_SIZE), "%s : Read Back Differs", Name);
+}
+
+static void TEST_Init(void)
+{
+    TEST_CHECK(SDCARD_NOK == SDCARD_ReadBlocks(&TEST_Card, 0, TEST_ReadBack, 1), "Read Before Init Refused");
+
+    TEST_CHECK(SDCARD_OK == SDCARD_Init(&TEST_Card), "Init");
+    TEST_CHECK(SDCARD_TYPE_SDHC == TEST_Card.Type, "Type %u", (unsigned)TEST_Card.Type);
+    TEST_CHECK(TEST_BLOCK_COUNT == TEST_Card.BlockCount, "Block Count %u", (unsigned)TEST_Card.BlockCount);
+
+    TEST_CHECK(EMU_GetCommandCount(0) >= 1U, "CMD0 Sent");
+    TEST_CHECK(1U == EMU_GetCommandCount(8), "CMD8 Sent Once");
+    TEST_CHECK(EMU_GetCommandCount(55) == EMU_GetCommandCount(TEST_APP_COMMAND + 41U), "Every ACMD41 Follows a CMD55");
+    TEST_CHECK(EMU_GetCommandCount(TEST_APP_COMMAND + 41U) >= 2U, "ACMD41 Retried While Idle");
+    TEST_CHECK(EMU_GetCommandCount(58) >= 1U, "CMD58 Sent");
+    TEST_CHECK(1U == EMU_GetCommandCount(9), "CMD9 Sent Once");
+}
+
+static void TEST_Blocks(void)
+{
+    uint32_t Local_u32Cmd12 = 0;
+
+    TEST_WriteRead(5, 1, "Single Block");
+    TEST_CHECK(1U == EMU_GetCommandCount(24), "Single Block Uses CMD24");
+    TEST_CHECK(EMU_GetCommandCount(17) >= 1U, "Single Block Uses CMD17");
+
+    Local_u32Cmd12 = EMU_GetCommandCount(12);
+
+    TEST_WriteRead(100, TEST_MAX_BLOCKS, "Multiple Blocks");
+    TEST_CHECK(1U == EMU_GetCommandCount(25), "Multiple Blocks Use One CMD25");
+    TEST_CHECK(1U == EMU_GetCommandCount(18), "Multiple Blocks Use One CMD18");
+    TEST_CHECK((Local_u32Cmd12 + 1U) == EMU_GetCommandCount(12), "CMD18 Stream Stopped By CMD12");
+
+    TEST_CHECK(TEST_IsFilled(99, 1, 0x00), "Block Before Untouched");
+    TEST_CHECK(TEST_IsFilled(100 + TEST_MAX_BLOCKS, 1, 0x00), "Block After Untouched");
+
+    /* A Second Stream Overwrites The Middle of The First */
+    TEST_CHECK(SDCARD_OK == SDCARD_WriteBlocks(&TEST_Card, 104, &TEST_Pattern[SDCARD_BLOCK_SIZE], 2), "Overwrite");
+    TEST_CHECK(SDCARD_OK == SDCARD_Sync(&TEST_Card), "Sync");
+    TEST_CHECK((SDCARD_OK == SDCARD_ReadBlocks(&TEST_Card, 103, TEST_ReadBack, 4)) &&
+                   (0 == memcmp(&TEST_ReadBack[0], &TEST_Pattern[3U * SDCARD_BLOCK_SIZE], SDCARD_BLOCK_SIZE)) &&
+                   (0 == memcmp(&TEST_ReadBack[SDCARD_BLOCK_SIZE], &TEST_Pattern[SDCARD_BLOCK_SIZE], 2U * SDCARD_BLOCK_SIZE)) &&
+                   (0 == memcmp(&TEST_ReadBack[3U * SDCARD_BLOCK_SIZE], &TEST_Pattern[6U * SDCARD_BLOCK_SIZE], SDCARD_BLOCK_SIZE)),
+               "Overwrite Read Back");
+}
+
+static void TEST_Range(void)
+{
+    TEST_WriteRead(TEST_BLOCK_COUNT - 2UL, 2, "Last Two Blocks");
+
+    TEST_CHECK(SDCARD_NOK == SDCARD_WriteBlocks(&TEST_Card, TEST_BLOCK_COUNT - 1UL, TEST_Pattern, 2), "Write Past The End Refused");
+    TEST_CHECK(SDCARD_NOK == SDCARD_ReadBlocks(&TEST_Card, TEST_BLOCK_COUNT, TEST_ReadBack, 1), "Read Past The End Refused");
+    TEST_CHECK(SDCARD_NOK == SDCARD_ReadBlocks(&TEST_Card, 0, TEST_ReadBack, 0), "Empty Read Refused");
+    TEST_CHECK(NULL_POINTER == SDCARD_WriteBlocks(&TEST_Card, 0, NULL, 1), "NULL Buffer Refused");
+}
+
+int main(void)
+{
+    uint32_t Local_u32Counter = 0;
+
+    /* No Byte Value Repeats at a Block Stride , So a Misplaced Block Shows up */
+    for (Local_u32Counter = 0; Local_u32Counter < sizeof(TEST_Pattern); Local_u32Counter++)
+    {
+        TEST_Pattern[Local_u32Counter] = (uint8_t)((Local_u32Counter * 13U) + (Local_u32Counter >> 9) + 1U);
+    }
+
+    TEST_Init();
+    TEST_Blocks();
+    TEST_Range();
+
+    printf("%u / %u Checks Passed\n", TEST_Checks - TEST_Failures, TEST_Checks);
+
+    return (0U == TEST_Failures) ? 0 : 1;
+}
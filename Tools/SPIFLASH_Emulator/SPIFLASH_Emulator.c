@@ -0,0 +1,332 @@
+/*
+ ******************************************************************************
+ * @file           : SPIFLASH_Emulator.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) RAM Backed W25Q32 Standing in For HAL/SPIBUS
+ * @Date           : Sep 22, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o spiflash_roundtrip SPIFLASH_RoundTrip.c SPIFLASH_Emulator.c ../../HAL/SPIFLASH/Src/SPIFLASH_Program.c
+ * Use   : ./spiflash_roundtrip        ( Or Link Your Own Application in Place of SPIFLASH_RoundTrip.c )
+ *
+ * The SPIBUS Functions Are Implemented Here Over a 4 MB RAM Array , So HAL/SPIFLASH is Built Unchanged
+ * & Exercised on The Host . Every Device Handed to SPIBUS is Answered By The Same Emulated Flash
+ *
+ * Modelled Behavior :
+ *   - JEDEC ID EF 40 16 , Power Down Release , Status Register 1 ( BUSY & WEL )
+ *   - Fast Read With Its Dummy Byte , Wrapping at The End of The Array
+ *   - Page Program Wraps Inside The Page & Only Clears Bits , Erase Sets Bytes to 0xFF
+ *   - Program & Erase Need WEL , Start on Chip Select Release , & Stay Busy For a Few Status Reads
+ *   - Any Instruction Other Than Status Read is Ignored While Busy
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../../HAL/SPIBUS/Inc/SPIBUS_Interface.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+#define EMU_SIZE        (4UL * 1024UL * 1024UL)
+#define EMU_PAGE_SIZE   256UL
+#define EMU_SECTOR_SIZE 4096UL
+#define EMU_BLOCK_SIZE  65536UL
+
+/* Status Reads Answered Busy After Each Operation */
+#define EMU_PROGRAM_BUSY_READS 3U
+#define EMU_ERASE_BUSY_READS   10U
+
+#define EMU_STATUS_BUSY 0x01U
+#define EMU_STATUS_WEL  0x02U
+
+static const uint8_t EMU_JedecId[3] = {0xEF, 0x40, 0x16};
+
+static uint8_t EMU_Memory[EMU_SIZE];
+static uint8_t EMU_PageLatch[EMU_PAGE_SIZE];
+
+static uint8_t EMU_Initialized = 0;
+static uint8_t EMU_PoweredDown = 1;
+static uint8_t EMU_Status = 0;
+static uint32_t EMU_BusyReads = 0;
+
+/* Instruction Running Under The Current Chip Select */
+static const SPIBUS_Device_t *EMU_Owner = NULL;
+static uint8_t EMU_Command = 0;
+static uint32_t EMU_ByteIndex = 0;
+static uint32_t EMU_Address = 0;
+
+/**
+ * @brief  : This Function is Used to Clock One Byte Into The Emulated Flash & Return The Byte it Drives Back
+ */
+static uint8_t EMU_Clock(uint8_t Mosi)
+{
+    uint8_t Local_u8Miso = 0xFF;
+
+    if (0U == EMU_ByteIndex)
+    {
+        EMU_Command = Mosi;
+
+        /* Ignored Instructions Keep Command 0 Until Chip Select is Released */
+        if ((EMU_PoweredDown && (0xABU != Mosi)) || ((EMU_Status & EMU_STATUS_BUSY) && (0x05U != Mosi)))
+        {
+            EMU_Command = 0;
+        }
+    }
+    else
+    {
+        switch (EMU_Command)
+        {
+        case 0x05:
+            Local_u8Miso = EMU_Status;
+
+            if (EMU_BusyReads > 0U)
+            {
+                EMU_BusyReads--;
+            }
+            else
+            {
+                /* The Operation Ends , WEL is Cleared With BUSY */
+                EMU_Status = 0;
+            }
+            break;
+
+        case 0x9F:
+            Local_u8Miso = (EMU_ByteIndex <= 3U) ? EMU_JedecId[EMU_ByteIndex - 1U] : 0xFF;
+            break;
+
+        case 0x0B:
+        case 0x02:
+        case 0x20:
+        case 0xD8:
+            if (EMU_ByteIndex <= 3U)
+            {
+                EMU_Address = (EMU_Address << 8) | Mosi;
+            }
+            else if (0x0BU == EMU_Command)
+            {
+                /* Byte 4 is The Dummy Byte */
+                if (EMU_ByteIndex > 4U)
+                {
+                    Local_u8Miso = EMU_Memory[EMU_Address % EMU_SIZE];
+                    EMU_Address++;
+                }
+            }
+            else if (0x02U == EMU_Command)
+            {
+                EMU_PageLatch[(EMU_Address + (EMU_ByteIndex - 4U)) % EMU_PAGE_SIZE] &= Mosi;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    EMU_ByteIndex++;
+
+    return Local_u8Miso;
+}
+
+/**
+ * @brief  : This Function is Used to Run The Instruction Latched on The Chip Select Rising Edge
+ */
+static void EMU_Release(void)
+{
+    uint32_t Local_u32Base = 0;
+    uint32_t Local_u32Counter = 0;
+    uint32_t Local_u32Size = 0;
+
+    if ((0xABU == EMU_Command) && (1U == EMU_ByteIndex))
+    {
+        EMU_PoweredDown = 0;
+    }
+    else if ((0x06U == EMU_Command) && (1U == EMU_ByteIndex))
+    {
+        EMU_Status |= EMU_STATUS_WEL;
+    }
+    else if ((EMU_Status & EMU_STATUS_WEL) && (0x02U == EMU_Command) && (EMU_ByteIndex > 4U))
+    {
+        Local_u32Base = (EMU_Address % EMU_SIZE) & ~(EMU_PAGE_SIZE - 1UL);
+
+        for (Local_u32Counter = 0; Local_u32Counter < EMU_PAGE_SIZE; Local_u32Counter++)
+        {
+            EMU_Memory[Local_u32Base + Local_u32Counter] &= EMU_PageLatch[Local_u32Counter];
+        }
+
+        EMU_Status |= EMU_STATUS_BUSY;
+        EMU_BusyReads = EMU_PROGRAM_BUSY_READS;
+    }
+    else if ((EMU_Status & EMU_STATUS_WEL) && (((0x20U == EMU_Command) || (0xD8U == EMU_Command)) && (4U == EMU_ByteIndex)))
+    {
+        Local_u32Size = (0x20U == EMU_Command) ? EMU_SECTOR_SIZE : EMU_BLOCK_SIZE;
+        Local_u32Base = (EMU_Address % EMU_SIZE) & ~(Local_u32Size - 1UL);
+
+        memset(&EMU_Memory[Local_u32Base], 0xFF, Local_u32Size);
+
+        EMU_Status |= EMU_STATUS_BUSY;
+        EMU_BusyReads = EMU_ERASE_BUSY_READS;
+    }
+    else if ((EMU_Status & EMU_STATUS_WEL) && (0xC7U == EMU_Command) && (1U == EMU_ByteIndex))
+    {
+        memset(EMU_Memory, 0xFF, EMU_SIZE);
+
+        EMU_Status |= EMU_STATUS_BUSY;
+        EMU_BusyReads = EMU_ERASE_BUSY_READS;
+    }
+}
+
+/*==============================================================================================================================================
+ * SPIBUS FUNCTIONS
+ *==============================================================================================================================================*/
+
+ERRORS_t SPIBUS_Init(const SPI_Config_t *BusConfig)
+{
+    (void)BusConfig;
+
+    return SPIBUS_OK;
+}
+
+ERRORS_t SPIBUS_InitDevice(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (0U == EMU_Initialized)
+    {
+        /* Shipped Erased */
+        memset(EMU_Memory, 0xFF, EMU_SIZE);
+
+        EMU_Initialized = 1;
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_Begin(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (NULL != EMU_Owner)
+    {
+        Local_u8ErrorStatus = SPIBUS_BUSY;
+    }
+    else
+    {
+        EMU_Owner = Device;
+        EMU_Command = 0;
+        EMU_ByteIndex = 0;
+        EMU_Address = 0;
+
+        memset(EMU_PageLatch, 0xFF, EMU_PAGE_SIZE);
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_Exchange(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    uint16_t Local_u16Counter = 0;
+    uint8_t Local_u8Miso = 0;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if ((Device != EMU_Owner) || (0U == Size))
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        for (Local_u16Counter = 0; Local_u16Counter < Size; Local_u16Counter++)
+        {
+            Local_u8Miso = EMU_Clock((NULL != TxBuffer) ? TxBuffer[Local_u16Counter] : 0xFF);
+
+            if (NULL != RxBuffer)
+            {
+                RxBuffer[Local_u16Counter] = Local_u8Miso;
+            }
+        }
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_End(const SPIBUS_Device_t *Device)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if (NULL == Device)
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else if (Device != EMU_Owner)
+    {
+        Local_u8ErrorStatus = SPIBUS_NOK;
+    }
+    else
+    {
+        EMU_Release();
+
+        EMU_Owner = NULL;
+    }
+    return Local_u8ErrorStatus;
+}
+
+ERRORS_t SPIBUS_Transfer(const SPIBUS_Device_t *Device, const uint8_t *TxBuffer, uint8_t *RxBuffer, uint16_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_Begin(Device);
+
+    if (SPIBUS_OK == Local_u8ErrorStatus)
+    {
+        Local_u8ErrorStatus = SPIBUS_Exchange(Device, TxBuffer, RxBuffer, Size);
+
+        SPIBUS_End(Device);
+    }
+    return Local_u8ErrorStatus;
+}
+
+/* Runs to Completion Before Returning , The CallBack is Invoked From The Caller Context */
+ERRORS_t SPIBUS_Submit(SPIBUS_Transaction_t *Transaction)
+{
+    ERRORS_t Local_u8ErrorStatus = SPIBUS_OK;
+
+    if ((NULL == Transaction) || (NULL == Transaction->Device))
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    else
+    {
+        Local_u8ErrorStatus = SPIBUS_Transfer(Transaction->Device, Transaction->TxBuffer, Transaction->RxBuffer, Transaction->Size);
+
+        if (NULL != Transaction->CallBack)
+        {
+            Transaction->CallBack(Local_u8ErrorStatus);
+        }
+    }
+    return Local_u8ErrorStatus;
+}
@@ -0,0 +1,203 @@
+/*
+ ******************************************************************************
+ * @file           : SPIFLASH_RoundTrip.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) Round Trip of HAL/SPIFLASH Against The Emulated W25Q32
+ * @Date           : Sep 22, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o spiflash_roundtrip SPIFLASH_RoundTrip.c SPIFLASH_Emulator.c ../../HAL/SPIFLASH/Src/SPIFLASH_Program.c
+ * Use   : ./spiflash_roundtrip        ( Exit Status 0 When Every Check Passes )
+ *
+ * Checked :
+ *   - JEDEC Probe Out of Power Down , ID & Size
+ *   - Page Program Split Across Page Boundaries , Read Back & Untouched Neighbours
+ *   - Programming Only Clears Bits , Sector & Block Erase Stop at Their Boundaries
+ *   - Reads Longer Than SPIFLASH_READ_CHUNK_SIZE , Range Checks at The End of The Flash
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/GPIO/Inc/GPIO_Interface.h"
+#include "../../MCAL/SPI/Inc/SPI_Interface.h"
+
+#include "../../HAL/SPIBUS/Inc/SPIBUS_Interface.h"
+
+#include "../../HAL/SPIFLASH/Inc/SPIFLASH_Interface.h"
+#include "../../HAL/SPIFLASH/Inc/SPIFLASH_Config.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+#define TEST_JEDEC_ID 0xEF4016UL
+#define TEST_SIZE     (4UL * 1024UL * 1024UL)
+
+/* Longest Single Read , Spans Several Read Chunks */
+#define TEST_MAX_LENGTH (3UL * SPIFLASH_READ_CHUNK_SIZE)
+
+#define TEST_CHECK(COND, ...)          \
+    do                                 \
+    {                                  \
+        TEST_Checks++;                 \
+        if (!(COND))                   \
+        {                              \
+            TEST_Failures++;           \
+            printf("FAIL : ");         \
+            printf(__VA_ARGS__);       \
+            printf("\n");              \
+        }                              \
+    } while (0)
+
+static uint32_t TEST_Checks = 0;
+static uint32_t TEST_Failures = 0;
+
+/* The Emulator Answers Any Device , Bus Settings Are Not Used on The Host */
+static const SPIBUS_Device_t TEST_Device = {0};
+
+static SPIFLASH_Handle_t TEST_Flash = {.Device = &TEST_Device};
+
+static uint8_t TEST_Pattern[TEST_MAX_LENGTH];
+static uint8_t TEST_ReadBack[TEST_MAX_LENGTH];
+
+/**
+ * @brief  : Returns 1 if Length Bytes Read From Address All Equal Value
+ */
+static uint8_t TEST_IsFilled(uint32_t Address, uint32_t Length, uint8_t Value)
+{
+    uint32_t Local_u32Counter = 0;
+    uint8_t Local_u8Filled = 1;
+
+    if (SPIFLASH_OK != SPIFLASH_Read(&TEST_Flash, Address, TEST_ReadBack, Length))
+    {
+        Local_u8Filled = 0;
+    }
+
+    for (Local_u32Counter = 0; (Local_u32Counter < Length) && Local_u8Filled; Local_u32Counter++)
+    {
+        Local_u8Filled = (Value == TEST_ReadBack[Local_u32Counter]);
+    }
+    return Local_u8Filled;
+}
+
+/**
+ * @brief  : Programs Length Pattern Bytes at Address & Checks They Read Back
+ */
+static void TEST_WriteRead(uint32_t Address, uint32_t Length, const char *Name)
+{
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_Write(&TEST_Flash, Address, TEST_Pattern, Length), "%s : Write", Name);
+
+    memset(TEST_ReadBack, 0, Length);
+
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_Read(&TEST_Flash, Address, TEST_ReadBack, Length), "%s : Read", Name);
+    TEST_CHECK(0 == memcmp(TEST_Pattern, TEST_ReadBack, Length), "%s : Read Back Differs", Name);
+}
+
+static void TEST_Probe(void)
+{
+    uint8_t Local_u8Busy = 1;
+
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_Init(&TEST_Flash), "Init");
+    TEST_CHECK(TEST_JEDEC_ID == TEST_Flash.JedecId, "JEDEC ID %06X", (unsigned)TEST_Flash.JedecId);
+    TEST_CHECK(TEST_SIZE == TEST_Flash.Size, "Size %u", (unsigned)TEST_Flash.Size);
+
+    TEST_CHECK((SPIFLASH_OK == SPIFLASH_IsBusy(&TEST_Flash, &Local_u8Busy)) && (0U == Local_u8Busy), "Idle After Init");
+
+    TEST_CHECK(TEST_IsFilled(0, SPIFLASH_SECTOR_SIZE, 0xFF), "Shipped Erased");
+}
+
+static void TEST_PageBoundaries(void)
+{
+    /* Starts Mid Page & Ends Mid Page , Three Page Programs */
+    TEST_WriteRead(0x1F0UL, 600UL, "Across Two Page Boundaries");
+
+    TEST_CHECK(TEST_IsFilled(0x000UL, 0x1F0UL, 0xFF), "Before The Write Untouched");
+    TEST_CHECK(TEST_IsFilled(0x1F0UL + 600UL, 0x200UL, 0xFF), "After The Write Untouched");
+
+    /* Exactly One Page , Then One Byte Each Side of a Boundary */
+    TEST_WriteRead(0x2000UL, SPIFLASH_PAGE_SIZE, "Aligned Page");
+    TEST_WriteRead(0x30FFUL, 2UL, "Two Bytes Over a Boundary");
+    TEST_CHECK(TEST_IsFilled(0x3101UL, SPIFLASH_PAGE_SIZE, 0xFF), "Page After The Two Bytes Untouched");
+}
+
+static void TEST_ProgramAndErase(void)
+{
+    uint8_t Local_u8Byte = 0xF0;
+
+    /* Programming Over Programmed Data ANDs it */
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_Write(&TEST_Flash, 0x5000UL, &Local_u8Byte, 1), "First Program");
+    Local_u8Byte = 0x3C;
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_Write(&TEST_Flash, 0x5000UL, &Local_u8Byte, 1), "Second Program");
+    TEST_CHECK(TEST_IsFilled(0x5000UL, 1, 0x30), "Program Only Clears Bits");
+
+    /* Data Straddling a Sector Boundary , Only The Erased Sector Goes Back to 0xFF */
+    TEST_WriteRead(0x6F80UL, 0x100UL, "Across a Sector Boundary");
+
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_EraseSector(&TEST_Flash, 0x6ABCUL), "Erase Sector");
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_WaitReady(&TEST_Flash), "Wait For Sector Erase");
+    TEST_CHECK(TEST_IsFilled(0x6000UL, SPIFLASH_SECTOR_SIZE, 0xFF), "Erased Sector Reads 0xFF");
+    TEST_CHECK((SPIFLASH_OK == SPIFLASH_Read(&TEST_Flash, 0x7000UL, TEST_ReadBack, 0x80UL)) &&
+                   (0 == memcmp(&TEST_Pattern[0x80], TEST_ReadBack, 0x80UL)),
+               "Next Sector Kept");
+
+    /* Erase Right After a Write , The Driver Must Wait For The Last Page First */
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_Write(&TEST_Flash, 0x6000UL, TEST_Pattern, 16), "Write Before Erase");
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_EraseSector(&TEST_Flash, 0x6000UL), "Erase While Programming");
+    TEST_CHECK(TEST_IsFilled(0x6000UL, 16, 0xFF), "Erase After Write Took Effect");
+
+    /* Block Erase Clears Everything Written So Far in Block 0 , But Not Block 1 */
+    TEST_WriteRead(0x10000UL, 64UL, "Block 1 Data");
+    TEST_CHECK(SPIFLASH_OK == SPIFLASH_EraseBlock(&TEST_Flash, 0x1234UL), "Erase Block");
+    TEST_CHECK(TEST_IsFilled(0, SPIFLASH_BLOCK_SIZE, 0xFF), "Erased Block Reads 0xFF");
+    TEST_CHECK((SPIFLASH_OK == SPIFLASH_Read(&TEST_Flash, 0x10000UL, TEST_ReadBack, 64UL)) &&
+                   (0 == memcmp(TEST_Pattern, TEST_ReadBack, 64UL)),
+               "Next Block Kept");
+}
+
+static void TEST_LongAndRange(void)
+{
+    uint8_t Local_u8Byte = 0;
+
+    /* Longer Than One Read Chunk , & Ending on The Last Byte of The Flash */
+    TEST_WriteRead(TEST_SIZE - TEST_MAX_LENGTH, TEST_MAX_LENGTH, "Long Write Up to The End");
+
+    TEST_CHECK(SPIFLASH_NOK == SPIFLASH_Write(&TEST_Flash, TEST_SIZE - 1UL, TEST_Pattern, 2), "Write Past The End Refused");
+    TEST_CHECK(SPIFLASH_NOK == SPIFLASH_Read(&TEST_Flash, TEST_SIZE, &Local_u8Byte, 1), "Read Past The End Refused");
+    TEST_CHECK(SPIFLASH_NOK == SPIFLASH_Write(&TEST_Flash, 0, TEST_Pattern, 0), "Empty Write Refused");
+    TEST_CHECK(NULL_POINTER == SPIFLASH_Read(&TEST_Flash, 0, NULL, 1), "NULL Buffer Refused");
+}
+
+int main(void)
+{
+    uint32_t Local_u32Counter = 0;
+
+    /* No Byte Value Repeats at a Page or Sector Stride , So a Misplaced Page Shows up */
+    for (Local_u32Counter = 0; Local_u32Counter < TEST_MAX_LENGTH; Local_u32Counter++)
+    {
+        TEST_Pattern[Local_u32Counter] = (uint8_t)((Local_u32Counter * 7U) + (Local_u32Counter >> 8) + 1U);
+    }
+
+    TEST_Probe();
+    TEST_PageBoundaries();
+    TEST_ProgramAndErase();
+    TEST_LongAndRange();
+
+    printf("%u / %u Checks Passed\n", TEST_Checks - TEST_Failures, TEST_Checks);
+
+    return (0U == TEST_Failures) ? 0 : 1;
+}
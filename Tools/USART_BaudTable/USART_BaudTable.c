@@ -0,0 +1,141 @@
+/*
+ ******************************************************************************
+ * @file           : USART_BaudTable.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux ) BRR Table Generator & Checker For USART_CalculateBaudRate
+ * @Date           : Sep 3, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o usart_baudtable USART_BaudTable.c -lm
+ * Use   : ./usart_baudtable        ( Exit Status 0 When Every Entry Passes )
+ *
+ * Prints BRR , Achieved BaudRate & Error in ppm For Every Standard BaudRate at PCLK 8 , 36 & 72 MHz
+ * ( 8 MHz => HSI / HSE Without PLL , 36 MHz => PCLK1 at Full Speed , 72 MHz => PCLK2 at Full Speed )
+ *
+ * Each Entry is Checked Against The Reference Manual Method Worked in Floating Point
+ * ( Mantissa + Fraction Rounded to 1/16 ) , The Integer BRR Must Never Be Less Accurate
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+/* Must Match USART_Private.h */
+#define USART_BRR_MIN 0x10UL
+#define USART_BRR_MAX 0xFFFFUL
+
+/* Receivers With 16x Oversampling Tolerate About 3.75 % in Total , Keep One Side Well Below Half of That */
+#define TABLE_WARN_PPM 15000L
+
+/* Must Match USART_STANDARD_BAUDRATES in USART_Program.c */
+static const uint32_t TABLE_BaudRates[] = {1200UL, 2400UL, 4800UL, 9600UL, 14400UL, 19200UL, 38400UL,
+                                           57600UL, 115200UL, 230400UL, 460800UL, 921600UL};
+
+static const uint32_t TABLE_Clocks[] = {8000000UL, 36000000UL, 72000000UL};
+
+/**
+ * @brief  : Same Integer Math as USART_CalculateBaudRate ( Must Match USART_Program.c )
+ * @return : 0 if The BaudRate is Out of Range For The Clock
+ */
+static int TABLE_Calculate(uint32_t PCLK, uint32_t BaudRate, uint32_t *BRR, uint32_t *Achieved, int32_t *ErrorPPM)
+{
+    int Local_Valid = 0;
+
+    *BRR = (PCLK + (BaudRate / 2U)) / BaudRate;
+
+    if ((*BRR >= USART_BRR_MIN) && (*BRR <= USART_BRR_MAX))
+    {
+        *Achieved = (PCLK + (*BRR / 2U)) / *BRR;
+        *ErrorPPM = (int32_t)(((int64_t)PCLK - ((int64_t)*BRR * BaudRate)) * 1000000LL / ((int64_t)*BRR * BaudRate));
+
+        Local_Valid = 1;
+    }
+    return Local_Valid;
+}
+
+/**
+ * @brief  : Reference Manual Method : USARTDIV = PCLK / ( 16 * BaudRate ) , Fraction Rounded to 1/16
+ */
+static double TABLE_ReferenceErrorPPM(uint32_t PCLK, uint32_t BaudRate)
+{
+    double Local_Div = (double)PCLK / (16.0 * (double)BaudRate);
+    uint32_t Local_u32Mantissa = (uint32_t)Local_Div;
+    uint32_t Local_u32Fraction = (uint32_t)lround((Local_Div - (double)Local_u32Mantissa) * 16.0);
+    uint32_t Local_u32BRR = (Local_u32Mantissa << 4) + Local_u32Fraction;
+
+    return (((double)PCLK / (double)Local_u32BRR) - (double)BaudRate) * 1e6 / (double)BaudRate;
+}
+
+int main(void)
+{
+    uint32_t Local_u32Clock = 0;
+    uint32_t Local_u32Baud = 0;
+    uint32_t Local_u32BRR = 0;
+    uint32_t Local_u32Achieved = 0;
+    int32_t Local_s32ErrorPPM = 0;
+    double Local_RefPPM = 0;
+    uint32_t Local_u32Failures = 0;
+    const char *Local_Note = "";
+
+    for (Local_u32Clock = 0; Local_u32Clock < (sizeof(TABLE_Clocks) / sizeof(TABLE_Clocks[0])); Local_u32Clock++)
+    {
+        printf("\nPCLK = %lu Hz\n", (unsigned long)TABLE_Clocks[Local_u32Clock]);
+        printf("  BaudRate |    BRR |  Achieved |   Error ppm | Float Ref ppm |\n");
+
+        for (Local_u32Baud = 0; Local_u32Baud < (sizeof(TABLE_BaudRates) / sizeof(TABLE_BaudRates[0])); Local_u32Baud++)
+        {
+            if (!TABLE_Calculate(TABLE_Clocks[Local_u32Clock], TABLE_BaudRates[Local_u32Baud], &Local_u32BRR, &Local_u32Achieved, &Local_s32ErrorPPM))
+            {
+                /* Only Rates Above PCLK / 16 Are Expected to Be Rejected */
+                Local_Note = ((TABLE_BaudRates[Local_u32Baud] * 16ULL) > TABLE_Clocks[Local_u32Clock]) ? "Out of Range" : "REJECTED IN RANGE";
+
+                if ((TABLE_BaudRates[Local_u32Baud] * 16ULL) <= TABLE_Clocks[Local_u32Clock])
+                {
+                    Local_u32Failures++;
+                }
+
+                printf("%10lu |      - |         - |           - |             - | %s\n", (unsigned long)TABLE_BaudRates[Local_u32Baud], Local_Note);
+                continue;
+            }
+
+            Local_RefPPM = TABLE_ReferenceErrorPPM(TABLE_Clocks[Local_u32Clock], TABLE_BaudRates[Local_u32Baud]);
+
+            /* One ppm of Slack For The Integer Rounding of The Reported Error */
+            if ((double)labs(Local_s32ErrorPPM) > (fabs(Local_RefPPM) + 1.0))
+            {
+                Local_Note = "WORSE THAN REFERENCE";
+                Local_u32Failures++;
+            }
+            else if (labs(Local_s32ErrorPPM) > TABLE_WARN_PPM)
+            {
+                Local_Note = "Too Far Off For Reliable Reception";
+            }
+            else
+            {
+                Local_Note = "";
+            }
+
+            printf("%10lu | 0x%04lX | %9lu | %+11ld | %+13.0f | %s\n", (unsigned long)TABLE_BaudRates[Local_u32Baud],
+                   (unsigned long)Local_u32BRR, (unsigned long)Local_u32Achieved, (long)Local_s32ErrorPPM, Local_RefPPM, Local_Note);
+        }
+    }
+
+    printf("\n%s\n", (0U == Local_u32Failures) ? "All Entries OK" : "FAILED");
+
+    return (0U == Local_u32Failures) ? 0 : 1;
+}
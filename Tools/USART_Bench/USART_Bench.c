@@ -0,0 +1,485 @@
+/*
+ ******************************************************************************
+ * @file           : USART_Bench.c
+ * @Author         : Mohammed Ayman Shalaby
+ * @brief          : Host ( Linux x86-64 ) Cost Per Byte of The Old Validated USART Byte Path vs The Handle Fast Path
+ * @Date           : Sep 18, 2023
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 Ayman.
+ * All rights reserved.
+ *
+ ******************************************************************************
+ * Build : gcc -O2 -Wall -o usart_bench USART_Bench.c
+ * Use   : ./usart_bench [Bytes]        ( Default 64 Bytes Per Buffer )
+ *
+ * The Register Block is Placed on Its Own Page With SR Preset to TXE | TC | RXNE So Every Poll Succeeds First Time ,
+ * The Page is Kept PROT_NONE & Every Access to it Faults Once ( Counted as One Register Access ) , The Code is Single
+ * Stepped With The Trap Flag to Count Instructions ( perf Counters Are Usually Not Available in Containers )
+ *
+ * Old Path : Copy of The Baseline USART_SendData / USART_ReceiveData / USART_ReadFlag / USART_CheckConfig , Called Per Byte
+ * New Path : The Real USART_SendBufferFast / USART_ReceiveBufferFast From USART_Interface.h
+ *
+ * Figures Are Marginal Per Byte ( Buffer Minus Empty Call ) , Register Accesses Carry Over to The Target As Is ,
+ * Instruction Counts Are x86-64 & Only Meaningful as a Ratio
+ ******************************************************************************
+ */
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION START
+ *==============================================================================================================================================*/
+
+#define _GNU_SOURCE
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "../../LIB/STM32F103xx.h"
+#include "../../LIB/ErrType.h"
+
+#include "../../MCAL/USART/Inc/USART_Interface.h"
+
+/*==============================================================================================================================================
+ * INCLUDES SECTION END
+ *==============================================================================================================================================*/
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "USART_Bench Single Steps Through The Trap Flag & Needs Linux on x86-64"
+#endif
+
+#define BENCH_DEFAULT_BYTES 64U
+#define BENCH_MAX_BYTES     255U
+
+#define BENCH_TRAP_FLAG 0x100ULL
+
+/* Must Match USART_Private.h ( Not Included as it Carries Target Only Inline Assembly ) */
+#define OLD_CLEAR_PARITY_8_MASK 0x7F
+#define OLD_CLEAR_PARITY_9_MASK 0xFF
+
+/*==============================================================================================================================================
+ * STEP COUNTER
+ *==============================================================================================================================================*/
+
+static uint8_t *BENCH_RegPage = NULL;
+
+static long BENCH_PageSize = 0;
+
+static volatile uint32_t BENCH_Instructions = 0;
+static volatile uint32_t BENCH_RegAccesses = 0;
+static volatile uint8_t BENCH_Reprotect = 0;
+
+void BENCH_StepStop(void) __attribute__((noinline));
+
+void BENCH_StepStop(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+
+static void __attribute__((noinline)) BENCH_StepStart(void)
+{
+    __asm__ volatile("pushfq\n\t"
+                     "orq $0x100, (%%rsp)\n\t"
+                     "popfq" ::: "memory", "cc");
+}
+
+static void BENCH_TrapHandler(int Signal, siginfo_t *Info, void *Context)
+{
+    ucontext_t *Local_Context = (ucontext_t *)Context;
+
+    (void)Signal;
+    (void)Info;
+
+    if (BENCH_Reprotect)
+    {
+        /* The Faulting Instruction Has Now Executed , Guard The Registers Again For The Next Access */
+        mprotect(BENCH_RegPage, (size_t)BENCH_PageSize, PROT_NONE);
+        BENCH_Reprotect = 0;
+    }
+
+    if ((uintptr_t)Local_Context->uc_mcontext.gregs[REG_RIP] == (uintptr_t)&BENCH_StepStop)
+    {
+        Local_Context->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)BENCH_TRAP_FLAG;
+    }
+    else
+    {
+        BENCH_Instructions++;
+    }
+}
+
+static void BENCH_FaultHandler(int Signal, siginfo_t *Info, void *Context)
+{
+    (void)Signal;
+    (void)Context;
+
+    if (((uint8_t *)Info->si_addr < BENCH_RegPage) || ((uint8_t *)Info->si_addr >= (BENCH_RegPage + BENCH_PageSize)))
+    {
+        /* A Real Crash , Not a Register Access */
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    /* Let The Instruction Through Once , The Trap That Follows it Re Arms The Guard */
+    BENCH_RegAccesses++;
+    mprotect(BENCH_RegPage, (size_t)BENCH_PageSize, PROT_READ | PROT_WRITE);
+    BENCH_Reprotect = 1;
+}
+
+static void BENCH_InitStepper(void)
+{
+    struct sigaction Local_Action;
+
+    BENCH_PageSize = sysconf(_SC_PAGESIZE);
+
+    BENCH_RegPage = mmap(NULL, (size_t)BENCH_PageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == BENCH_RegPage)
+    {
+        perror("mmap");
+        exit(2);
+    }
+
+    memset(&Local_Action, 0, sizeof(Local_Action));
+    Local_Action.sa_flags = SA_SIGINFO;
+    sigemptyset(&Local_Action.sa_mask);
+
+    Local_Action.sa_sigaction = BENCH_TrapHandler;
+    sigaction(SIGTRAP, &Local_Action, NULL);
+
+    Local_Action.sa_sigaction = BENCH_FaultHandler;
+    sigaction(SIGSEGV, &Local_Action, NULL);
+}
+
+static void BENCH_Arm(void)
+{
+    BENCH_Instructions = 0;
+    BENCH_RegAccesses = 0;
+    BENCH_Reprotect = 0;
+
+    mprotect(BENCH_RegPage, (size_t)BENCH_PageSize, PROT_NONE);
+}
+
+static void BENCH_Disarm(void)
+{
+    mprotect(BENCH_RegPage, (size_t)BENCH_PageSize, PROT_READ | PROT_WRITE);
+}
+
+/*==============================================================================================================================================
+ * OLD PATH ( Baseline Driver , Kept Out of Line So The Per Byte Call Structure is What Gets Measured )
+ *==============================================================================================================================================*/
+
+static USART_RegDef_t *OLD_USART[USART_MAX_NUMBER] = {NULL};
+
+static ERRORS_t __attribute__((noinline)) OLD_USART_CheckConfig(USART_Config_t *Config)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (Config->Mode < USART_Rx || Config->Mode > USART_Rx_Tx ||
+        Config->USART_Number < USART_PERIPH_1 || Config->USART_Number > USART_PERIPH_3 ||
+        Config->WordLength < USART_8_BITS_WIDTH || Config->WordLength > USART_9_BITS_WIDTH ||
+        Config->ParityMode < USART_PARITY_DIS || Config->ParityMode > USART_PARITY_EN_ODD ||
+        Config->IT_FlagEnable.ParityErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ParityErrorIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.TDataRegEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TDataRegEmptyIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.TransmissionCompleteIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.TransmissionCompleteIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.RDataRegNEmptyIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.RDataRegNEmptyIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.IDLELineDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.IDLELineDetectedIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.CTSIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.CTSIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.ErrorIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.ErrorIT > USART_IT_FLAG_EN ||
+        Config->IT_FlagEnable.LINBreakDetectedIT < USART_IT_FLAG_DIS || Config->IT_FlagEnable.LINBreakDetectedIT > USART_IT_FLAG_EN ||
+        Config->StopBits < USART_ONE_SB || Config->StopBits > USART_ONE_AND_HALF_SB)
+    {
+        Local_u8ErrorStatus = USART_WRONG_CONFIGURATION;
+    }
+
+    return Local_u8ErrorStatus;
+}
+
+static ERRORS_t __attribute__((noinline)) OLD_USART_ReadFlag(USART_t USART_Type, USART_Flag_t Flag, USART_FlagStatus_t *FlagState)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    if (USART_Type < USART_PERIPH_1 || USART_Type > USART_PERIPH_3 ||
+        Flag < USART_PARITY_ERROR || Flag > USART_CTS_TOGGLE)
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    else
+    {
+        *FlagState = ((OLD_USART[USART_Type]->SR >> Flag) & 1);
+    }
+    return Local_u8ErrorStatus;
+}
+
+static ERRORS_t __attribute__((noinline)) OLD_USART_SendData(USART_Config_t *Config, uint16_t Data)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    USART_FlagStatus_t FlagStatus = USART_FLAG_RESET;
+
+    if (USART_WRONG_CONFIGURATION != OLD_USART_CheckConfig(Config))
+    {
+        while (USART_FLAG_SET != FlagStatus)
+        {
+            OLD_USART_ReadFlag(Config->USART_Number, USART_TDATA_REG_EMPTY, &FlagStatus);
+        }
+
+        OLD_USART[Config->USART_Number]->DR = Data;
+
+        FlagStatus = USART_FLAG_RESET;
+
+        while (USART_FLAG_SET != FlagStatus)
+        {
+            OLD_USART_ReadFlag(Config->USART_Number, USART_TRANSMISSION_COMP, &FlagStatus);
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = USART_NOK;
+    }
+    return Local_u8ErrorStatus;
+}
+
+static ERRORS_t __attribute__((noinline)) OLD_USART_ReceiveData(USART_Config_t *config, uint16_t *ReceivedData)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    USART_FlagStatus_t FlagState = USART_FLAG_RESET;
+
+    if (NULL != ReceivedData)
+    {
+        while (USART_FLAG_SET != FlagState)
+        {
+            OLD_USART_ReadFlag(config->USART_Number, USART_RDATA_REG_NEMPTY, &FlagState);
+        }
+
+        *ReceivedData = OLD_USART[config->USART_Number]->DR;
+
+        if (USART_PARITY_DIS != config->ParityMode)
+        {
+            if (config->WordLength == USART_8_BITS_WIDTH)
+            {
+                *ReceivedData &= (OLD_CLEAR_PARITY_8_MASK);
+            }
+            else if (config->WordLength == USART_8_BITS_WIDTH)
+            {
+                *ReceivedData &= (OLD_CLEAR_PARITY_9_MASK);
+            }
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    return Local_u8ErrorStatus;
+}
+
+static ERRORS_t __attribute__((noinline)) OLD_USART_SendBuffer(USART_Config_t *Configuration, uint8_t *Data, uint8_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint8_t Local_u8Counter = 0;
+
+    if ((NULL != Configuration) && (NULL != Data))
+    {
+        for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+        {
+            OLD_USART_SendData(Configuration, (uint16_t)Data[Local_u8Counter]);
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    return Local_u8ErrorStatus;
+}
+
+static ERRORS_t __attribute__((noinline)) OLD_USART_ReceiveBuffer(USART_Config_t *Config, uint16_t *ReceivedData, uint8_t Size)
+{
+    ERRORS_t Local_u8ErrorStatus = USART_OK;
+
+    uint8_t Local_u8Counter = 0;
+
+    /* The Baseline Stored Each Byte Through a uint16_t Pointer Into a uint8_t Buffer , a uint16_t Buffer Keeps The Copy In Bounds */
+    if ((NULL != Config) && (NULL != ReceivedData))
+    {
+        for (Local_u8Counter = 0; Local_u8Counter < Size; Local_u8Counter++)
+        {
+            OLD_USART_ReceiveData(Config, &ReceivedData[Local_u8Counter]);
+        }
+    }
+    else
+    {
+        Local_u8ErrorStatus = NULL_POINTER;
+    }
+    return Local_u8ErrorStatus;
+}
+
+/*==============================================================================================================================================
+ * NEW PATH ( Header Inline Fast Path , Wrapped Only to Give The Stepper a Call Boundary )
+ *==============================================================================================================================================*/
+
+/* The Driver's Software Flow Control Path , Never Taken as The Bench Handle Leaves SwFlowControl Off */
+void USART_PutByteFlowControl(const USART_Handle_t *Handle, uint16_t Data)
+{
+    (void)Handle;
+    (void)Data;
+
+    abort();
+}
+
+static void __attribute__((noinline)) NEW_USART_SendBuffer(const USART_Handle_t *Handle, const uint8_t *Data, uint16_t Size)
+{
+    USART_SendBufferFast(Handle, Data, Size);
+}
+
+static void __attribute__((noinline)) NEW_USART_ReceiveBuffer(const USART_Handle_t *Handle, uint8_t *Data, uint16_t Size)
+{
+    USART_ReceiveBufferFast(Handle, Data, Size);
+}
+
+/*==============================================================================================================================================
+ * MEASUREMENT
+ *==============================================================================================================================================*/
+
+typedef enum
+{
+    BENCH_OLD_SEND = 0,
+    BENCH_NEW_SEND,
+    BENCH_OLD_RECEIVE,
+    BENCH_NEW_RECEIVE,
+    BENCH_NONE,
+
+} BENCH_Path_t;
+
+typedef struct
+{
+    uint32_t Instructions;
+    uint32_t RegAccesses;
+
+} BENCH_Count_t;
+
+static USART_Config_t BENCH_Config;
+
+static USART_Handle_t BENCH_Handle;
+
+static uint8_t BENCH_TxBuffer[BENCH_MAX_BYTES];
+static uint8_t BENCH_RxBuffer[BENCH_MAX_BYTES];
+static uint16_t BENCH_RxWideBuffer[BENCH_MAX_BYTES];
+
+static BENCH_Count_t BENCH_Measure(BENCH_Path_t Path, uint8_t Size)
+{
+    BENCH_Count_t Local_Count;
+
+    BENCH_Arm();
+    BENCH_StepStart();
+
+    switch (Path)
+    {
+    case BENCH_OLD_SEND:
+        OLD_USART_SendBuffer(&BENCH_Config, BENCH_TxBuffer, Size);
+        break;
+    case BENCH_NEW_SEND:
+        NEW_USART_SendBuffer(&BENCH_Handle, BENCH_TxBuffer, Size);
+        break;
+    case BENCH_OLD_RECEIVE:
+        OLD_USART_ReceiveBuffer(&BENCH_Config, BENCH_RxWideBuffer, Size);
+        break;
+    case BENCH_NEW_RECEIVE:
+        NEW_USART_ReceiveBuffer(&BENCH_Handle, BENCH_RxBuffer, Size);
+        break;
+    default:
+        break;
+    }
+
+    BENCH_StepStop();
+    BENCH_Disarm();
+
+    Local_Count.Instructions = BENCH_Instructions;
+    Local_Count.RegAccesses = BENCH_RegAccesses;
+
+    return Local_Count;
+}
+
+static void BENCH_Report(const char *Name, BENCH_Path_t Path, uint8_t Size, BENCH_Count_t *PerByte)
+{
+    BENCH_Count_t Local_Empty = BENCH_Measure(Path, 0);
+    BENCH_Count_t Local_Full = BENCH_Measure(Path, Size);
+
+    PerByte->Instructions = (Local_Full.Instructions - Local_Empty.Instructions) / Size;
+    PerByte->RegAccesses = (Local_Full.RegAccesses - Local_Empty.RegAccesses) / Size;
+
+    printf("%-14s %6u Bytes : %5u Instructions / Byte , %2u Register Accesses / Byte ( Fixed Per Call %u / %u )\n",
+           Name, Size, PerByte->Instructions, PerByte->RegAccesses, Local_Empty.Instructions, Local_Empty.RegAccesses);
+}
+
+int main(int argc, char **argv)
+{
+    USART_RegDef_t *Local_Regs = NULL;
+
+    BENCH_Count_t Local_OldSend, Local_NewSend, Local_OldReceive, Local_NewReceive;
+
+    unsigned long Local_Bytes = (argc > 1) ? strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_BYTES;
+
+    uint16_t Local_u16Counter = 0;
+
+    if ((0 == Local_Bytes) || (Local_Bytes > BENCH_MAX_BYTES))
+    {
+        fprintf(stderr, "Bytes Must Be 1 .. %u ( The Old API Takes a uint8_t Size )\n", BENCH_MAX_BYTES);
+        return 2;
+    }
+
+    BENCH_InitStepper();
+
+    /* Every Poll Succeeds First Time , So Only The Driver's Own Work is Counted */
+    Local_Regs = (USART_RegDef_t *)BENCH_RegPage;
+    Local_Regs->SR = (uint16_t)((1U << USART_TDATA_REG_EMPTY) | (1U << USART_TRANSMISSION_COMP) | (1U << USART_RDATA_REG_NEMPTY));
+
+    OLD_USART[USART_PERIPH_1] = Local_Regs;
+
+    memset(&BENCH_Config, 0, sizeof(BENCH_Config));
+    BENCH_Config.USART_Number = USART_PERIPH_1;
+    BENCH_Config.Mode = USART_Rx_Tx;
+    BENCH_Config.WordLength = USART_8_BITS_WIDTH;
+    BENCH_Config.ParityMode = USART_PARITY_DIS;
+    BENCH_Config.StopBits = USART_ONE_SB;
+
+    BENCH_Handle.Instance = Local_Regs;
+    BENCH_Handle.Number = USART_PERIPH_1;
+    BENCH_Handle.DataMask = 0x1FF;
+
+    for (Local_u16Counter = 0; Local_u16Counter < BENCH_MAX_BYTES; Local_u16Counter++)
+    {
+        BENCH_TxBuffer[Local_u16Counter] = (uint8_t)Local_u16Counter;
+    }
+
+    BENCH_Report("Old Send", BENCH_OLD_SEND, (uint8_t)Local_Bytes, &Local_OldSend);
+    BENCH_Report("Fast Send", BENCH_NEW_SEND, (uint8_t)Local_Bytes, &Local_NewSend);
+    /* The Send Runs Left The Last Transmitted Byte in DR , Give The Receive Runs a Known Value */
+    Local_Regs->DR = 0x5A;
+
+    BENCH_Report("Old Receive", BENCH_OLD_RECEIVE, (uint8_t)Local_Bytes, &Local_OldReceive);
+    BENCH_Report("Fast Receive", BENCH_NEW_RECEIVE, (uint8_t)Local_Bytes, &Local_NewReceive);
+
+    printf("\nSend    : %.1fx Fewer Instructions , %u -> %u Register Accesses Per Byte\n",
+           (double)Local_OldSend.Instructions / (double)Local_NewSend.Instructions, Local_OldSend.RegAccesses, Local_NewSend.RegAccesses);
+    printf("Receive : %.1fx Fewer Instructions , %u -> %u Register Accesses Per Byte\n",
+           (double)Local_OldReceive.Instructions / (double)Local_NewReceive.Instructions, Local_OldReceive.RegAccesses, Local_NewReceive.RegAccesses);
+
+    /* Sanity : The Fast Receive Must Have Copied The Register Value Into Every Byte */
+    for (Local_u16Counter = 0; Local_u16Counter < Local_Bytes; Local_u16Counter++)
+    {
+        if ((0x5A != BENCH_RxBuffer[Local_u16Counter]) || (0x5A != BENCH_RxWideBuffer[Local_u16Counter]))
+        {
+            fprintf(stderr, "Receive Copy Mismatch at %u\n", Local_u16Counter);
+            return 1;
+        }
+    }
+
+    return 0;
+}